@@ -0,0 +1,124 @@
+#ifndef PLAY_TOGETHER_BODYSTREAMS_H
+#define PLAY_TOGETHER_BODYSTREAMS_H
+
+#include <SDL_rect.h>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @file BodyStreams.h
+ * @brief Defines the BodyStreams class holding the hot data of a collection of dynamic level objects.
+ */
+
+/**
+ * @class BodyStreams
+ * @brief Structure of arrays holding the position, size and simulation flags of a collection of dynamic level objects.
+ *
+ * Index i of every stream describes object i of the matching Level collection. The objects keep their behaviour and their
+ * render and audio data, the streams are what the movement loop, the spatial grids and the broad phase iterate: one byte
+ * of flags tells if an object has to be simulated at all, four packed floats give its bounding box.
+ */
+class BodyStreams {
+public:
+    static constexpr uint8_t ON_SCREEN = 1 << 0; /**< The object is in the broad phase area, its movement is simulated. */
+    static constexpr uint8_t LEAVING_SCREEN = 1 << 1; /**< The object just left the area, it is simulated once more to stop. */
+
+
+private:
+    /* ATTRIBUTES */
+
+    std::vector<float> x; /**< The x-coordinate of each object. */
+    std::vector<float> y; /**< The y-coordinate of each object. */
+    std::vector<float> w; /**< The width of each object. */
+    std::vector<float> h; /**< The height of each object. */
+    std::vector<uint8_t> flags; /**< The simulation flags of each object. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of objects.
+     * @return The number of objects.
+     */
+    [[nodiscard]] size_t size() const { return flags.size(); }
+
+    /**
+     * @brief Return the bounding box of an object.
+     * @param index The index of the object.
+     * @return The bounding box stored after the last movement of the object.
+     */
+    [[nodiscard]] SDL_FRect getBoundingBox(size_t index) const { return {x[index], y[index], w[index], h[index]}; }
+
+    /**
+     * @brief Check if the movement of an object has to be simulated.
+     * @param index The index of the object.
+     * @return True if the object is on screen or just left it, false if its movement is frozen.
+     */
+    [[nodiscard]] bool isSimulated(size_t index) const { return flags[index] & (ON_SCREEN | LEAVING_SCREEN); }
+
+    [[nodiscard]] const std::vector<float> &getX() const { return x; }
+    [[nodiscard]] const std::vector<float> &getY() const { return y; }
+    [[nodiscard]] const std::vector<float> &getW() const { return w; }
+    [[nodiscard]] const std::vector<float> &getH() const { return h; }
+    [[nodiscard]] const std::vector<uint8_t> &getFlags() const { return flags; }
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Store the bounding box of an object.
+     * @param index The index of the object.
+     * @param bounding_box The bounding box of the object.
+     */
+    void setBoundingBox(size_t index, const SDL_FRect &bounding_box) {
+        x[index] = bounding_box.x;
+        y[index] = bounding_box.y;
+        w[index] = bounding_box.w;
+        h[index] = bounding_box.h;
+    }
+
+    /**
+     * @brief Show or hide an object, a hidden object is simulated one last time.
+     * @param index The index of the object.
+     * @param state True if the object is in the broad phase area, false otherwise.
+     */
+    void setOnScreen(size_t index, bool state) {
+        if (state) flags[index] |= ON_SCREEN;
+        else if (flags[index] & ON_SCREEN) flags[index] = LEAVING_SCREEN;
+    }
+
+    /**
+     * @brief Mark the movement of an object as simulated, a hidden object is then frozen.
+     * @param index The index of the object.
+     */
+    void settle(size_t index) { flags[index] &= ~LEAVING_SCREEN; }
+
+    /**
+     * @brief Restore the simulation flags of every object, saved from getFlags().
+     * @param saved The flags, ignored if the number of objects changed.
+     */
+    void setFlags(const std::vector<uint8_t> &saved) {
+        if (saved.size() == flags.size()) flags = saved;
+    }
+
+
+    /* METHODS */
+
+    /**
+     * @brief Store the bounding box of every object of a collection, the new objects start hidden.
+     * @param objects The collection of objects.
+     * @note The flags of the objects already stored are kept.
+     */
+    template <typename T>
+    void assign(const std::vector<T> &objects) {
+        x.resize(objects.size());
+        y.resize(objects.size());
+        w.resize(objects.size());
+        h.resize(objects.size());
+        flags.resize(objects.size(), 0);
+        for (size_t i = 0; i < objects.size(); i++) setBoundingBox(i, objects[i].getBoundingBox());
+    }
+};
+
+#endif //PLAY_TOGETHER_BODYSTREAMS_H
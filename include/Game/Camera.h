@@ -3,7 +3,10 @@
 
 #include <SDL.h>
 #include <random>
+#include <cmath>
 #include "Point.h"
+#include "../Utils/SimulationClock.h"
+#include "../Utils/Profiler.h"
 
 constexpr float SCREEN_WIDTH = 800;
 constexpr float SCREEN_HEIGHT = 600;
@@ -14,6 +17,15 @@ const float DISTANCE_OUT_MAP_BEFORE_DEATH = 500;
  * @brief Defines the Camera class responsible for handling the camera logic.
  */
 
+/**
+ * @struct CameraState
+ * @brief Represents the part of the camera changed by the simulation, saved and restored by the rollback.
+ */
+struct CameraState {
+    float x; /**< The x-coordinate of the camera. */
+    float y; /**< The y-coordinate of the camera. */
+};
+
 /**
  * @class Camera
  * @brief Represents the camera logic including movement and shaking.
@@ -24,6 +36,8 @@ private:
 
     float x = 0; /**< The x-coordinate of the camera's position */
     float y = 0; /**< The y-coordinate of the camera's position */
+    float previousX = 0; /**< The x-coordinate of the camera's position at the end of the previous simulation step */
+    float previousY = 0; /**< The y-coordinate of the camera's position at the end of the previous simulation step */
     float w = SCREEN_WIDTH; /**< The width of the camera */
     float h = SCREEN_HEIGHT; /**< The height of the camera */
 
@@ -41,7 +55,7 @@ private:
     float shakeX = 0; /**< The x-coordinate of the camera's shake */
     float shakeY = 0; /**< The y-coordinate of the camera's shake */
     int shakeTime = 0; /**< The time to shake the camera, positives is the time to shake, 0 is not shaking, negatives shakes indefinitely */
-    Uint32 lastShakeUpdate = SDL_GetTicks(); /**< The time of the last shake update */
+    Uint32 lastShakeUpdate = SimulationClock::getTime(); /**< The time of the last shake update */
     float shakeAmplitude = 2; /**< The amplitude of the camera shake */
 
 
@@ -79,9 +93,10 @@ public:
 
     /**
      * @brief Return the rendering point of the camera.
-     * @return A Point representing the rendering point.
+     * @param interpolation The fraction of simulation step elapsed since the last update, between 0 and 1.
+     * @return A Point representing the rendering point, interpolated between the two last simulation steps.
      */
-    [[nodiscard]] Point getRenderingPoint() const;
+    [[nodiscard]] Point getRenderingPoint(float interpolation = 1.0f) const;
 
     /**
      * @brief Return the bounding box of the camera.
@@ -101,6 +116,12 @@ public:
      */
     [[nodiscard]] std::vector<Point> getBroadPhaseAreaVertices() const;
 
+    /**
+     * @brief Return the state of the camera changed by the simulation.
+     * @return The CameraState of the camera.
+     */
+    [[nodiscard]] CameraState getState() const;
+
 
     /* MODIFIERS */
 
@@ -123,6 +144,12 @@ public:
      */
     void setShake(int time, float amplitude = 2);
 
+    /**
+     * @brief Restore a state of the camera saved by getState().
+     * @param state The state to restore, the camera is not interpolated from its previous position.
+     */
+    void setState(const CameraState &state);
+
 
     /* METHODS */
 
@@ -139,6 +166,11 @@ public:
      */
     void applyMovement(Point camera_point, double delta_time);
 
+    /**
+     * @brief Update the shake of the camera, once per live simulation step.
+     */
+    void checkShake();
+
     /**
      * @brief Renders the collisions by drawing obstacles.
      * @param renderer Represents the renderer of the game.
@@ -155,11 +187,6 @@ public:
 
 private:
 
-    /**
-     * @brief Check if the camera should shake.
-     */
-    void checkShake();
-
     /**
      * @brief Applies a shake movement to the camera .
      */
@@ -0,0 +1,327 @@
+#ifndef PLAY_TOGETHER_COMPILEDLEVEL_H
+#define PLAY_TOGETHER_COMPILEDLEVEL_H
+
+#include <array>
+#include <bit>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include "../Physics/Polygon.h"
+#include "../Physics/AABB.h"
+#include "../../dependencies/json.hpp"
+
+/**
+ * @file CompiledLevel.h
+ * @brief Defines the binary level format compiled from the JSON maps and the CompiledLevel class mapping it in memory.
+ *
+ * A compiled level is a single file: a header, a table of sections, then the sections themselves. Each section is an
+ * array of fixed-size records made of 4-byte little-endian fields, so that the file is read in place once mapped. The
+ * geometry of the polygons is baked by the compiler and every reference between records has been checked by it.
+ */
+
+// Define constants for directories and file names
+constexpr char MAPS_DIRECTORY[] = "assets/maps/";
+constexpr char COMPILED_LEVEL_FILE[] = "level.bin"; /**< The name of the compiled level, next to the JSON files of the map. */
+constexpr std::array<char, 4> COMPILED_LEVEL_MAGIC = {'P', 'T', 'L', 'V'}; /**< The first bytes of a compiled level. */
+constexpr uint32_t COMPILED_LEVEL_VERSION = 2; /**< The version of the format, files of another version are ignored. */
+
+/**
+ * @enum LevelSection
+ * @brief Represents the sections of a compiled level, in the order of the section table.
+ */
+enum class LevelSection : uint32_t {
+    PROPERTIES, /**< One CompiledProperties. */
+    STRINGS, /**< The characters of every string, referenced by CompiledString. */
+    MUSICS, /**< The file names of the musics, as CompiledString. */
+    SPAWN_POINTS, /**< The spawn points, 4 Point per checkpoint. */
+    LAYERS, /**< The background and foreground layers, as CompiledLayer. */
+    POLYGONS, /**< The polygon zones of every type, as CompiledPolygon. */
+    VERTICES, /**< The vertices of the polygons, as Point. */
+    EDGE_NORMALS, /**< The baked edge normals of the polygons, as Point, one per vertex. */
+    PROJECTIONS, /**< The baked projections of the polygons, as Projection, one per vertex. */
+    AABBS, /**< The AABB zones of every type, as CompiledAABB. */
+    MOVING_PLATFORMS_1D, /**< The 1D moving platforms, as CompiledMovingPlatform1D. */
+    MOVING_PLATFORMS_2D, /**< The 2D moving platforms, as CompiledMovingPlatform2D. */
+    SWITCHING_PLATFORMS, /**< The switching platforms, as CompiledSwitchingPlatform. */
+    STEPS, /**< The steps of the switching platforms, as Point. */
+    WEIGHT_PLATFORMS, /**< The weight platforms, as CompiledWeightPlatform. */
+    TREADMILLS, /**< The treadmills, as CompiledTreadmill. */
+    CRUSHERS, /**< The crushers, as CompiledCrusher. */
+    TREADMILL_LEVERS, /**< The treadmill levers, as CompiledLever. */
+    PLATFORM_LEVERS, /**< The platform levers, as CompiledLever, the second targets are the 2D platforms. */
+    CRUSHER_LEVERS, /**< The crusher levers, as CompiledLever. */
+    TARGETS, /**< The indices of the objects switched by the levers, as uint32_t. */
+    SIZE_POWER_UPS, /**< The size power-ups, as CompiledPowerUp. */
+    SPEED_POWER_UPS, /**< The speed power-ups, as CompiledPowerUp. */
+    COINS, /**< The coins, as CompiledCoin. */
+    COUNT /**< The number of sections. */
+};
+
+/**
+ * @struct CompiledSectionEntry
+ * @brief Represents the location of a section in the file.
+ */
+struct CompiledSectionEntry {
+    uint32_t offset; /**< The position of the first record from the start of the file, a multiple of 4. */
+    uint32_t count; /**< The number of records. */
+    uint32_t recordSize; /**< The size of a record, checked against the structure read. */
+};
+
+/**
+ * @struct CompiledLevelHeader
+ * @brief Represents the start of a compiled level.
+ */
+struct CompiledLevelHeader {
+    std::array<char, 4> magic; /**< COMPILED_LEVEL_MAGIC. */
+    uint32_t version; /**< COMPILED_LEVEL_VERSION. */
+    uint32_t fileSize; /**< The size of the whole file. */
+    std::array<CompiledSectionEntry, static_cast<size_t>(LevelSection::COUNT)> sections; /**< The section table. */
+};
+
+/**
+ * @struct CompiledString
+ * @brief Represents a string stored in the STRINGS section.
+ */
+struct CompiledString {
+    uint32_t offset; /**< The position of the first character in the STRINGS section. */
+    uint32_t length; /**< The number of characters. */
+};
+
+/**
+ * @struct CompiledProperties
+ * @brief Represents the properties of a map.
+ */
+struct CompiledProperties {
+    int32_t worldID; /**< The ID of the world. */
+    int32_t mapID; /**< The ID of the map. */
+    CompiledString name; /**< The name of the map. */
+    CompiledString nextMap; /**< The name of the map following this one, empty for the last one. */
+};
+
+/**
+ * @struct CompiledLayer
+ * @brief Represents a decoration layer.
+ */
+struct CompiledLayer {
+    int32_t textureID; /**< The index of the texture in the backgrounds or the foregrounds of the TextureManager. */
+    int32_t layerIndex; /**< The depth of the layer. */
+    uint32_t foreground; /**< 1 if the layer is drawn in front of the players, 0 otherwise. */
+};
+
+/**
+ * @struct CompiledPolygon
+ * @brief Represents a polygon zone and its baked data.
+ */
+struct CompiledPolygon {
+    uint32_t type; /**< The PolygonType of the zone. */
+    uint32_t firstVertex; /**< The index of the first vertex, edge normal and projection of the polygon. */
+    uint32_t vertexCount; /**< The number of vertices. */
+    uint32_t convex; /**< 1 if the polygon is convex, 0 otherwise. */
+    SDL_FRect boundingBox; /**< The smallest axis-aligned rectangle containing the polygon. */
+};
+
+/**
+ * @struct CompiledAABB
+ * @brief Represents an AABB zone.
+ */
+struct CompiledAABB {
+    uint32_t type; /**< The AABBType of the zone. */
+    SDL_FRect rect; /**< The area of the zone. */
+};
+
+/**
+ * @struct CompiledMovingPlatform1D
+ * @brief Represents a 1D moving platform.
+ */
+struct CompiledMovingPlatform1D {
+    float x, y, size, speed, min, max; /**< The parameters of the MovingPlatform1D constructor. */
+    uint32_t start; /**< 1 if the platform moves from the start, 0 otherwise. */
+    uint32_t axis; /**< 1 if the platform moves vertically, 0 otherwise. */
+    int32_t texture; /**< The index of the texture in the platforms of the TextureManager. */
+};
+
+/**
+ * @struct CompiledMovingPlatform2D
+ * @brief Represents a 2D moving platform.
+ */
+struct CompiledMovingPlatform2D {
+    float x, y, size, speed; /**< The parameters of the MovingPlatform2D constructor. */
+    Point left, right; /**< The ends of the path of the platform. */
+    uint32_t start; /**< 1 if the platform moves from the start, 0 otherwise. */
+    int32_t texture; /**< The index of the texture in the platforms of the TextureManager. */
+};
+
+/**
+ * @struct CompiledSwitchingPlatform
+ * @brief Represents a switching platform.
+ */
+struct CompiledSwitchingPlatform {
+    float x, y, size; /**< The parameters of the SwitchingPlatform constructor. */
+    uint32_t bpm; /**< The number of switches per minute. */
+    uint32_t firstStep; /**< The index of the first step in the STEPS section. */
+    uint32_t stepCount; /**< The number of steps. */
+    int32_t texture; /**< The index of the texture in the platforms of the TextureManager. */
+};
+
+/**
+ * @struct CompiledWeightPlatform
+ * @brief Represents a weight platform.
+ */
+struct CompiledWeightPlatform {
+    float x, y, size, stepDistance; /**< The parameters of the WeightPlatform constructor. */
+    int32_t texture; /**< The index of the texture in the platforms of the TextureManager. */
+};
+
+/**
+ * @struct CompiledTreadmill
+ * @brief Represents a treadmill.
+ */
+struct CompiledTreadmill {
+    float x, y, size, speed, direction; /**< The parameters of the Treadmill constructor. */
+    uint32_t spriteSpeed; /**< The duration of a frame of the animation. */
+};
+
+/**
+ * @struct CompiledCrusher
+ * @brief Represents a crusher.
+ */
+struct CompiledCrusher {
+    float x, y, size, min, max; /**< The parameters of the Crusher constructor. */
+    uint32_t moveUpTime, waitUpTime, waitDownTime; /**< The durations of the cycle of the crusher. */
+    int32_t texture; /**< The index of the texture in the crushers of the TextureManager. */
+};
+
+/**
+ * @struct CompiledLever
+ * @brief Represents a lever of any kind and the objects it switches.
+ */
+struct CompiledLever {
+    float x, y, size; /**< The parameters of the Lever constructor. */
+    uint32_t isActivated; /**< 1 if the lever starts activated, 0 otherwise. */
+    int32_t type; /**< The type of a treadmill lever, 0 for the others. */
+    uint32_t firstTarget; /**< The index of the first target in the TARGETS section. */
+    uint32_t targetCount; /**< The number of targets, treadmills, 1D platforms or crushers. */
+    uint32_t firstSecondTarget; /**< The index of the first 2D platform of a platform lever in the TARGETS section. */
+    uint32_t secondTargetCount; /**< The number of 2D platforms of a platform lever, 0 for the others. */
+};
+
+/**
+ * @struct CompiledPowerUp
+ * @brief Represents a size or speed power-up.
+ */
+struct CompiledPowerUp {
+    SDL_FRect rect; /**< The area of the power-up. */
+    uint32_t effect; /**< 1 if the power-up grows or speeds up the player, 0 otherwise. */
+};
+
+/**
+ * @struct CompiledCoin
+ * @brief Represents a coin.
+ */
+struct CompiledCoin {
+    SDL_FRect rect; /**< The area of the coin. */
+    int32_t value; /**< The score given by the coin. */
+};
+
+
+/**
+ * @class CompiledLevel
+ * @brief Maps a compiled level in memory and gives access to its sections without copying them.
+ *
+ * compile() is the converter from the JSON maps, used by the play-together-level-compiler target.
+ */
+class CompiledLevel {
+private:
+    /* ATTRIBUTES */
+
+    const std::byte *data = nullptr; /**< The start of the mapped file. */
+    size_t size = 0; /**< The size of the mapped file. */
+#ifdef _WIN32
+    void *fileHandle = nullptr; /**< The handle of the opened file. */
+    void *mappingHandle = nullptr; /**< The handle of the file mapping. */
+#endif
+
+public:
+    /* CONSTRUCTORS */
+
+    CompiledLevel() = default;
+    CompiledLevel(const CompiledLevel &) = delete;
+    CompiledLevel &operator=(const CompiledLevel &) = delete;
+    ~CompiledLevel();
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the records of a section.
+     * @tparam T The record structure of the section, see LevelSection.
+     * @param section The section.
+     * @return The records, pointing into the mapped file, empty if no file is mapped or the record size does not match.
+     */
+    template <typename T>
+    [[nodiscard]] std::span<const T> getSection(LevelSection section) const {
+        if (data == nullptr) return {};
+        const CompiledSectionEntry &entry = header().sections[static_cast<size_t>(section)];
+        if (entry.recordSize != sizeof(T)) return {};
+        return {reinterpret_cast<const T*>(data + entry.offset), entry.count};
+    }
+
+    /**
+     * @brief Return a string of the STRINGS section.
+     * @param string The reference to the string.
+     * @return The characters, pointing into the mapped file.
+     */
+    [[nodiscard]] std::string_view getString(CompiledString string) const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Map the compiled level of a map, unless one of its JSON files changed since it was compiled.
+     * @param map_directory The directory of the map, ending with a slash.
+     * @return True if the file is mapped and its layout is valid, false if the JSON files must be read instead.
+     */
+    bool open(const std::string &map_directory);
+
+    /**
+     * @brief Unmap the file.
+     */
+    void close();
+
+    /**
+     * @brief Compile the JSON files of a map into a compiled level written next to them.
+     * @param map_directory The directory of the map, ending with a slash.
+     * @return True if the map is valid and the file is written, false otherwise.
+     */
+    static bool compile(const std::string &map_directory);
+
+private:
+    /**
+     * @brief Return the header of the mapped file.
+     * @return A reference to the header.
+     */
+    [[nodiscard]] const CompiledLevelHeader &header() const;
+
+    /**
+     * @brief Check the header and the bounds of every section of the mapped file.
+     * @return True if the records can be read in place, false otherwise.
+     */
+    [[nodiscard]] bool validate() const;
+};
+
+// Every record is read in place, its layout must not depend on the compiler
+static_assert(sizeof(CompiledSectionEntry) == 12 && sizeof(CompiledString) == 8 && sizeof(CompiledProperties) == 24);
+static_assert(sizeof(CompiledLayer) == 12 && sizeof(CompiledPolygon) == 32 && sizeof(CompiledAABB) == 20);
+static_assert(sizeof(CompiledMovingPlatform1D) == 36 && sizeof(CompiledMovingPlatform2D) == 40);
+static_assert(sizeof(CompiledSwitchingPlatform) == 28 && sizeof(CompiledWeightPlatform) == 20);
+static_assert(sizeof(CompiledTreadmill) == 24 && sizeof(CompiledCrusher) == 36 && sizeof(CompiledLever) == 36);
+static_assert(sizeof(CompiledPowerUp) == 20 && sizeof(CompiledCoin) == 20);
+static_assert(sizeof(Point) == 8 && sizeof(Projection) == 8);
+
+#endif //PLAY_TOGETHER_COMPILEDLEVEL_H
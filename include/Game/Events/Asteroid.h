@@ -6,6 +6,7 @@
 #include <vector>
 #include <random>
 #include "../../Graphics/Sprite.h"
+#include "../../Graphics/TextureAtlas.h"
 #include "../Point.h"
 #include "../Camera.h"
 #include "../../Sounds/SoundEffect.h"
@@ -16,6 +17,24 @@
  * @brief Defines the Asteroid class representing an asteroid.
  */
 
+/**
+ * @struct AsteroidState
+ * @brief Represents the part of an asteroid changed by the simulation, saved and restored by the rollback.
+ */
+struct AsteroidState {
+    float x; /**< The x-coordinate of the asteroid. */
+    float y; /**< The y-coordinate of the asteroid. */
+    float previousX; /**< The x-coordinate of the asteroid at the end of the previous simulation step. */
+    float previousY; /**< The y-coordinate of the asteroid at the end of the previous simulation step. */
+    float h; /**< The height of the asteroid. */
+    float w; /**< The width of the asteroid. */
+    float speed; /**< The speed of the asteroid. */
+    float horizontalSpeed; /**< The horizontal speed of the asteroid. */
+    float verticalSpeed; /**< The vertical speed of the asteroid. */
+    float angle; /**< The angle of the asteroid. */
+    float angle_radians; /**< The angle radians of the asteroid. */
+};
+
 /**
  * @class Asteroid
  * @brief Represents a switching asteroid in a 2D game.
@@ -26,6 +45,8 @@ private :
 
     float x = 0; /**< The x-coordinate of the asteroid's position. */
     float y = 0; /**< The y-coordinate of the asteroid's position. */
+    float previousX = 0; /**< The x-coordinate of the asteroid's position at the end of the previous simulation step. */
+    float previousY = 0; /**< The y-coordinate of the asteroid's position at the end of the previous simulation step. */
     float h = 80; /**< The height of the asteroid. */
     float w = 80; /**< The width of the asteroid.*/
 
@@ -133,6 +154,12 @@ public :
      */
     [[nodiscard]] std::vector<Point> getVertices() const;
 
+    /**
+     * @brief Return the state of the asteroid changed by the simulation, its sprite is only animated by the render.
+     * @return The AsteroidState of the asteroid.
+     */
+    [[nodiscard]] AsteroidState getState() const;
+
 
     /* MODIFIERS */
 
@@ -167,29 +194,46 @@ public :
      */
     void setAngle(float val);
 
+    /**
+     * @brief Restore a state of the asteroid saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const AsteroidState &state);
+
 
     /* PUBLIC METHODS */
 
+    /**
+     * @brief Reuse the asteroid as a new one spawned above the camera, at a random position and angle.
+     * @param x The x position of the interval start.
+     * @param y The y position of the interval start.
+     * @param seed The seed for random number generation.
+     */
+    void respawn(float x, float y, size_t seed);
+
     /**
      * @brief Load all asteroid textures.
      * @param renderer The renderer of the game.
+     * @param atlas The atlas the textures are packed into.
      * @return Returns true if all textures were loaded correctly, false otherwise.
      */
-    static bool loadTextures(SDL_Renderer &renderer);
+    static bool loadTextures(SDL_Renderer &renderer, TextureAtlas &atlas);
 
     /**
      * @brief Renders the asteroid's sprite.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the asteroid between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera);
+    void render(SDL_Renderer *renderer, Point camera, float interpolation);
 
     /**
      * @brief Renders the asteroid's collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the asteroid between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const;
 
     /**
      * @brief Applies the movement of the asteroid based on its speed and angle.
@@ -0,0 +1,113 @@
+#ifndef PLAY_TOGETHER_ASTEROIDPOOL_H
+#define PLAY_TOGETHER_ASTEROIDPOOL_H
+
+#include <vector>
+#include <algorithm>
+#include "Asteroid.h"
+
+/**
+ * @file AsteroidPool.h
+ * @brief Defines the AsteroidPool class holding the asteroids of a level.
+ */
+
+/**
+ * @class AsteroidPool
+ * @brief Fixed-capacity storage recycling its asteroids instead of constructing new ones.
+ *
+ * The live asteroids are packed at the front of the slots, the slots after them form the free list. Removing an asteroid
+ * swaps it with the last live one, spawning one reuses the first free slot. Once every slot was used once, asteroid
+ * showers no longer allocate.
+ */
+class AsteroidPool {
+public:
+    static constexpr size_t capacity = 64; /**< The maximum number of asteroids alive at the same time. */
+
+
+private:
+    /* ATTRIBUTES */
+
+    std::vector<Asteroid> slots; /**< The asteroids ever spawned, the live ones first. */
+    size_t count = 0; /**< The number of live asteroids. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    AsteroidPool();
+    AsteroidPool(const AsteroidPool &other);
+
+    /**
+     * @brief Copy the live asteroids of another pool into the slots of this one.
+     * @param other The pool to copy.
+     * @return This pool.
+     */
+    AsteroidPool &operator=(const AsteroidPool &other);
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of live asteroids.
+     * @return The number of asteroids.
+     */
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] Asteroid &operator[](size_t index);
+    [[nodiscard]] const Asteroid &operator[](size_t index) const;
+
+    [[nodiscard]] Asteroid *begin();
+    [[nodiscard]] Asteroid *end();
+    [[nodiscard]] const Asteroid *begin() const;
+    [[nodiscard]] const Asteroid *end() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Spawn an asteroid above the camera at a random position and angle.
+     * @param x The x position of the interval start.
+     * @param y The y position of the interval start.
+     * @param seed The seed for random number generation.
+     * @return The spawned asteroid, nullptr if the pool is full.
+     */
+    Asteroid *spawn(float x, float y, size_t seed);
+
+    /**
+     * @brief Spawn a copy of an asteroid, received from the network for instance.
+     * @param asteroid The asteroid to copy.
+     * @return The spawned asteroid, nullptr if the pool is full.
+     */
+    Asteroid *spawn(const Asteroid &asteroid);
+
+    /**
+     * @brief Remove an asteroid, the last live asteroid takes its index.
+     * @param index The index of the asteroid.
+     */
+    void remove(size_t index);
+
+    /**
+     * @brief Remove every asteroid, their slots are kept.
+     */
+    void clear();
+
+    /**
+     * @brief Save the live asteroids, the buffer keeps its capacity from one save to the next.
+     * @param[out] states The state of each live asteroid.
+     */
+    void saveState(std::vector<AsteroidState> &states) const;
+
+    /**
+     * @brief Replace the live asteroids with the ones saved by saveState(), reusing the slots.
+     * @param states The state of each asteroid.
+     */
+    void restoreState(const std::vector<AsteroidState> &states);
+
+private:
+    /**
+     * @brief Return the first free slot, constructing it if it was never used.
+     * @return The slot, nullptr if the pool is full.
+     */
+    Asteroid *acquire();
+};
+
+#endif //PLAY_TOGETHER_ASTEROIDPOOL_H
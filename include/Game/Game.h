@@ -10,8 +10,10 @@
 #include <algorithm>
 #include <SDL_ttf.h>
 #include <queue>
+#include <atomic>
 #include "../Utils/Mediator.h"
 #include "../Utils/MessageQueue.h"
+#include "../Utils/Profiler.h"
 #include "Level.h"
 #include "GameManagers/PlayerCollisionManager.h"
 #include "GameManagers/InputManager.h"
@@ -21,6 +23,9 @@
 #include "GameManagers/PlayerManager.h"
 #include "GameManagers/BroadPhaseManager.h"
 #include "GameManagers/EventCollisionManager.h"
+#include "GameManagers/PredictionManager.h"
+#include "GameManagers/RollbackManager.h"
+#include "GameManagers/LevelPreloader.h"
 
 
 /**
@@ -36,6 +41,23 @@ class BroadPhaseManager;
 class PlayerManager;
 class PlayerCollisionManager;
 class EventCollisionManager;
+class PredictionManager;
+class RollbackManager;
+class LevelPreloader;
+
+
+/**
+ * @struct StepTimings
+ * @brief Represents the time spent in the phases of a simulation step, in performance counter ticks.
+ */
+struct StepTimings {
+    Uint64 playersMovement = 0; /**< Calculating and applying the movement of the players. */
+    Uint64 platformsMovement = 0; /**< Level::applyPlatformsMovement(). */
+    Uint64 broadPhase = 0; /**< BroadPhaseManager::broadPhase(). */
+    Uint64 asteroidsCollisions = 0; /**< EventCollisionManager::handleAsteroidsCollisions(). */
+    Uint64 playersCollisions = 0; /**< PlayerCollisionManager::handleCollisions(). */
+    Uint64 total = 0; /**< The whole step, including the phases not listed above. */
+};
 
 
 /**
@@ -47,7 +69,8 @@ private:
     /* ATTRIBUTES */
     static constexpr float effectiveFrameRateUpdateIntervalSeconds = 1.0f;
     static constexpr float networkInputSendIntervalSeconds = 1.0f / 60.0f;
-    static constexpr float networkSyncCorrectionIntervalSeconds = 0.50f;
+    static constexpr double maxFrameTimeSeconds = 0.25; /**< The longest frame time simulated, longer stalls are dropped. */
+    static constexpr int maxSimulationStepsPerFrame = 8; /**< The maximum number of simulation steps run before rendering a frame. */
 
     SDL_Window *window; /**< SDL window for rendering. */
     SDL_Renderer *renderer; /**< SDL renderer for rendering graphics. */
@@ -60,6 +83,9 @@ private:
     std::unique_ptr<PlayerManager> playerManager; /**< Player manager for handling the players in the game. */
     std::unique_ptr<PlayerCollisionManager> playerCollisionManager; /**< Player collision manager for handling the player collisions in the game. */
     std::unique_ptr<EventCollisionManager> eventCollisionManager; /**< Event collision manager for handling the event collisions in the game. */
+    std::unique_ptr<PredictionManager> predictionManager; /**< Prediction manager for reconciling the local player with the server. */
+    std::unique_ptr<RollbackManager> rollbackManager; /**< Rollback manager for resimulating the game when inputs arrive late. */
+    std::unique_ptr<LevelPreloader> levelPreloader; /**< Level preloader for preparing the images of the next level in the background. */
 
     int frameRate = 60; /**< The refresh rate of the game. */
     int effectiveFrameFps = frameRate; /**< The effective fps. */
@@ -67,8 +93,9 @@ private:
     Uint32 playtime = 0; /**< The time in milliseconds elapsed since the game started. */
 
     GameState gameState = GameState::STOPPED; /**< The current game state. */
-    bool *quitFlagPtr = nullptr; /**< Reference to the quit flag. */
+    std::atomic<bool> *quitFlagPtr = nullptr; /**< Reference to the quit flag, may be set by another thread. */
     MessageQueue *messageQueue; /**< The message queue for communication between threads. */
+    Message receivedMessage; /**< The last message popped from the queue, reused to keep its buffers. */
     Camera camera; /**< The camera object */
     Level level; /**< The level object */
     Music music; /**< Represents the music that is currently played in the game. */
@@ -78,7 +105,7 @@ private:
 public:
     /* CONSTRUCTORS */
 
-    Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quitFlag, MessageQueue *messageQueue);
+    Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, std::atomic<bool> *quitFlag, MessageQueue *messageQueue);
 
 
     /* ACCESSORS */
@@ -125,6 +152,24 @@ public:
      */
     [[nodiscard]] BroadPhaseManager &getBroadPhaseManager();
 
+    /**
+     * @brief Returns the prediction manager of the game.
+     * @return A pointer of PredictionManager object representing the prediction manager of the game.
+     */
+    [[nodiscard]] PredictionManager &getPredictionManager();
+
+    /**
+     * @brief Returns the rollback manager of the game.
+     * @return A pointer of RollbackManager object representing the rollback manager of the game.
+     */
+    [[nodiscard]] RollbackManager &getRollbackManager();
+
+    /**
+     * @brief Returns the level preloader of the game.
+     * @return A pointer of LevelPreloader object representing the level preloader of the game.
+     */
+    [[nodiscard]] LevelPreloader &getLevelPreloader();
+
     /**
      * @brief Returns the camera of the game.
      * @return A pointer of Camera object representing the camera of the game.
@@ -198,13 +243,36 @@ public:
                    const nlohmann::json::array_t &movingPlatforms1D, const nlohmann::json::array_t &movingPlatforms2D, const nlohmann::json::array_t &crushers);
 
     /**
-     * @brief Updates the game logic.
-     * @param delta_time The time elapsed since the last frame in seconds.
+     * @brief Applies all the messages received from the network threads since the last call.
+     */
+    void handleMessages();
+
+    /**
+     * @brief Advances the game logic by one simulation step, starting with the received network messages.
+     * @param delta_time The duration of the step in seconds, SimulationClock::TIME_STEP in the game loop.
      */
     void update(double delta_time);
 
     /**
-     * @brief Runs the game loop.
+     * @brief Simulates again a past step restored by the rollback manager, the inputs of the step are already applied.
+     *
+     * The network messages, the camera shake and the asteroid generation are left to the live steps.
+     * @param delta_time The duration of the step in seconds, SimulationClock::TIME_STEP.
+     */
+    void resimulate(double delta_time);
+
+    /**
+     * @brief Advances the game logic by one simulation step like update() and measures its phases.
+     *
+     * No network message is handled, asteroids are generated up to the given count.
+     * @param delta_time The duration of the step in seconds, SimulationClock::TIME_STEP.
+     * @param asteroid_count The number of asteroids kept in the level.
+     * @param[out] timings The time spent in each phase of the step.
+     */
+    void benchmarkUpdate(double delta_time, int asteroid_count, StepTimings &timings);
+
+    /**
+     * @brief Runs the game loop, simulating fixed steps and rendering interpolated frames.
      */
     void run();
 
@@ -246,11 +314,15 @@ private:
     void updatePlayersSpriteAnimation();
 
     /**
-     * @brief Main method that handle collisions for every player according to their mavity.
-     * @param delta_time The time elapsed since the last frame in seconds.
-     * @see handleCollisionsNormalMavity() and handleCollisionsReversedMavity() for sub-functions.
+     * @brief Advances the game logic by one simulation step, shared by update(), resimulate() and benchmarkUpdate().
+     *
+     * A replayed step leaves the camera shake and the asteroid generation to the live steps.
+     * @param delta_time The duration of the step in seconds.
+     * @param replayed True if the step is simulated again by the rollback manager, false otherwise.
+     * @param asteroid_count The number of asteroids kept in the level, 0 in the game loop.
+     * @param[out] timings The time spent in each phase of the step, nullptr to not measure it.
      */
-    void narrowPhase(double delta_time);
+    void step(double delta_time, bool replayed, int asteroid_count = 0, StepTimings *timings = nullptr);
 
 };
 
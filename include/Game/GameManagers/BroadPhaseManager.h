@@ -2,6 +2,7 @@
 #define PLAY_TOGETHER_BROADPHASEMANAGER_H
 
 #include "../Game.h"
+#include "../VisibleSet.h"
 
 /**
  * @file BroadPhaseManager.h
@@ -15,34 +16,8 @@ private:
 
     Game *gamePtr; /**< A pointer to the game object. */
 
-    // ZONES
-    std::vector<AABB> saveZones; /**< Collection of polygons representing save zones. */
-    std::vector<AABB> rescueZones; /**< Collection of polygons representing rescue zones. */
-    std::vector<Polygon> deathZones; /**< Collection of polygons representing death zones. */
-    std::vector<Polygon> obstacles; /**< Collection of polygons representing obstacles. */
-    std::vector<AABB> toggleGravityZones; /**< Collection of polygons representing toggle gravity zones. */
-    std::vector<AABB> increaseFallSpeedZones; /**< Collection of polygons representing increase fall speed zones. */
-
-    // LEVERS
-    std::vector<TreadmillLever> treadmillLevers; /**< Collection of TreadmillLever representing treadmill levers. */
-    std::vector<PlatformLever> platformLevers; /**< Collection of PlatformLever representing platform levers. */
-    std::vector<CrusherLever> crusherLevers; /**< Collection of CrusherLever representing crusher levers. */
-
-    // PLATFORMS
-    std::vector<MovingPlatform1D> movingPlatforms1D; /**< Collection of MovingPlatform1D representing 1D platforms. */
-    std::vector<MovingPlatform2D> movingPlatforms2D; /**< Collection of MovingPlatform2D representing 2D platforms. */
-    std::vector<SwitchingPlatform> switchingPlatforms; /**< Collection of switchingPlatform representing switching platforms. */
-    std::vector<WeightPlatform> weightPlatforms; /**< Collection of WeightPlatform representing weight platforms. */
-    std::vector<Treadmill> treadmills; /**< Collection of Treadmill representing treadmills. */
-
-    // TRAPS
-    std::vector<Crusher> crushers; /**< Collection of Crusher representing crushers. */
-
-    // ITEMS
-    std::vector<SizePowerUp> sizePowerUp; /**< Collection of SizePowerUp representing size power-up. */
-    std::vector<SpeedPowerUp> speedPowerUp; /**< Collection of SizePowerUp representing size power-up. */
-    std::vector<Coin> coins; /**< Collection of Coin representing coins. */
-    std::vector<Item*> items; /**< Collection of items. */
+    VisibleSet visibleSet; /**< The level objects near the camera, found by the last broad phase. */
+    std::vector<size_t> candidates; /**< Indices returned by the last grid query or packed scan, reused between queries. */
 
 
 public:
@@ -54,34 +29,71 @@ public:
 
     /* ACCESSORS */
 
-    [[nodiscard]] std::vector<AABB> &getSaveZones();
-    [[nodiscard]] std::vector<AABB> &getRescueZones();
-    [[nodiscard]] std::vector<AABB> &getToggleGravityZones();
-    [[nodiscard]] std::vector<AABB> &getIncreaseFallSpeedZones();
-    [[nodiscard]] std::vector<Polygon> &getDeathZones();
-    [[nodiscard]] std::vector<Polygon> &getObstacles();
-    [[nodiscard]] std::vector<TreadmillLever> &getTreadmillLevers();
-    [[nodiscard]] std::vector<PlatformLever> &getPlatformLevers();
-    [[nodiscard]] std::vector<CrusherLever> &getCrusherLevers();
-    [[nodiscard]] std::vector<MovingPlatform1D> &getMovingPlatforms1D();
-    [[nodiscard]] std::vector<MovingPlatform2D> &getMovingPlatforms2D();
-    [[nodiscard]] std::vector<SwitchingPlatform> &getSwitchingPlatforms();
-    [[nodiscard]] std::vector<WeightPlatform> &getWeightPlatforms();
-    [[nodiscard]] std::vector<Treadmill> &getTreadmills();
-    [[nodiscard]] std::vector<Crusher> &getCrushers();
-    [[nodiscard]] std::vector<SizePowerUp> &getSizePowerUps();
-    [[nodiscard]] std::vector<SpeedPowerUp> &getSpeedPowerUps();
-    [[nodiscard]] std::vector<Coin> &getCoins();
-    [[nodiscard]] std::vector<Item*> &getItems();
+    // Every accessor returns indices, sorted in ascending order, into the matching Level collection.
+    [[nodiscard]] const std::vector<size_t> &getSaveZones() const;
+    [[nodiscard]] const std::vector<size_t> &getRescueZones() const;
+    [[nodiscard]] const std::vector<size_t> &getToggleGravityZones() const;
+    [[nodiscard]] const std::vector<size_t> &getIncreaseFallSpeedZones() const;
+    [[nodiscard]] const std::vector<size_t> &getDeathZones() const;
+    [[nodiscard]] const std::vector<size_t> &getObstacles() const;
+    [[nodiscard]] const std::vector<size_t> &getTreadmillLevers() const;
+    [[nodiscard]] const std::vector<size_t> &getPlatformLevers() const;
+    [[nodiscard]] const std::vector<size_t> &getCrusherLevers() const;
+    [[nodiscard]] const std::vector<size_t> &getMovingPlatforms1D() const;
+    [[nodiscard]] const std::vector<size_t> &getMovingPlatforms2D() const;
+    [[nodiscard]] const std::vector<size_t> &getSwitchingPlatforms() const;
+    [[nodiscard]] const std::vector<size_t> &getWeightPlatforms() const;
+    [[nodiscard]] const std::vector<size_t> &getTreadmills() const;
+    [[nodiscard]] const std::vector<size_t> &getCrushers() const;
+    [[nodiscard]] const std::vector<size_t> &getSizePowerUps() const;
+    [[nodiscard]] const std::vector<size_t> &getSpeedPowerUps() const;
+    [[nodiscard]] const std::vector<size_t> &getCoins() const;
+    [[nodiscard]] const std::vector<size_t> &getItems() const;
+
+    /**
+     * @brief Return the level objects found near the camera by the last broad phase, for the rendering.
+     * @return A constant reference to the visible set.
+     */
+    [[nodiscard]] const VisibleSet &getVisibleSet() const;
 
 
     /* METHODS */
 
     /**
      * @brief Broad phase collision detection, detects objects that could potentially collide with each other.
+     * @note Only the cells of the level spatial grids overlapping the broad phase area are visited.
      */
     void broadPhase();
 
+    /**
+     * @brief Forget the objects found by the last broad phase, their indices no longer match the level.
+     */
+    void clear();
+
+    /**
+     * @brief Remove a size power-up from the level and shift the indices found after it.
+     * @param position The position of the power-up in the getSizePowerUps() indices.
+     */
+    void removeSizePowerUp(size_t position);
+
+    /**
+     * @brief Remove a speed power-up from the level and shift the indices found after it.
+     * @param position The position of the power-up in the getSpeedPowerUps() indices.
+     */
+    void removeSpeedPowerUp(size_t position);
+
+    /**
+     * @brief Remove a coin from the level and shift the indices found after it.
+     * @param position The position of the coin in the getCoins() indices.
+     */
+    void removeCoin(size_t position);
+
+    /**
+     * @brief Remove an item from the level and shift the indices found after it.
+     * @param position The position of the item in the getItems() indices.
+     */
+    void removeItem(size_t position);
+
 
 private:
 
@@ -90,8 +102,8 @@ private:
     void checkRescueZones(const SDL_FRect& broad_phase_area);
     void checkToggleGravityZones(const SDL_FRect& broad_phase_area);
     void checkIncreaseFallSpeedZones(const SDL_FRect& broad_phase_area);
-    void checkDeathZones(const std::vector<Point>& broad_phase_area);
-    void checkObstacles(const std::vector<Point>& broad_phase_area);
+    void checkDeathZones(const SDL_FRect& broad_phase_area);
+    void checkObstacles(const SDL_FRect& broad_phase_area);
     void checkTreadmillLevers(const SDL_FRect& broad_phase_area);
     void checkPlatformLevers(const SDL_FRect& broad_phase_area);
     void checkCrusherLevers(const SDL_FRect& broad_phase_area);
@@ -105,6 +117,13 @@ private:
     void checkCoins(const SDL_FRect& broad_phase_area);
     void checkItems(const SDL_FRect& broad_phase_area);
 
+    /**
+     * @brief Remove an index from a result and shift the following ones, the object has been erased from the level.
+     * @param[out] indices The indices to update.
+     * @param position The position of the index to remove.
+     */
+    static void removeIndex(std::vector<size_t> &indices, size_t position);
+
 };
 
 
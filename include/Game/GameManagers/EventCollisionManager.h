@@ -13,6 +13,7 @@ private:
     /* ATTRIBUTES */
 
     Game *gamePtr; /**< A pointer to the game object. */
+    std::vector<size_t> candidates; /**< Indices of the collision zones near the current asteroid, reused between queries. */
 
 
 public:
@@ -0,0 +1,100 @@
+#ifndef PLAY_TOGETHER_LEVELPRELOADER_H
+#define PLAY_TOGETHER_LEVELPRELOADER_H
+
+#include <atomic>
+#include <thread>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "TextureManager.h"
+#include "../Game.h"
+
+/**
+ * @file LevelPreloader.h
+ * @brief Defines the LevelPreloader class responsible for preparing the images of the next level during the game.
+ */
+
+
+/**
+ * @class LevelPreloader
+ * @brief Decodes the images of a level on a worker thread, then uploads them to the renderer a few per frame.
+ *
+ * The worker reads the IDs of the map and decodes its middleground and, if the world changes, every world texture to
+ * surfaces. The game thread turns them into textures within a time budget per frame. Game::setLevel() then hands the
+ * images to the TextureManager, so that the switch itself only builds the level objects and packs the world atlas.
+ */
+class LevelPreloader {
+private:
+    /* ATTRIBUTES */
+
+    static constexpr double uploadBudgetSeconds = 0.002; /**< The longest time spent uploading images in a frame. */
+
+    Game *gamePtr; /**< A pointer to the game object. */
+    std::string mapName; /**< The name of the map being preloaded, empty if none. */
+    std::vector<std::pair<std::string, PreloadedImage>> images; /**< The images of the map, by file path, filled by the worker. */
+    size_t uploadedCount = 0; /**< The number of images already turned into textures. */
+    std::atomic<bool> decoded = false; /**< Set by the worker once every image is decoded. */
+    std::jthread worker; /**< The thread decoding the images. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit LevelPreloader(Game *game);
+    LevelPreloader(const LevelPreloader &) = delete;
+    LevelPreloader &operator=(const LevelPreloader &) = delete;
+    ~LevelPreloader();
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Check if the images of a map are decoded and uploaded.
+     * @param map_name The name of the map.
+     * @return True if the map can be switched to without reading any image, false otherwise.
+     */
+    [[nodiscard]] bool isReady(const std::string &map_name) const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Start preparing the images of a map in the background, nothing is done if it is already being prepared.
+     * @param map_name The name of the map.
+     */
+    void preload(const std::string &map_name);
+
+    /**
+     * @brief Upload the decoded images to the renderer until the time budget of the frame is spent.
+     * @param renderer The renderer of the game.
+     */
+    void update(SDL_Renderer *renderer);
+
+    /**
+     * @brief Hand the images of a map to the texture manager, waiting for the worker if it is not done yet.
+     * @param map_name The name of the map about to be loaded, the images of another map are discarded.
+     */
+    void finish(const std::string &map_name);
+
+    /**
+     * @brief Stop the worker and free the images not handed over.
+     */
+    void cancel();
+
+private:
+    /**
+     * @brief Read the IDs of a map and decode its images, run by the worker.
+     * @param stop_token Requested when the preloading is cancelled.
+     * @param map_name The name of the map.
+     * @param current_world_id The ID of the world whose textures are already loaded.
+     */
+    void decode(const std::stop_token &stop_token, const std::string &map_name, int current_world_id);
+
+    /**
+     * @brief Free the surfaces of the images.
+     * @param destroy_textures True to destroy the uploaded textures too, false when the renderer is already gone.
+     */
+    void release(bool destroy_textures);
+};
+
+#endif //PLAY_TOGETHER_LEVELPRELOADER_H
@@ -15,7 +15,7 @@
 //data necessary to bring back to the old state the player
 typedef struct {
     Item* item;
-    time_t t;
+    Uint32 t; /**< The simulated time the effect was applied, see SimulationClock::getTime(). */
 } GameData;
 
 class PlayerCollisionManager {
@@ -25,6 +25,7 @@ private:
     Game *gamePtr; /**< A pointer to the game object. */
     // Queue in order to keep track of the effects applied on the player
     std::queue<GameData*> timeQueue;
+    static constexpr Uint32 POWER_UP_DURATION = 4000; /**< The time a power-up lasts, in simulated milliseconds. */
 
 
 
@@ -0,0 +1,64 @@
+#ifndef PLAY_TOGETHER_PREDICTIONMANAGER_H
+#define PLAY_TOGETHER_PREDICTIONMANAGER_H
+
+#include <array>
+#include <cmath>
+#include "../Game.h"
+
+/**
+ * @file PredictionManager.h
+ * @brief Defines the PredictionManager class responsible for reconciling the predicted local player with the server.
+ */
+
+/**
+ * @struct PredictedState
+ * @brief Represents the position predicted for the local player at the end of a simulation tick.
+ */
+struct PredictedState {
+    uint32_t tick = 0; /**< The tick of the clock once the step is simulated, 0 for an empty entry. */
+    float x = 0; /**< The x-coordinate the player converges to, its position plus its pending buffer. */
+    float y = 0; /**< The y-coordinate the player converges to, its position plus its pending buffer. */
+};
+
+
+class PredictionManager {
+private:
+    /* ATTRIBUTES */
+
+    Game *gamePtr; /**< A pointer to the game object. */
+    static constexpr size_t historySize = 128; /**< Number of ticks kept, about two seconds, well above the round-trip time. */
+    static constexpr float correctionThreshold = 0.5f; /**< Smallest error corrected in pixels, below it the quantization noise is ignored. */
+    std::array<PredictedState, historySize> history; /**< The predicted states, at the index tick % historySize. */
+    uint32_t lastReconciledTick = 0; /**< The input tick of the last reconciliation, older states are already corrected. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit PredictionManager(Game *game);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Records the predicted state of the local player for the tick just simulated.
+     */
+    void recordTick();
+
+    /**
+     * @brief Reconciles the local player with its authoritative state sent by the server.
+     * @param player The local player.
+     * @param serverX The x-coordinate computed by the server.
+     * @param serverY The y-coordinate computed by the server.
+     * @param inputTick The tick of the last player update the server applied before computing this state.
+     * @return False if the predicted state of that tick is not recorded, true otherwise.
+     */
+    bool reconcile(Player &player, float serverX, float serverY, uint32_t inputTick);
+
+    /**
+     * @brief Forget the recorded states and the last reconciliation, called when the clock is moved to the server's.
+     */
+    void clear();
+};
+
+#endif //PLAY_TOGETHER_PREDICTIONMANAGER_H
@@ -3,6 +3,7 @@
 
 #include <SDL_render.h>
 #include "../Game.h"
+#include "../../Graphics/GlyphAtlas.h"
 
 /**
  * @file RenderManager.h
@@ -14,7 +15,9 @@ class RenderManager {
 private:
     SDL_Renderer *renderer; /**< The SDL_Renderer to render the game. */
     Game *gamePtr; /**< A pointer to the game object. */
+    TextureAtlas spriteAtlas; /**< The atlas of the players, asteroids and coins. */
     static std::vector<TTF_Font *> fonts; /**< A vector of TTF_Font objects for rendering text. */
+    static std::vector<std::unique_ptr<GlyphAtlas>> glyphAtlases; /**< The glyphs of each font, in the same order, used to draw text. */
 
     // Debug rendering attributes
     bool render_textures = true;
@@ -34,6 +37,7 @@ public:
     /* ACCESSORS */
     SDL_Renderer* getRenderer();
     static std::vector<TTF_Font *> &getFonts();
+    static std::vector<std::unique_ptr<GlyphAtlas>> &getGlyphAtlases();
 
     /* MUTATORS */
     void setRenderTextures(bool renderTextures);
@@ -53,8 +57,15 @@ public:
 
     /**
      * @brief Renderer the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw moving objects between their two last states.
      */
-    void render();
+    void render(float interpolation = 1.0f);
+
+private:
+    /**
+     * @brief Draw the time spent per frame in each zone of the game thread, averaged by the profiler.
+     */
+    void renderProfilerOverlay();
 
 };
 #endif //PLAY_TOGETHER_RENDERMANAGER_H
@@ -0,0 +1,168 @@
+#ifndef PLAY_TOGETHER_ROLLBACKMANAGER_H
+#define PLAY_TOGETHER_ROLLBACKMANAGER_H
+
+#include <array>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <unordered_map>
+#include "../Game.h"
+
+/**
+ * @file RollbackManager.h
+ * @brief Defines the RollbackManager class responsible for resimulating the game when inputs arrive late.
+ */
+
+/**
+ * @struct PlayerInput
+ * @brief Represents the keyboard state of a player during a simulation tick.
+ */
+struct PlayerInput {
+    int playerID; /**< The ID of the player. */
+    uint16_t keyboardStateMask; /**< The keyboard state of the player, see Mediator::encodeKeyboardStateMask(). */
+};
+
+/**
+ * @struct WorldState
+ * @brief Represents the state of the world at the start of a simulation tick and the inputs applied during that tick.
+ */
+struct WorldState {
+    Uint64 tick = 0; /**< The tick of the clock before the step is simulated, 0 for an empty entry. */
+    LevelState level; /**< The objects of the level changed by the simulation. */
+    CameraState camera; /**< The camera, its broad phase area decides which objects are simulated. */
+    std::vector<PlayerSimulationState> alivePlayers; /**< The state of the alive players. */
+    std::vector<PlayerSimulationState> neutralPlayers; /**< The state of the players between life and death. */
+    std::vector<PlayerSimulationState> deadPlayers; /**< The state of the dead players. */
+    std::vector<PlayerInput> inputs; /**< The keyboard state of every player during the tick, received or predicted. */
+    std::vector<Asteroid> spawnedAsteroids; /**< The asteroids received from the server during the tick, spawned again when it is resimulated. */
+};
+
+
+/**
+ * @class RollbackManager
+ * @brief Saves the world every tick and resimulates it when the input of a remote player arrives late.
+ *
+ * Every peer simulates every player. The input of a remote player is predicted to stay the same until its next update
+ * arrives, when that update is stamped with a past tick the world of that tick is restored and the ticks are simulated
+ * again up to the present. The world of the last historySize ticks is kept in preallocated entries, the connected clients
+ * start from the clock of the server so that the ticks stamped on the updates match.
+ */
+class RollbackManager {
+private:
+    /* ATTRIBUTES */
+
+    Game *gamePtr; /**< A pointer to the game object. */
+    static constexpr size_t historySize = 16; /**< Number of ticks kept, the latest input resimulated is historySize - 2 ticks old. */
+    std::array<WorldState, historySize> history; /**< The saved worlds, at the index tick % historySize. */
+    std::unordered_map<int, uint16_t> lastMasks; /**< The last keyboard state received for each remote player, used as prediction. */
+    std::unordered_map<int, Uint64> lastInputTicks; /**< The tick of the last update received for each remote player. */
+    std::vector<Player> movedPlayers; /**< The players taken out of their list while they are sorted back into their saved list. */
+    Uint64 rollbackTick = 0; /**< The oldest tick to resimulate from, 0 when no late input is pending. */
+    bool isResimulating = false; /**< Flag indicating if past ticks are being simulated again. */
+
+
+public:
+#ifdef ROLLBACK_NETCODE
+    static constexpr bool enabled = true; /**< Whether the players are synchronized by rollback instead of snapshots. */
+#else
+    static constexpr bool enabled = false; /**< Whether the players are synchronized by rollback instead of snapshots. */
+#endif
+
+
+    /* CONSTRUCTORS */
+
+    explicit RollbackManager(Game *game);
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the isResimulating attribute.
+     * @return True while past ticks are being simulated again, false otherwise.
+     */
+    [[nodiscard]] bool getIsResimulating() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Save the world and the inputs of the tick about to be simulated.
+     */
+    void saveTick();
+
+    /**
+     * @brief Record a keyboard state received from a remote player.
+     * @param playerID The ID of the player.
+     * @param keyboardStateMask The keyboard state of the player.
+     * @param tick The tick stamped on the update by the player.
+     * @return True if the input is late and will be applied by resimulate(), or overtaken and dropped, false if it must be applied now.
+     */
+    bool receiveInput(int playerID, uint16_t keyboardStateMask, Uint64 tick);
+
+    /**
+     * @brief Remember an asteroid received from the server during the tick being simulated.
+     * @param asteroid The asteroid, already added to the level.
+     */
+    void recordAsteroid(const Asteroid &asteroid);
+
+    /**
+     * @brief Restore the world of the oldest tick with a late input and simulate the ticks again up to the present.
+     */
+    void resimulate();
+
+    /**
+     * @brief Restore the world saved at the start of a tick, without simulating it.
+     * @param tick The tick.
+     * @return True if the tick was restored, false if it is not kept anymore.
+     */
+    bool restoreTick(Uint64 tick);
+
+    /**
+     * @brief Forget every saved tick and the last input of each player, called when the level or the players change.
+     */
+    void clear();
+
+
+private:
+    /**
+     * @brief Find the input of a player in a list of inputs.
+     * @param inputs The list of inputs.
+     * @param playerID The ID of the player.
+     * @return A pointer to the input, nullptr if the player is not in the list.
+     */
+    static PlayerInput *findInput(std::vector<PlayerInput> &inputs, int playerID);
+
+    /**
+     * @brief Save the level, the camera and the players, the buffers of the entry are reused.
+     * @param[out] state The entry to fill.
+     */
+    void saveWorld(WorldState &state);
+
+    /**
+     * @brief Restore the level, the camera and the players saved by saveWorld(), and find the objects on screen again.
+     * @param state The entry to restore.
+     */
+    void restoreWorld(const WorldState &state);
+
+    /**
+     * @brief Save the state of the players of a list, the buffer of the entry is reused.
+     * @param players The players.
+     * @param[out] states The state of each player.
+     */
+    static void savePlayers(const std::vector<Player> &players, std::vector<PlayerSimulationState> &states);
+
+    /**
+     * @brief Restore the players saved by saveWorld(), moving back to its saved list a player who died or respawned since.
+     * @param state The entry to restore.
+     */
+    void restorePlayers(const WorldState &state);
+
+    /**
+     * @brief Find a saved tick.
+     * @param tick The tick.
+     * @return A pointer to the saved world, nullptr if it is not kept anymore.
+     */
+    WorldState *findState(Uint64 tick);
+};
+
+#endif //PLAY_TOGETHER_ROLLBACKMANAGER_H
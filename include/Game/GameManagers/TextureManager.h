@@ -8,8 +8,10 @@
 #include <fstream>
 #include <filesystem>
 #include <format>
+#include <unordered_map>
 #include "../../../dependencies/json.hpp"
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/TextureAtlas.h"
 #include "../../../include/Game/Platforms/Treadmill.h"
 
 
@@ -18,6 +20,14 @@
  * @brief Defines the TextureManager class responsible for loading textures.
  */
 
+/**
+ * @struct PreloadedImage
+ * @brief Represents an image decoded and uploaded before the level using it is loaded.
+ */
+struct PreloadedImage {
+    SDL_Surface *surface = nullptr; /**< The pixels of the image, kept for the atlas. */
+    SDL_Texture *texture = nullptr; /**< The texture created from the pixels. */
+};
 
 
 class TextureManager {
@@ -30,6 +40,8 @@ private:
     std::vector<SDL_Texture*> backgrounds; /**< Collection of SDL_Texture representing the background textures. */
     SDL_Texture *middleground = nullptr; /**< SDL_Texture representing the middle ground texture. */
     std::vector<SDL_Texture*> foregrounds; /**< Collection of SDL_Texture representing the foreground textures. */
+    TextureAtlas worldAtlas; /**< The atlas of the platforms, treadmills, crushers and levers of the world. */
+    std::unordered_map<std::string, PreloadedImage> preloadedImages; /**< The images ready to be used, by file path. */
 
 
 
@@ -66,8 +78,49 @@ public:
      */
     void loadWorldTextures(SDL_Renderer *renderer, int world_id);
 
+    /**
+     * @brief Give the images of the next level, the loading functions use them instead of reading their files.
+     * @param images The images, by file path. The manager takes ownership of them.
+     */
+    void setPreloadedImages(std::unordered_map<std::string, PreloadedImage> &&images);
+
+    /**
+     * @brief Free the preloaded images the level did not use.
+     */
+    void clearPreloadedImages();
+
+    /**
+     * @brief Return the file path of the middleground texture of a level.
+     * @param level_id Represents the ID of the level.
+     * @return The path of the image.
+     */
+    [[nodiscard]] static std::string getMiddlegroundPath(int level_id);
+
+    /**
+     * @brief Return the file paths of every texture loaded by loadWorldTextures().
+     * @param world_id Represents the ID of the world.
+     * @return The paths of the images.
+     */
+    [[nodiscard]] static std::vector<std::string> getWorldImagePaths(int world_id);
+
 private:
 
+    /**
+     * @brief Load an image, from the preloaded images if it is one of them.
+     * @param renderer Represents the renderer of the game.
+     * @param file_path The path of the image.
+     * @param atlased True to add the image to the world atlas.
+     * @return The texture of the image, nullptr if it could not be loaded.
+     */
+    SDL_Texture *loadImage(SDL_Renderer &renderer, const std::string &file_path, bool atlased);
+
+    /**
+     * @brief Count the PNG images of a folder.
+     * @param folder_path The path of the folder.
+     * @return The number of images.
+     */
+    static int countImages(const std::string &folder_path);
+
     /**
      * @brief Load the textures of the platforms.
      * @param renderer Represents the renderer of the game.
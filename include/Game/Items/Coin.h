@@ -53,9 +53,10 @@ public:
     /**
      * @brief Load the coin texture.
      * @param renderer The renderer of the game.
+     * @param atlas The atlas the textures are packed into.
      * @return Returns true if the texture was loaded correctly, false otherwise.
      */
-    static bool loadTexture(SDL_Renderer &renderer);
+    static bool loadTexture(SDL_Renderer &renderer, TextureAtlas &atlas);
 
     /**
      * @brief Apply the item's effect to a player.
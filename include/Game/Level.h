@@ -6,9 +6,15 @@
 #include "../Graphics/Layer.h"
 #include "../Physics/Polygon.h"
 #include "../Physics/AABB.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Physics/Collision.h"
 #include "../Sounds/Music.h"
+#include "../Sounds/SoundBank.h"
 #include "Camera.h"
-#include "Events/Asteroid.h"
+#include "VisibleSet.h"
+#include "BodyStreams.h"
+#include "CompiledLevel.h"
+#include "Events/AsteroidPool.h"
 #include "Levers/Lever.h"
 #include "Platforms/MovingPlatform1D.h"
 #include "Platforms/MovingPlatform2D.h"
@@ -20,20 +26,75 @@
 #include "Items/SpeedPowerUp.h"
 #include "Items/Coin.h"
 #include "../Utils/Mediator.h"
+#include "../Utils/Profiler.h"
 #include "../../dependencies/json.hpp"
 #include "GameManagers/TextureManager.h"
 #include "Levers/TreadmillLever.h"
 #include "Levers/PlatformLever.h"
 #include "Levers/CrusherLever.h"
 
-// Define constants for directories and file names
-constexpr char MAPS_DIRECTORY[] = "assets/maps/";
-
 /**
  * @file Level.h
  * @brief Defines the Level class responsible for level object.
  */
 
+/**
+ * @brief Enumeration representing the collections of level objects indexed by a spatial grid.
+ *
+ * The platforms, treadmills and crushers move, they are scanned through their BodyStreams instead and their grids stay empty.
+ */
+enum class GridType {
+    COLLISION_ZONES,
+    DEATH_ZONES,
+    SAVE_ZONES,
+    RESCUE_ZONES,
+    TOGGLE_GRAVITY_ZONES,
+    INCREASE_FALL_SPEED_ZONES,
+    TREADMILL_LEVERS,
+    PLATFORM_LEVERS,
+    CRUSHER_LEVERS,
+    MOVING_PLATFORMS_1D,
+    MOVING_PLATFORMS_2D,
+    SWITCHING_PLATFORMS,
+    WEIGHT_PLATFORMS,
+    TREADMILLS,
+    CRUSHERS,
+    SIZE_POWER_UP,
+    SPEED_POWER_UP,
+    COINS,
+    ITEMS,
+    COUNT
+};
+
+/**
+ * @struct LevelState
+ * @brief Represents the part of a level changed by the simulation, saved and restored by the rollback.
+ *
+ * The vectors keep their capacity from one save to the next, saving into the same LevelState does not allocate once the
+ * collections stopped growing. The collectible items are only copied when their generation differs from the saved one.
+ */
+struct LevelState {
+    std::vector<AsteroidState> asteroids; /**< The state of each live asteroid. */
+    std::vector<bool> treadmillLevers; /**< The isActivated flag of each treadmill lever. */
+    std::vector<bool> platformLevers; /**< The isActivated flag of each platform lever. */
+    std::vector<bool> crusherLevers; /**< The isActivated flag of each crusher lever. */
+    std::vector<MovingPlatform1DState> movingPlatforms1D; /**< The state of each 1D moving platform. */
+    std::vector<MovingPlatform2DState> movingPlatforms2D; /**< The state of each 2D moving platform. */
+    std::vector<SwitchingPlatformState> switchingPlatforms; /**< The state of each switching platform. */
+    std::vector<WeightPlatformState> weightPlatforms; /**< The state of each weight platform. */
+    std::vector<TreadmillState> treadmills; /**< The state of each treadmill. */
+    std::vector<CrusherState> crushers; /**< The state of each crusher. */
+    std::array<std::vector<uint8_t>, static_cast<size_t>(GridType::COUNT)> bodyFlags; /**< The simulation flags of the streams, indexed by GridType. */
+    std::vector<SizePowerUp> sizePowerUp; /**< The size power-up not collected yet. */
+    std::vector<SpeedPowerUp> speedPowerUp; /**< The speed power-up not collected yet. */
+    std::vector<Coin> coins; /**< The coins not collected yet. */
+    std::vector<Item*> items; /**< The items not collected yet. */
+    Uint64 sizePowerUpGeneration = 0; /**< The generation of the saved size power-ups, 0 if none are saved. */
+    Uint64 speedPowerUpGeneration = 0; /**< The generation of the saved speed power-ups, 0 if none are saved. */
+    Uint64 coinsGeneration = 0; /**< The generation of the saved coins, 0 if none are saved. */
+    Uint64 itemsGeneration = 0; /**< The generation of the saved items, 0 if none are saved. */
+};
+
 /**
  * @class Level
  * @brief Represents the level object including obstacles.
@@ -47,6 +108,7 @@ private:
     int mapID = 0; /**< Represents the ID of the map. */
     short lastCheckpoint = 0; /**< Represents the last checkpoint reached by the player. */
     std::string mapName; /**< Represents the name of the map. */
+    std::string nextMapName; /**< Represents the name of the map following this one, empty for the last one. */
     std::vector<std::array<Point, 4>> spawnPoints; /**< Represents the spawn points of the map. */
     std::vector<Music> musics; /**< Represents the musics of the map. */
 
@@ -71,7 +133,7 @@ private:
 
 
     // EVENTS
-    std::vector<Asteroid> asteroids; /**< Collection of Asteroid representing asteroids. */
+    AsteroidPool asteroids; /**< Pool of Asteroid representing asteroids. */
 
     // LEVERS
     std::vector<TreadmillLever> treadmillLevers; /**< Collection of TreadmillLever representing treadmill levers. */
@@ -93,6 +155,15 @@ private:
     std::vector<SpeedPowerUp> speedPowerUp; /**< Collection of SpeedPowerUp representing speed power-up. */
     std::vector<Coin> coins; /**< Collection of Coin representing coins. */
     std::vector<Item*> items; /**< Collection of items. */
+    Uint64 lastItemsGeneration = 1; /**< The last generation given to a collection of items, a generation is never given twice. */
+    Uint64 sizePowerUpGeneration = 1; /**< Identifies the content of sizePowerUp, changed on every removal. */
+    Uint64 speedPowerUpGeneration = 1; /**< Identifies the content of speedPowerUp, changed on every removal. */
+    Uint64 coinsGeneration = 1; /**< Identifies the content of coins, changed on every removal. */
+    Uint64 itemsGeneration = 1; /**< Identifies the content of items, changed on every removal. */
+
+    // SPATIAL INDEX
+    std::array<SpatialGrid, static_cast<size_t>(GridType::COUNT)> grids; /**< Spatial grids indexing each collection of objects, indexed by GridType. */
+    std::array<BodyStreams, static_cast<size_t>(GridType::COUNT)> bodies; /**< Hot data of each collection of dynamic objects, indexed by GridType. */
 
 
 public:
@@ -122,6 +193,12 @@ public:
      */
     [[nodiscard]] std::string getMapName() const;
 
+    /**
+     * @brief Return the name of the map following this one.
+     * @return A string representing the name of the next map, empty if this is the last one.
+     */
+    [[nodiscard]] std::string getNextMapName() const;
+
     /**
      * @brief Return the spawn points of the map.
      * @return A vector of Point representing the spawn points of the map.
@@ -140,26 +217,26 @@ public:
      * @param type Represents the type of zone.
      * @return A vector of Polygon.
      */
-    [[nodiscard]] std::vector<Polygon> getZones(PolygonType type) const;
+    [[nodiscard]] const std::vector<Polygon>& getZones(PolygonType type) const;
 
     /**
      * @brief Return the zones of a specific type.
      * @param type Represents the type of zone.
      * @return A vector of AABB.
      */
-    [[nodiscard]] std::vector<AABB> getZones(AABBType type) const;
+    [[nodiscard]] const std::vector<AABB>& getZones(AABBType type) const;
 
     /**
      * @brief Return the asteroids attribute.
-     * @return A vector of Asteroid.
+     * @return A reference to the AsteroidPool holding the live asteroids, updated in place.
      */
-    [[nodiscard]] std::vector<Asteroid> getAsteroids() const;
+    [[nodiscard]] AsteroidPool& getAsteroids();
 
     /**
      * @brief Return the treadmillLevers attribute.
      * @return A vector of TreadmillLever.
      */
-    [[nodiscard]] std::vector<TreadmillLever> getTreadmillLevers() const;
+    [[nodiscard]] const std::vector<TreadmillLever>& getTreadmillLevers() const;
 
     /**
      * @brief Return the platformLevers attribute.
@@ -228,10 +305,10 @@ public:
     [[nodiscard]] std::vector<Coin>& getCoins();
 
     /**
-     * @brief Return an Item from the items attribute.
-     * @return An item.
+     * @brief Return the items attribute.
+     * @return A vector of Item pointers.
      */
-    [[nodiscard]] std::vector<Item*> getItems() const;
+    [[nodiscard]] const std::vector<Item*>& getItems() const;
 
     /**
      * @brief Return the last checkpoint reached by the player.
@@ -239,6 +316,20 @@ public:
      */
     [[nodiscard]] short getLastCheckpoint() const;
 
+    /**
+     * @brief Return the spatial grid indexing a collection of objects.
+     * @param type Represents the collection of objects, the grids of the moving collections are empty.
+     * @return A reference to the SpatialGrid, indices refer to the matching collection.
+     */
+    [[nodiscard]] SpatialGrid& getGrid(GridType type);
+
+    /**
+     * @brief Return the streams holding the position and flags of a collection of dynamic objects.
+     * @param type Represents the collection of objects, only the platforms and the crushers have streams.
+     * @return A reference to the BodyStreams, indices refer to the matching collection.
+     */
+    [[nodiscard]] BodyStreams& getBodies(GridType type);
+
 
     /* MUTATORS */
 
@@ -248,69 +339,81 @@ public:
      */
     void setLastCheckpoint(short checkpoint);
 
-    /**
-     * @brief Set the asteroids attribute.
-     * @param value Represents the asteroids attribute.
-     */
-    void setAsteroids(const std::vector<Asteroid> &value);
-
     /**
      * @brief Activate a lever from treadmillLevers.
-     * @param lever The lever to activate.
+     * @param index The index of the lever to activate.
      */
-    void activateTreadmillLever(const TreadmillLever &lever);
+    void activateTreadmillLever(size_t index);
 
     /**
      * @brief Activate a lever from platformLevers.
-     * @param lever The lever to activate.
+     * @param index The index of the lever to activate.
      */
-    void activatePlatformLever(const PlatformLever &lever);
+    void activatePlatformLever(size_t index);
 
     /**
      * @brief Activate a lever from crusherLevers.
-     * @param lever The lever to activate.
+     * @param index The index of the lever to activate.
      */
-    void activateCrusherLever(const CrusherLever &lever);
+    void activateCrusherLever(size_t index);
 
     /**
      * @brief Increase the weight of a platform in weightPlatforms attribute.
-     * @param platform The platform to increase the weight.
+     * @param index The index of the platform to increase the weight.
      */
-    void increaseWeightForPlatform(const WeightPlatform &platform);
+    void increaseWeightForPlatform(size_t index);
 
     /**
      * @brief Decrease the weight of a platform in weightPlatforms attribute.
-     * @param platform The platform to decrease the weight.
+     * @param index The index of the platform to decrease the weight.
      */
-    void decreaseWeightForPlatform(const WeightPlatform &platform);
+    void decreaseWeightForPlatform(size_t index);
 
     /**
      * @brief Remove an item from sizePowerUp attribute.
-     * @param item The item to remove.
+     * @param index The index of the item to remove.
      */
-    void removeItemFromSizePowerUp(SizePowerUp const &item);
+    void removeItemFromSizePowerUp(size_t index);
 
     /**
      * @brief Remove an item from speedPowerUp attribute.
-     * @param item The item to remove.
+     * @param index The index of the item to remove.
      */
-    void removeItemFromSpeedPowerUp(SpeedPowerUp const &item);
+    void removeItemFromSpeedPowerUp(size_t index);
 
     /**
      * @brief Remove an item from coins attribute.
-     * @param item The item to remove.
+     * @param index The index of the coin to remove.
      */
-    void removeItemFromCoins(Coin const &item);
+    void removeItemFromCoins(size_t index);
 
     /**
-     * @brief Remove an item.
-     * @param item The item to remove.
+     * @brief Remove an item from items attribute, the item itself stays allocated.
+     * @param index The index of the item to remove.
      */
-    void removeItem(Item const &item);
+    void removeItem(size_t index);
 
 
     /* PUBLIC METHODS */
 
+    /**
+     * @brief Collect the collision zones a box may hit while moving, for asteroids and projectiles.
+     * @param bounding_box The bounding box at the start of the move.
+     * @param move The displacement of the box, zero for a box standing still.
+     * @param[out] result Indices into getZones(PolygonType::COLLISION) of the zones whose bounding box is crossed, sorted in ascending order.
+     * @note Only the cells around the move are visited, an exact test against each polygon is still required.
+     */
+    void queryCollisionZones(const SDL_FRect &bounding_box, Point move, std::vector<size_t> &result);
+
+    /**
+     * @brief Collect the collision zones a segment may cross, for a ray or a fast projectile.
+     * @param start The start of the segment.
+     * @param end The end of the segment.
+     * @param[out] result Indices into getZones(PolygonType::COLLISION) of the zones whose bounding box is crossed, sorted in ascending order.
+     * @note Only the cells around the segment are visited, an exact test against each polygon is still required.
+     */
+    void queryCollisionZones(Point start, Point end, std::vector<size_t> &result);
+
     /**
      * @brief Applies the movement to all asteroid in the game.
      * @param delta_time The time elapsed since the last frame in seconds.
@@ -353,6 +456,25 @@ public:
      */
     void toggleCrushersMovement(bool state);
 
+    /**
+     * @brief Save the objects changed by the simulation, to restore them with restoreState().
+     * @param[out] state The state to fill, its buffers are reused.
+     */
+    void saveState(LevelState &state) const;
+
+    /**
+     * @brief Restore the objects changed by the simulation and the grids indexing them.
+     * @param state A state filled by saveState() since the level was loaded.
+     */
+    void restoreState(const LevelState &state);
+
+    /**
+     * @brief Restore the simulation flags of the moving objects, telling which of them are frozen off screen.
+     * @param state A state filled by saveState() since the level was loaded.
+     * @note Must be called after the broad phase found the objects on screen again, it changes these flags.
+     */
+    void restoreBodyFlags(const LevelState &state);
+
     /**
      * @brief Renders the background textures.
      * @param renderer Represents the renderer of the game.
@@ -378,78 +500,93 @@ public:
      * @brief Renders the collisions by drawing obstacles.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
      */
-    void renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderPolygonsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const;
 
     /**
      * @brief Renders asteroids by drawing sprites.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderAsteroids(SDL_Renderer *renderer, Point camera);
+    void renderAsteroids(SDL_Renderer *renderer, Point camera, float interpolation);
 
     /**
      * @brief Renders asteroids by drawing collisions boxes.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderAsteroidsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderAsteroidsDebug(SDL_Renderer *renderer, Point camera, float interpolation) const;
 
     /**
      * @brief Renders the levers by drawing textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
      */
-    void renderLevers(SDL_Renderer *renderer, Point camera) const;
+    void renderLevers(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const;
 
     /**
      * @brief Renders the levers by drawing collisions boxes.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
      */
-    void renderLeversDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderLeversDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const;
 
     /**
      * @brief Renders the platforms by drawing textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderPlatforms(SDL_Renderer *renderer, Point camera);
+    void renderPlatforms(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation);
 
     /**
      * @brief Renders the platforms by drawing collisions boxes.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderPlatformsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderPlatformsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const;
 
     /**
      * @brief Renders the crushers by drawing textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderTraps(SDL_Renderer *renderer, Point camera) const;
+    void renderTraps(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const;
 
     /**
      * @brief Renders the crushers by drawing collisions boxes.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to draw the moving objects between their two last positions.
      */
-    void renderTrapsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderTrapsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const;
 
     /**
      * @brief Renders the items by sprites.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
      */
-    void renderItems(SDL_Renderer *renderer, Point camera);
+    void renderItems(SDL_Renderer *renderer, Point camera, const VisibleSet &visible);
 
     /**
      * @brief Renders the items by drawing rectangles.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param visible The objects near the camera, only these are drawn.
      */
-    void renderItemsDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderItemsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const;
 
 
 private:
@@ -517,6 +654,29 @@ private:
      */
     void loadItemsFromMap(const std::string &map_file_name);
 
+    /**
+     * @brief Load the properties of the map from its compiled level.
+     * @param compiled The mapped compiled level.
+     */
+    void loadMapProperties(const CompiledLevel &compiled);
+
+    /**
+     * @brief Load the environment of the map from its compiled level.
+     * @param compiled The mapped compiled level.
+     */
+    void loadEnvironmentFromMap(const CompiledLevel &compiled);
+
+    /**
+     * @brief Load the zones, platforms, traps, levers and items of the map from its compiled level.
+     * @param compiled The mapped compiled level.
+     */
+    void loadObjectsFromMap(const CompiledLevel &compiled);
+
+    /**
+     * @brief Build the spatial grids and the streams of every collection and hide the objects until the broad phase finds them.
+     */
+    void buildGrids();
+
 
 };
 
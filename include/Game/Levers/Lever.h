@@ -3,6 +3,7 @@
 
 #include <SDL_rect.h>
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderQueue.h"
 #include "../../Sounds/SoundEffect.h"
 
 /**
@@ -5,6 +5,7 @@
 #include <SDL_ttf.h>
 #include <map>
 #include <thread>
+#include <atomic>
 #include <format>
 #include <regex>
 
@@ -42,7 +43,7 @@ private:
 
     SDL_Renderer *renderer; /**< SDL renderer for rendering graphics. */
     bool displayMenu = true; /**< Flag indicating whether the menu should be displayed. */
-    bool *quitPtr; /**< Pointer to a boolean controlling the game loop. */
+    std::atomic<bool> *quitPtr; /**< Pointer to a boolean controlling the game loop. */
     MenuAction currentMenuAction = MenuAction::MAIN; /**< Current menu action. */
     std::map<GameStateKey, std::vector<Button>> buttons; /**< Map storing buttons for different game states and menu actions. */
     Music music; /**< The music played when the menu is displayed. */
@@ -60,7 +61,7 @@ public:
      * @param quit A pointer to a boolean to control the game loop.
      * @param music_file_name Menu music file name.
      */
-    Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_name, MessageQueue *messageQueue);
+    Menu(SDL_Renderer *renderer, std::atomic<bool> *quit, const std::string& music_file_name, MessageQueue *messageQueue);
 
 
     /** ACCESSORS **/
@@ -8,6 +8,7 @@
 #include <cmath>
 #include "../Point.h"
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderQueue.h"
 
 /**
  * @file Platform.h
@@ -44,8 +45,8 @@ public:
 
     // METHODS
     virtual void applyMovement(double delta_time) = 0;
-    virtual void render(SDL_Renderer *renderer, Point camera) const = 0;
-    virtual void renderDebug(SDL_Renderer *renderer, Point camera) const = 0;
+    virtual void render(SDL_Renderer *renderer, Point camera, float interpolation) const = 0;
+    virtual void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const = 0;
 
 };
 
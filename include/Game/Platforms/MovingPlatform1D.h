@@ -13,6 +13,19 @@ constexpr float PLATFORM_LERP_SMOOTHING_FACTOR = 0.05F;
  * @brief Defines the MovingPlatform1D class representing a MovingPlatform on x-axis.
  */
 
+/**
+ * @struct MovingPlatform1DState
+ * @brief Represents the part of a platform changed by the simulation, saved and restored by the rollback.
+ */
+struct MovingPlatform1DState {
+    float x; /**< The x-coordinate of the platform. */
+    float y; /**< The y-coordinate of the platform. */
+    float move; /**< The number of pixel the platform has moved. */
+    PlatformBuffer buffer; /**< The pending correction of the platform. */
+    float direction; /**< The current direction of the platform. */
+    bool isMoving; /**< Flag indicating if the platform is moving. */
+};
+
 /**
  * @class MovingPlatform1D
  * @brief Represents a moving platform on an axis in a 2D game.
@@ -23,6 +36,8 @@ private:
 
     float x; /**< The x-coordinate of the platform's position. */
     float y; /**< The y-coordinate of the platform's position. */
+    float previousX = 0; /**< The x-coordinate of the platform's position at the end of the previous simulation step. */
+    float previousY = 0; /**< The y-coordinate of the platform's position at the end of the previous simulation step. */
     float w; /**< The width of the platform. (in pixels) */
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
@@ -104,6 +119,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const override;
 
+    /**
+     * @brief Return the state of the platform changed by the simulation.
+     * @return The MovingPlatform1DState of the platform.
+     */
+    [[nodiscard]] MovingPlatform1DState getState() const;
+
 
     /* MODIFIERS */
 
@@ -149,6 +170,12 @@ public:
      */
     void setIsOnScreen(bool state) override;
 
+    /**
+     * @brief Restore a state of the platform saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const MovingPlatform1DState &state);
+
 
     /* PUBLIC METHODS */
 
@@ -163,15 +190,17 @@ public:
      * @brief Renders the platforms by drawing its textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
 
 private:
@@ -11,6 +11,21 @@
  * @brief Defines the MovingPlatform2D class representing a moving platform on x-axis and y-axis.
  */
 
+/**
+ * @struct MovingPlatform2DState
+ * @brief Represents the part of a platform changed by the simulation, saved and restored by the rollback.
+ */
+struct MovingPlatform2DState {
+    float x; /**< The x-coordinate of the platform. */
+    float y; /**< The y-coordinate of the platform. */
+    float moveX; /**< The number of pixel the platform has moved on the x-axis. */
+    float moveY; /**< The number of pixel the platform has moved on the y-axis. */
+    PlatformBuffer buffer; /**< The pending correction of the platform. */
+    float directionX; /**< The current direction of the platform on the x-axis. */
+    float directionY; /**< The current direction of the platform on the y-axis. */
+    bool isMoving; /**< Flag indicating if the platform is moving. */
+};
+
 /**
  * @class MovingPlatform2D
  * @brief Represents a moving platform on two axis in a 2D game.
@@ -21,6 +36,8 @@ private:
 
     float x; /**< The x-coordinate of the platform's position. */
     float y; /**< The y-coordinate of the platform's position. */
+    float previousX = 0; /**< The x-coordinate of the platform's position at the end of the previous simulation step. */
+    float previousY = 0; /**< The y-coordinate of the platform's position at the end of the previous simulation step. */
     float w; /**< The width of the platform. (in pixels) */
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
@@ -112,6 +129,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const override;
 
+    /**
+     * @brief Return the state of the platform changed by the simulation.
+     * @return The MovingPlatform2DState of the platform.
+     */
+    [[nodiscard]] MovingPlatform2DState getState() const;
+
 
     /* MODIFIERS */
 
@@ -169,6 +192,12 @@ public:
      */
     void setIsOnScreen(bool state) override;
 
+    /**
+     * @brief Restore a state of the platform saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const MovingPlatform2DState &state);
+
 
     /* PUBLIC METHODS */
 
@@ -182,15 +211,17 @@ public:
      * @brief Renders the platforms by drawing its textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
 };
 
@@ -6,12 +6,25 @@
 #include <ranges>
 #include <vector>
 #include "IPlatform.h"
+#include "../../Utils/SimulationClock.h"
 
 /**
  * @file SwitchingPlatform.h
  * @brief Defines the SwitchingPlatform class representing a switching platform.
  */
 
+/**
+ * @struct SwitchingPlatformState
+ * @brief Represents the part of a platform changed by the simulation, saved and restored by the rollback.
+ */
+struct SwitchingPlatformState {
+    float x; /**< The x-coordinate of the platform. */
+    float y; /**< The y-coordinate of the platform. */
+    Uint32 startTime; /**< The time set at the beginning of the current beat. */
+    int actualPoint; /**< The index of the current step of the platform. */
+    bool isMoving; /**< Flag indicating if the platform is moving. */
+};
+
 /**
  * @class SwitchingPlatform
  * @brief Represents a switching platform in a 2D game.
@@ -26,7 +39,7 @@ private:
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
     double bpm; /**< The beat per minute of the platform. */
-    Uint32 startTime = SDL_GetTicks(); /**< The time set at the beginning of every beat */
+    Uint32 startTime = SimulationClock::getTime(); /**< The time set at the beginning of every beat */
     int actualPoint = 0; /**< The current point the platform's position. */
     std::vector<Point> steps; /** Collection of Point representing every possible position of the platform. */
     bool isMoving = true; /** Flag indicating if the platform is currently moving. */
@@ -80,6 +93,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const override;
 
+    /**
+     * @brief Return the state of the platform changed by the simulation.
+     * @return The SwitchingPlatformState of the platform.
+     */
+    [[nodiscard]] SwitchingPlatformState getState() const;
+
 
     /* MODIFIERS */
 
@@ -95,6 +114,12 @@ public:
      */
     void setIsOnScreen(bool state) override;
 
+    /**
+     * @brief Restore a state of the platform saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const SwitchingPlatformState &state);
+
 
     /* PUBLIC METHODS */
 
@@ -107,15 +132,17 @@ public:
      * @brief Renders the platforms by drawing its textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation Unused, the platform jumps from a step to the next one.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation Unused, the platform jumps from a step to the next one.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
 };
 
@@ -10,6 +10,16 @@
  * @brief Defines the Treadmill class representing a treadmill on x-axis.
  */
 
+/**
+ * @struct TreadmillState
+ * @brief Represents the part of a treadmill changed by the simulation, saved and restored by the rollback.
+ */
+struct TreadmillState {
+    float direction; /**< The current direction of the treadmill. */
+    float move; /**< The distance the players on the treadmill move. */
+    bool isMoving; /**< Flag indicating if the treadmill is moving. */
+};
+
 /**
  * @class Treadmill
  * @brief Represents a treadmill on an axis in a 2D game.
@@ -103,6 +113,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const;
 
+    /**
+     * @brief Return the state of the treadmill changed by the simulation.
+     * @return The TreadmillState of the treadmill.
+     */
+    [[nodiscard]] TreadmillState getState() const;
+
 
     /* MODIFIERS */
 
@@ -124,6 +140,12 @@ public:
      */
     void setIsOnScreen(bool state);
 
+    /**
+     * @brief Restore a state of the treadmill saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const TreadmillState &state);
+
     /**
      * @brief Set the texture of the treadmill.
      * @param texturePtr The new texture of the treadmill.
@@ -8,6 +8,17 @@
  * @brief Defines the WeightPlatform class representing a weight platform.
  */
 
+/**
+ * @struct WeightPlatformState
+ * @brief Represents the part of a platform changed by the simulation, saved and restored by the rollback.
+ */
+struct WeightPlatformState {
+    float y; /**< The y-coordinate of the platform. */
+    float move; /**< The number of pixel the platform has moved. */
+    float weight; /**< The number of players on the platform. */
+    bool isMoving; /**< Flag indicating if the platform is moving. */
+};
+
 /**
  * @class WeightPlatform
  * @brief Represents a weight platform in a 2D game.
@@ -19,6 +30,7 @@ private:
     float startY; /**< The y-coordinate of the platform's starting position. */
     float x; /**< The x-coordinate of the platform's position. */
     float y = startY; /**< The y-coordinate of the platform's position. */
+    float previousY = startY; /**< The y-coordinate of the platform's position at the end of the previous simulation step. */
     float w; /**< The width of the platform. (in pixels) */
     float h; /**< The height of the platform. */
     float size; /**< The size of the platform. */
@@ -89,6 +101,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const override;
 
+    /**
+     * @brief Return the state of the platform changed by the simulation.
+     * @return The WeightPlatformState of the platform.
+     */
+    [[nodiscard]] WeightPlatformState getState() const;
+
 
     /* MODIFIERS */
 
@@ -104,6 +122,12 @@ public:
      */
     void setIsOnScreen(bool state) override;
 
+    /**
+     * @brief Restore a state of the platform saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const WeightPlatformState &state);
+
     /**
      * @brief Increase the weight of the platform by 1.
      */
@@ -126,15 +150,17 @@ public:
      * @brief Renders the platforms by drawing its textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera) const override;
+    void render(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 
     /**
      * @brief Renders the platforms by its drawing its collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the platform between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const override;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const override;
 };
 
 
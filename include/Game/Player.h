@@ -5,10 +5,13 @@
 #include <SDL_image.h>
 #include <map>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include "Point.h"
 #include "../Graphics/Animation.h"
 #include "../Graphics/Sprite.h"
+#include "../Graphics/TextureAtlas.h"
+#include "../Utils/SimulationClock.h"
 
 /**
  * @file Player.h
@@ -20,6 +23,62 @@ struct Buffer {
     float deltaY;
 };
 
+/**
+ * @struct PlayerSimulationState
+ * @brief Represents the part of a player changed by the simulation, saved and restored by the rollback.
+ */
+struct PlayerSimulationState {
+    int playerID; /**< The ID of the player. */
+    float x; /**< The x-coordinate of the player's position. */
+    float y; /**< The y-coordinate of the player's position. */
+    float previousX; /**< The x-coordinate of the player's position at the end of the previous simulation step. */
+    float previousY; /**< The y-coordinate of the player's position at the end of the previous simulation step. */
+    float width; /**< The width of the player. */
+    float height; /**< The height of the player. */
+    float size; /**< The size of the player. */
+    bool isAlive; /**< Flag indicating whether the player is alive. */
+    Buffer buffer; /**< The buffer of the player. */
+    int score; /**< The score of the player. */
+    int deathCount; /**< The death count of the player. */
+    SpriteState sprite; /**< The animation of the player's sprite. */
+    float moveX; /**< Player movement on x-axis during 'this' frame. */
+    bool wantToMoveRight; /**< If the player pressed a key to move right. */
+    bool wantToMoveLeft; /**< If the player pressed a key to move left. */
+    float directionX; /**< The current direction of the player. */
+    float previousDirectionX; /**< The direction of the player on the x-axis during the previous frame. */
+    bool canMove; /**< If the player can move. */
+    float speed; /**< The speed of the player. */
+    float speedCurveX; /**< The speed curve attribute that is multiplied to player's x-axis movement. */
+    float sprintMultiplier; /**< The factor to adjust the player's speed when sprinting. */
+    float moveY; /**< Vertical movement of the player during this frame. */
+    float mavity; /**< Gravity acceleration. */
+    bool wantToJump; /**< Flag indicating whether the player has requested to jump. */
+    bool jumpLock; /**< Flag indicating whether the player has already jumped. */
+    float directionY; /**< Current vertical direction of the player. */
+    bool isGrounded; /**< Flag indicating whether the player is currently on a ground. */
+    bool isJumping; /**< Flag indicating whether the player is currently in a jump. */
+    Uint32 lastTimeOnPlatform; /**< Timestamp of the last time the player was on a platform. */
+    float jumpMaxHeight; /**< Maximum height of the player's jump. */
+    float maxFallSpeed; /**< Maximum falling speed of the player. */
+    float jumpStartHeight; /**< Current height of the player's jump. */
+    float jumpVelocity; /**< Current velocity of the player's jump. */
+    size_t currentZoneID; /**< The ID of the current zone the player is in. */
+    bool isOnPlatform; /**< Flag indicating whether the player is currently on a weight platform. */
+    bool wasOnPlatform; /**< Flag indicating whether the player was on a weight platform during the last frame. */
+    bool isHitting; /**< Flag indicating whether the player is currently hitting. */
+    bool hitLock; /**< Flag indicating whether the player has already hit. */
+    int hitTimer; /**< The timer of the hit action. */
+    Uint32 lastHitTimeUpdate; /**< The last time the player hit. */
+    SDL_FRect hitZone; /**< The hit zone of the player. */
+    bool leftCollider; /**< Flag indicating whether the player's left collider is active. */
+    bool rightCollider; /**< Flag indicating whether the player's right collider is active. */
+    bool groundCollider; /**< Flag indicating whether the player's ground collider is active. */
+    bool roofCollider; /**< Flag indicating whether the player's roof collider is active. */
+    bool eggLock; /**< Flag indicating whether the player had already moved. */
+    bool lastAnimationIsRunType; /**< Flag indicating whether the last animation was a run animation. */
+    SDL_FRect textureOffsets; /**< The offsets of the player's sprite. */
+};
+
 /**
  * @class Player
  * @brief Represents a player in a 2D game with position, speed, and dimensions.
@@ -34,6 +93,8 @@ private:
     // CHARACTERISTIC ATTRIBUTES
     float x; /**< The x-coordinate of the player's position. (in pixels) */
     float y; /**< The y-coordinate of the player's position. */
+    float previousX; /**< The x-coordinate of the player's position at the end of the previous simulation step. */
+    float previousY; /**< The y-coordinate of the player's position at the end of the previous simulation step. */
     float width; /**< The width of the player. (in pixels) */
     float height; /**< The height of the player. */
     float size = 2; /**< The size of the player. */
@@ -72,7 +133,7 @@ private:
     float directionY = 0; /**< Current vertical direction of the player (-1 for up, 1 for down, 0 for no movement). */
     bool isGrounded = false; /**< Flag indicating whether the player is currently on a ground. */
     bool isJumping = false; /**< Flag indicating whether the player is currently in a jump. */
-    Uint32 lastTimeOnPlatform = SDL_GetTicks(); /**< Timestamp of the last time the player was on a platform. */
+    Uint32 lastTimeOnPlatform = SimulationClock::getTime(); /**< Timestamp of the last time the player was on a platform. */
     float jumpInitialVelocity = 525.f; /**< Initial velocity of the player's jump. */
     float jumpMaxHeight = 100.f; /**< Maximum height of the player's jump. */
     float maxFallSpeed = 600.f; /**< Maximum falling speed of the player. */
@@ -236,6 +297,12 @@ public:
      */
     [[nodiscard]] float getMoveY() const;
 
+    /**
+     * @brief Return the buffer attribute.
+     * @return The position correction not applied yet.
+     */
+    [[nodiscard]] Buffer getBuffer() const;
+
     /**
      * @brief Return the currentDirection attribute.
      * @return The value of the currentDirection attribute (-1 for left, 1 for right)
@@ -400,6 +467,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBoxNextFrame() const;
 
+    /**
+     * @brief Return the state of the player changed by the simulation.
+     * @return The PlayerSimulationState of the player.
+     */
+    [[nodiscard]] PlayerSimulationState getState() const;
+
     // Equality operator for comparing two players
     bool operator==(const Player &other) const {
         return (playerID == other.playerID);
@@ -595,6 +668,12 @@ public:
      */
     void setMedalTexture(SDL_Texture* newTexture);
 
+    /**
+     * @brief Restore a state of the player saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const PlayerSimulationState &state);
+
 
     /* PUBLIC METHODS */
 
@@ -611,9 +690,10 @@ public:
     /**
      * @brief Load all players textures.
      * @param renderer The renderer of the game.
+     * @param atlas The atlas the textures are packed into.
      * @return Returns true if all textures were loaded correctly, false otherwise.
      */
-    static bool loadTextures(SDL_Renderer &renderer);
+    static bool loadTextures(SDL_Renderer &renderer, TextureAtlas &atlas);
 
     /**
      * @brief Assign a texture to a player's sprite according to the id.
@@ -703,15 +783,17 @@ public:
      * @brief Renders the player's sprite.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the player between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera);
+    void render(SDL_Renderer *renderer, Point camera, float interpolation = 1.0f);
 
     /**
      * @brief Renders the player's box, used for debugging.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the player between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation = 1.0f) const;
 
     /**
      * @brief Renders the player's colliders, used for debugging.
@@ -725,6 +807,12 @@ private:
 
     /* PRIVATE METHODS */
 
+    /**
+     * @brief Scale the hit zone and the sprite offsets to the size attribute.
+     * @see setSize() for main use.
+     */
+    void applySize();
+
     /**
      * @brief Gets the vertices of the player's left collider.
      * @return A vector of Point representing the vertices.
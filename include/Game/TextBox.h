@@ -26,8 +26,7 @@ private:
     std::string placeholder;
     bool active = false;
     int margin = 10;
-    std::vector<TTF_Font *> fonts;
-    TTF_Font *font = nullptr;
+    GlyphAtlas *textAtlas = nullptr;
     SDL_Color textColor = {0, 0, 0, 255};
     SDL_Color backgroundColor  = {125, 125, 125, 125};
     cursor cursorPosition = {0,0};
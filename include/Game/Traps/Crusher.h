@@ -3,20 +3,38 @@
 
 #include <cmath>
 #include "../../Graphics/Texture.h"
+#include "../../Graphics/RenderQueue.h"
 #include "../Point.h"
 #include "../../Sounds/SoundEffect.h"
+#include "../../Utils/SimulationClock.h"
 
 struct CrusherBuffer {
     float deltaX;
     float deltaY;
 };
 
+/**
+ * @struct CrusherState
+ * @brief Represents the part of a crusher changed by the simulation, saved and restored by the rollback.
+ */
+struct CrusherState {
+    float x; /**< The x-coordinate of the crusher. */
+    float y; /**< The y-coordinate of the crusher. */
+    float direction; /**< The direction of the crusher. */
+    bool isCrushing; /**< Flag indicating if the crusher is crushing. */
+    bool isMoving; /**< Flag indicating if the crusher is moving. */
+    CrusherBuffer buffer; /**< The pending correction of the crusher. */
+    int timer; /**< The timer of the crusher. */
+    Uint32 lastUpdate; /**< The last time the crusher was updated. */
+};
+
 class Crusher {
 private:
 
     // CHARACTERISTICS ATTRIBUTES
     float x; /**< The x-coordinate of the crusher's position. */
     float y; /**< The y-coordinate of the crusher's position. */
+    float previousY; /**< The y-coordinate of the crusher's position at the end of the previous simulation step. */
     float w; /**< The width of the crusher. (in pixels) */
     float h; /**< The height of the crusher. */
     float size; /**< The size of the crusher. */
@@ -31,7 +49,7 @@ private:
 
     // TIME ATTRIBUTES
     int timer = 0; /**< The timer of the crusher. */
-    Uint32 lastUpdate = SDL_GetTicks(); /**< The last time the crusher was updated. */
+    Uint32 lastUpdate = SimulationClock::getTime(); /**< The last time the crusher was updated. */
     const Uint32 moveUpTime; /**< The time the crusher will take to move up in seconds. */
     const Uint32 waitUpTime; /**< The time to wait up before going down in milliseconds. */
     const Uint32 waitDownTime; /**< The time to wait down before going up in milliseconds. */
@@ -104,6 +122,12 @@ public:
      */
     [[nodiscard]] SDL_FRect getBoundingBox() const;
 
+    /**
+     * @brief Return the state of the crusher changed by the simulation.
+     * @return The CrusherState of the crusher.
+     */
+    [[nodiscard]] CrusherState getState() const;
+
     /**
      * @brief Get the bounding box of the crusher's crushing zone.
      * @return SDL_Rect representing the crusher's crushing zone box.
@@ -149,6 +173,12 @@ public:
      */
     void setIsOnScreen(bool state);
 
+    /**
+     * @brief Restore a state of the crusher saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const CrusherState &state);
+
 
     /* METHODS */
 
@@ -164,15 +194,17 @@ public:
      * @brief Renders the crusher by drawing its textures.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the crusher between its two last positions.
      */
-    void render(SDL_Renderer *renderer, Point camera) const;
+    void render(SDL_Renderer *renderer, Point camera, float interpolation) const;
 
     /**
      * @brief Renders the crusher by its drawing its collision box.
      * @param renderer Represents the renderer of the game.
      * @param camera Represents the camera of the game.
+     * @param interpolation The fraction of simulation step elapsed since the last update, used to place the crusher between its two last positions.
      */
-    void renderDebug(SDL_Renderer *renderer, Point camera) const;
+    void renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const;
 
 
 private:
@@ -0,0 +1,62 @@
+#ifndef PLAY_TOGETHER_VISIBLESET_H
+#define PLAY_TOGETHER_VISIBLESET_H
+
+#include <vector>
+
+/**
+ * @file VisibleSet.h
+ * @brief Defines the VisibleSet structure holding the level objects found around the camera.
+ */
+
+/**
+ * @struct VisibleSet
+ * @brief Represents the level objects overlapping the broad phase area of the camera, for one step.
+ *
+ * Filled once per step by the broad phase, then read by both the collision managers and the rendering, so that the
+ * objects far from the camera are neither tested nor drawn. Every list holds indices, sorted in ascending order, into
+ * the matching Level collection.
+ */
+struct VisibleSet {
+    // ZONES
+    std::vector<size_t> saveZones; /**< Indices of the save zones of the level near the camera. */
+    std::vector<size_t> rescueZones; /**< Indices of the rescue zones of the level near the camera. */
+    std::vector<size_t> deathZones; /**< Indices of the death zones of the level near the camera. */
+    std::vector<size_t> obstacles; /**< Indices of the collision zones of the level near the camera. */
+    std::vector<size_t> toggleGravityZones; /**< Indices of the toggle gravity zones of the level near the camera. */
+    std::vector<size_t> increaseFallSpeedZones; /**< Indices of the increase fall speed zones of the level near the camera. */
+
+    // LEVERS
+    std::vector<size_t> treadmillLevers; /**< Indices of the treadmill levers of the level near the camera. */
+    std::vector<size_t> platformLevers; /**< Indices of the platform levers of the level near the camera. */
+    std::vector<size_t> crusherLevers; /**< Indices of the crusher levers of the level near the camera. */
+
+    // PLATFORMS
+    std::vector<size_t> movingPlatforms1D; /**< Indices of the 1D platforms of the level near the camera. */
+    std::vector<size_t> movingPlatforms2D; /**< Indices of the 2D platforms of the level near the camera. */
+    std::vector<size_t> switchingPlatforms; /**< Indices of the switching platforms of the level near the camera. */
+    std::vector<size_t> weightPlatforms; /**< Indices of the weight platforms of the level near the camera. */
+    std::vector<size_t> treadmills; /**< Indices of the treadmills of the level near the camera. */
+
+    // TRAPS
+    std::vector<size_t> crushers; /**< Indices of the crushers of the level near the camera. */
+
+    // ITEMS
+    std::vector<size_t> sizePowerUp; /**< Indices of the size power-up of the level near the camera. */
+    std::vector<size_t> speedPowerUp; /**< Indices of the speed power-up of the level near the camera. */
+    std::vector<size_t> coins; /**< Indices of the coins of the level near the camera. */
+    std::vector<size_t> items; /**< Indices of the items of the level near the camera. */
+
+    /**
+     * @brief Empty every list, the indices no longer match the level.
+     */
+    void clear() {
+        for (std::vector<size_t> *list : {&saveZones, &rescueZones, &deathZones, &obstacles, &toggleGravityZones,
+                                          &increaseFallSpeedZones, &treadmillLevers, &platformLevers, &crusherLevers,
+                                          &movingPlatforms1D, &movingPlatforms2D, &switchingPlatforms, &weightPlatforms,
+                                          &treadmills, &crushers, &sizePowerUp, &speedPowerUp, &coins, &items}) {
+            list->clear();
+        }
+    }
+};
+
+#endif //PLAY_TOGETHER_VISIBLESET_H
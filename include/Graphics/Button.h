@@ -2,11 +2,11 @@
 #define PLAY_TOGETHER_BUTTON_H
 
 #include <SDL.h>
-#include <SDL_ttf.h>
 #include <string>
 #include <utility>
 #include "../../dependencies/SDL2_gfx/SDL2_gfxPrimitives.h"
 #include "../Sounds/SoundEffect.h"
+#include "GlyphAtlas.h"
 
 /**
  * @brief A struct representing the position of a button.
@@ -39,7 +39,7 @@ enum class ButtonAction {
 class Button {
 private:
     SDL_Renderer *renderer;
-    TTF_Font *font;
+    GlyphAtlas *textAtlas;
     std::string buttonText;
     ButtonPosition position;
     int value;
@@ -57,7 +57,7 @@ public:
     /**
      * @brief Constructor for the Button class.
      * @param renderer The SDL_Renderer to render the button.
-     * @param font The TTF_Font to render the text on the button.
+     * @param textAtlas The GlyphAtlas to render the text on the button.
      * @param position The position of the button.
      * @param value The value associated with the button.
      * @param buttonText The text to be displayed on the button.
@@ -66,13 +66,13 @@ public:
      * @param hoverColor The color of the button when hovered.
      * @param textColor The color of the text on the button.
      */
-    Button(SDL_Renderer *renderer, TTF_Font *font, ButtonPosition position, int value, std::string buttonText,
+    Button(SDL_Renderer *renderer, GlyphAtlas *textAtlas, ButtonPosition position, int value, std::string buttonText,
            ButtonAction buttonAction, SDL_Color normalColor, SDL_Color hoverColor, SDL_Color textColor);
 
     /**
      * @brief Constructor for the Button class with border radius.
      * @param renderer The SDL_Renderer to render the button.
-     * @param font The TTF_Font to render the text on the button.
+     * @param textAtlas The GlyphAtlas to render the text on the button.
      * @param value The value associated with the button.
      * @param position The position of the button.
      * @param buttonText The text to be displayed on the button.
@@ -82,7 +82,7 @@ public:
      * @param textColor The color of the text on the button.
      * @param borderRadius The border radius of the button.
      */
-    Button(SDL_Renderer *renderer, TTF_Font *font, ButtonPosition position, int value, std::string buttonText,
+    Button(SDL_Renderer *renderer, GlyphAtlas *textAtlas, ButtonPosition position, int value, std::string buttonText,
            ButtonAction buttonAction, SDL_Color normalColor, SDL_Color hoverColor, SDL_Color textColor, short borderRadius);
 
 
@@ -0,0 +1,131 @@
+#ifndef PLAY_TOGETHER_GLYPHATLAS_H
+#define PLAY_TOGETHER_GLYPHATLAS_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <unordered_map>
+
+
+constexpr char FONT_FILE[] = "assets/font/arial.ttf";
+
+/**
+ * @file GlyphAtlas.h
+ * @brief Defines the GlyphAtlas class drawing text from glyphs rasterized once into a texture.
+ */
+
+/**
+ * @struct AtlasGlyph
+ * @brief Represents a glyph rasterized in the atlas.
+ */
+struct AtlasGlyph {
+    SDL_Rect source = {0, 0, 0, 0}; /**< The area of the glyph in the atlas texture, empty if the font does not provide it. */
+    int advance = 0; /**< The horizontal distance to the next glyph. */
+};
+
+/**
+ * @struct GlyphQuad
+ * @brief Represents a glyph placed in a shaped text run.
+ */
+struct GlyphQuad {
+    SDL_Rect source; /**< The area of the glyph in the atlas texture. */
+    SDL_Rect destination; /**< The area of the glyph relative to the top left corner of the text. */
+};
+
+/**
+ * @struct TextRun
+ * @brief Represents a shaped string, the glyphs placed with their advance and kerning.
+ */
+struct TextRun {
+    std::vector<GlyphQuad> quads; /**< The glyphs of the string, in order. */
+    int width = 0; /**< The width of the text. */
+    int height = 0; /**< The height of the text, the height of the font. */
+};
+
+
+/**
+ * @class GlyphAtlas
+ * @brief Rasterizes the Latin-1 glyphs of a font once into a texture and draws strings as one batch of textured quads.
+ *
+ * The shaped strings are cached so that drawing the same text again only fills the vertex buffer. The characters missing
+ * from the atlas are drawn as a question mark.
+ */
+class GlyphAtlas {
+private:
+    /* ATTRIBUTES */
+
+    static constexpr Uint32 firstCodepoint = 32; /**< The first character rasterized, the space. */
+    static constexpr Uint32 lastCodepoint = 255; /**< The last character rasterized, the end of Latin-1. */
+    static constexpr Uint32 fallbackCodepoint = '?'; /**< The character drawn in place of the missing ones. */
+    static constexpr int atlasWidth = 512; /**< The width of the atlas texture. */
+    static constexpr size_t maxCachedRuns = 256; /**< The number of shaped strings kept before the cache is emptied. */
+
+    TTF_Font *font; /**< The font the glyphs are rasterized from. */
+    SDL_Texture *texture = nullptr; /**< The atlas texture holding every glyph in white. */
+    int atlasHeight = 0; /**< The height of the atlas texture. */
+    int fontHeight = 0; /**< The height of a line of text. */
+    std::array<AtlasGlyph, lastCodepoint - firstCodepoint + 1> glyphs; /**< The glyphs, indexed by codepoint - firstCodepoint. */
+    std::unordered_map<std::string, TextRun> runs; /**< The shaped strings, by text. */
+    std::vector<SDL_Vertex> vertices; /**< The vertex buffer reused by each draw. */
+    std::vector<int> indices; /**< The index buffer reused by each draw. */
+
+public:
+    /* CONSTRUCTORS */
+
+    GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font);
+    GlyphAtlas(const GlyphAtlas &) = delete;
+    GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+    ~GlyphAtlas();
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the font attribute.
+     * @return A pointer to the font the glyphs are rasterized from.
+     */
+    [[nodiscard]] TTF_Font *getFont() const;
+
+    /**
+     * @brief Return the size of a text once drawn.
+     * @param text The text, encoded in UTF-8.
+     * @return The width and the height of the text.
+     */
+    [[nodiscard]] SDL_Point getTextSize(const std::string &text);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Draw a text in a single geometry call.
+     * @param renderer The renderer of the atlas texture.
+     * @param text The text, encoded in UTF-8.
+     * @param x The x-coordinate of the top left corner of the text.
+     * @param y The y-coordinate of the top left corner of the text.
+     * @param color The color of the text, its alpha included.
+     */
+    void render(SDL_Renderer *renderer, const std::string &text, int x, int y, SDL_Color color);
+
+private:
+    /**
+     * @brief Return the shaped string of a text, shaping it on the first request.
+     * @param text The text, encoded in UTF-8.
+     * @return The shaped string, valid until the next call.
+     */
+    const TextRun &shape(const std::string &text);
+
+    /**
+     * @brief Decode the next character of a UTF-8 string.
+     * @param text The text.
+     * @param[in,out] index The position of the character, moved to the next one.
+     * @return The codepoint of the character, fallbackCodepoint if the sequence is invalid.
+     */
+    static Uint32 decodeUtf8(const std::string &text, size_t &index);
+};
+
+
+#endif //PLAY_TOGETHER_GLYPHATLAS_H
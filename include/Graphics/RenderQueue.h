@@ -0,0 +1,116 @@
+#ifndef PLAY_TOGETHER_RENDERQUEUE_H
+#define PLAY_TOGETHER_RENDERQUEUE_H
+
+#include <SDL.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include "../Utils/Profiler.h"
+
+/**
+ * @file RenderQueue.h
+ * @brief Defines the RenderQueue class responsible for drawing the sprites of a frame in batches.
+ */
+
+/**
+ * @enum RenderLayer
+ * @brief The layers of the sprites, drawn in this order.
+ */
+enum class RenderLayer {
+    ITEMS,
+    LEVERS,
+    PLAYERS,
+    ASTEROIDS,
+    PLATFORMS,
+    TRAPS
+};
+
+/**
+ * @struct AtlasRegion
+ * @brief Represents the area of a texture copied into an atlas page.
+ */
+struct AtlasRegion {
+    SDL_Texture *page; /**< The atlas page holding the texture. */
+    SDL_Rect area; /**< The area of the texture in the page. */
+};
+
+/**
+ * @struct DrawCommand
+ * @brief Represents a sprite waiting to be drawn, its source already translated into its atlas page.
+ */
+struct DrawCommand {
+    RenderLayer layer; /**< The layer of the sprite. */
+    SDL_Texture *texture; /**< The texture to draw from. */
+    SDL_Rect source; /**< The area of the texture to draw. */
+    SDL_FRect destination; /**< The area of the screen to draw to. */
+    double angle; /**< The clockwise rotation around the center of the destination, in degrees. */
+    SDL_RendererFlip flip; /**< The flip of the sprite. */
+};
+
+
+/**
+ * @class RenderQueue
+ * @brief Collects the sprites of a frame and draws them with one SDL_RenderGeometry call per texture and layer.
+ *
+ * The sprites are sorted by layer, then by texture inside a layer. The textures copied into a TextureAtlas are replaced
+ * by their atlas page when queued, so that the sprites of different objects share the same batch.
+ */
+class RenderQueue {
+private:
+    /* ATTRIBUTES */
+
+    static std::unordered_map<SDL_Texture*, AtlasRegion> regions; /**< The atlas region of each atlased texture. */
+    static std::vector<DrawCommand> commands; /**< The sprites queued since the last flush. */
+    static std::vector<SDL_Vertex> vertices; /**< The vertex buffer reused by each batch. */
+    static std::vector<int> indices; /**< The index buffer reused by each batch. */
+
+public:
+    /* MODIFIERS */
+
+    /**
+     * @brief Register the atlas region of a texture, the texture is drawn from its page from now on.
+     * @param texture The standalone texture.
+     * @param region The area of the texture in its atlas page.
+     */
+    static void setRegion(SDL_Texture *texture, AtlasRegion region);
+
+    /**
+     * @brief Forget the atlas region of a texture.
+     * @param texture The standalone texture.
+     */
+    static void removeRegion(SDL_Texture *texture);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Queue a sprite, with the same parameters as SDL_RenderCopyExF().
+     * @param layer The layer of the sprite.
+     * @param texture The texture to draw from.
+     * @param source The area of the texture to draw.
+     * @param destination The area of the screen to draw to.
+     * @param angle The clockwise rotation around the center of the destination, in degrees.
+     * @param flip The flip of the sprite.
+     */
+    static void draw(RenderLayer layer, SDL_Texture *texture, const SDL_Rect &source, const SDL_FRect &destination,
+                     double angle = 0.0, SDL_RendererFlip flip = SDL_FLIP_NONE);
+
+    /**
+     * @brief Draw the queued sprites and empty the queue.
+     * @param renderer The renderer of the textures.
+     */
+    static void flush(SDL_Renderer *renderer);
+
+private:
+    /**
+     * @brief Append the two triangles of a sprite to the buffers.
+     * @param command The sprite.
+     * @param width The width of its texture.
+     * @param height The height of its texture.
+     */
+    static void appendQuad(const DrawCommand &command, float width, float height);
+};
+
+#endif //PLAY_TOGETHER_RENDERQUEUE_H
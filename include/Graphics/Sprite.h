@@ -3,6 +3,7 @@
 
 #include "Texture.h"
 #include "Animation.h"
+#include "../Utils/SimulationClock.h"
 
 
 /**
@@ -10,6 +11,22 @@
  * @brief Defines the Sprite class representing a Sprite in a 2D game.
  */
 
+/**
+ * @struct SpriteState
+ * @brief Represents the animation of a sprite, saved and restored by the rollback.
+ */
+struct SpriteState {
+    Animation animation; /**< The current animation of the sprite. */
+    int animationIndexX; /**< The current position in the animation of the sprite. */
+    Uint32 lastAnimationUpdate; /**< The last simulated time the animation was updated. */
+    SDL_Rect srcRect; /**< The square that will be copied in the texture. */
+    Animation nextAnimation; /**< The animation that will play after an animation of 'unique' type. */
+    int nbFrameDisplayed; /**< The number of frame that has passed since the current animation was display. */
+    bool uniqueAnimationIsDisplayed; /**< Flag indicating if a unique animation is currently displayed. */
+    SDL_RendererFlip flipHorizontal; /**< If the sprite is flipped horizontally. */
+    SDL_RendererFlip flipVertical; /**< If the sprite is flipped vertically. */
+};
+
 /**
  * @class Sprite
  * @brief Represents a sprite in a 2D game with its animation and texture.
@@ -21,7 +38,7 @@ private:
     // Animation attributes
     Animation animation = {}; /**< The current animation of the sprite. */
     int animationIndexX = 0; /**< The current position in the animation of the sprite. */
-    Uint32 lastAnimationUpdate = SDL_GetTicks(); /**< The last time the animation was updated. */
+    Uint32 lastAnimationUpdate = SimulationClock::getTime(); /**< The last simulated time the animation was updated. */
     SDL_Rect srcRect = {0 , 0, 0, 0}; /**< The square that will be copied in the texture. */
 
     // Unique animation attributes
@@ -59,6 +76,12 @@ public:
      */
     [[nodiscard]] SDL_Rect getSrcRect() const;
 
+    /**
+     * @brief Return the animation state of the sprite, its texture is not part of it.
+     * @return The SpriteState of the sprite.
+     */
+    [[nodiscard]] SpriteState getState() const;
+
 
     /* MODIFIERS */
 
@@ -74,6 +97,12 @@ public:
      */
     void setAnimationIndexX(int index);
 
+    /**
+     * @brief Restore an animation state saved by getState().
+     * @param state The state to restore.
+     */
+    void setState(const SpriteState &state);
+
 
     /* PUBLIC METHODS */
 
@@ -60,6 +60,12 @@ public:
      */
     [[nodiscard]] SDL_RendererFlip getFlipHorizontal() const;
 
+    /**
+     * @brief Return the flipVertical attribute.
+     * @return A SDL_RendererFlip representing flip value for the renderer.
+     */
+    [[nodiscard]] SDL_RendererFlip getFlipVertical() const;
+
     /**
      * @brief Return the combination of flipVertical and flipHorizontal attributes.
      * @return A SDL_RenderFlip representing flip value for the renderer.
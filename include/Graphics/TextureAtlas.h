@@ -0,0 +1,83 @@
+#ifndef PLAY_TOGETHER_TEXTUREATLAS_H
+#define PLAY_TOGETHER_TEXTUREATLAS_H
+
+#include <SDL.h>
+#include <SDL_image.h>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include "RenderQueue.h"
+
+/**
+ * @file TextureAtlas.h
+ * @brief Defines the TextureAtlas class responsible for packing sprites into a few large textures.
+ */
+
+/**
+ * @class TextureAtlas
+ * @brief Loads sprites and packs them into atlas pages drawn by the RenderQueue.
+ *
+ * Every sprite keeps its standalone texture, which gives its size and identifies it to the objects drawing it. Once
+ * build() is called, the RenderQueue draws the sprites from the pages instead. The atlas owns the textures it loaded.
+ * They are only freed by clear(), because the renderer frees them itself when it is destroyed.
+ */
+class TextureAtlas {
+private:
+    /* ATTRIBUTES */
+
+    static constexpr int maxPageSize = 2048; /**< The largest side of a page, lowered to the maximum texture size of the renderer. */
+    static constexpr int padding = 1; /**< The transparent gap between two sprites, so that filtering does not blend them. */
+
+    std::vector<std::pair<SDL_Texture*, SDL_Surface*>> pending; /**< The sprites loaded since the last build, with their pixels. */
+    std::vector<SDL_Texture*> textures; /**< The standalone textures loaded. */
+    std::vector<SDL_Texture*> pages; /**< The atlas pages. */
+
+public:
+    /* CONSTRUCTORS */
+
+    TextureAtlas() = default;
+    TextureAtlas(const TextureAtlas &) = delete;
+    TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of atlas pages.
+     * @return The number of textures the sprites are drawn from.
+     */
+    [[nodiscard]] size_t getPageCount() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Load a sprite, its pixels are kept until the next build.
+     * @param renderer The renderer of the game.
+     * @param file_path The path of the image.
+     * @return The standalone texture of the sprite, nullptr if the file could not be loaded.
+     */
+    SDL_Texture *loadTexture(SDL_Renderer &renderer, const std::string &file_path);
+
+    /**
+     * @brief Add a sprite already uploaded, the atlas takes ownership of the texture and of the surface.
+     * @param texture The standalone texture of the sprite.
+     * @param surface The pixels of the sprite, kept until the next build.
+     * @return The standalone texture of the sprite.
+     */
+    SDL_Texture *addTexture(SDL_Texture *texture, SDL_Surface *surface);
+
+    /**
+     * @brief Pack the sprites loaded since the last build into new pages and register them in the RenderQueue.
+     * @param renderer The renderer of the game.
+     */
+    void build(SDL_Renderer &renderer);
+
+    /**
+     * @brief Free every texture and page of the atlas.
+     */
+    void clear();
+};
+
+#endif //PLAY_TOGETHER_TEXTUREATLAS_H
@@ -8,6 +8,7 @@
 #include "../Game/Game.h"
 #include "../Utils/Mediator.h"
 #include "../../dependencies/json.hpp"
+#include "Protocol.h"
 
 #ifdef _WIN32
 #include "../Network/WIN32/TCPServer.h"
@@ -38,6 +39,10 @@ private:
     std::unique_ptr<std::jthread> serverUDPThreadPtr; /**< Pointer to the UDP server thread. */
     std::unique_ptr<std::jthread> clientUDPThreadPtr; /**< Pointer to the UDP client thread. */
     std::mutex clientAddressesMutex = {}; /**< Mutex to protect the client addresses map. */
+    uint32_t snapshotSequence = 0; /**< The number of the last snapshot built by the server. */
+    std::map<int, ClientSnapshots> clientSnapshots; /**< The snapshots sent to each client, used by the game loop only. */
+    SnapshotHistory receivedSnapshots; /**< The last snapshots rebuilt by the client, used by the UDP client thread only. */
+    uint32_t lastReceivedSequence = 0; /**< The number of the last snapshot rebuilt by the client. */
 
 #ifdef _WIN32
     std::map<SOCKET, sockaddr_in> clientAddresses; /**< Map storing client addresses. */
@@ -71,8 +76,9 @@ public:
 
     /**
      * @brief Starts the TCP and UDP servers.
+     * @param port The port both servers listen on.
      */
-    void startServers();
+    void startServers(uint16_t port = 8080);
 
     /**
      * @brief Starts the TCP and UDP clients.
@@ -99,6 +105,12 @@ public:
      */
     void broadcastMessage(int protocol, const std::string &message, int socketIgnored) const;
 
+    /**
+     * @brief Sends the game properties to a newly connected client and relays its connection to the other clients.
+     * @param clientSocket The socket of the new client.
+     */
+    void welcomeClient(int clientSocket);
+
     /**
      * @brief Sends the keyboard state to all clients (UDP).
      * @param keyboardStateMask The mask of the keyboard state.
@@ -106,10 +118,32 @@ public:
     void sendPlayerUpdate(uint16_t keyboardStateMask) const;
 
     /**
-     * @brief Sends the sync correction to all clients (UDP).
-     * @param message The message to send.
+     * @brief Sends the sync correction to all clients (UDP), as the difference with the last snapshot each one acknowledged.
+     * @param body The positions to send, with the real IDs of the players.
+     */
+    void sendSyncCorrection(const SyncCorrectionPacket &body);
+
+    /**
+     * @brief Records that a client rebuilt a snapshot, the next ones are sent relative to it.
+     * @param clientSocket The socket of the client.
+     * @param sequence The number of the snapshot.
+     */
+    void acknowledgeSnapshot(int clientSocket, uint32_t sequence);
+
+    /**
+     * @brief Records the tick of the last player update applied for a client, sent back with the next snapshots.
+     * @param clientSocket The socket of the client.
+     * @param tick The tick written by the client in its player update.
+     */
+    void acknowledgeInput(int clientSocket, uint32_t tick);
+
+    /**
+     * @brief Rebuilds a snapshot received from the server and acknowledges it.
+     * @param packet The received snapshot packet.
+     * @param[out] message The sync correction message holding the rebuilt snapshot.
+     * @return True if the snapshot is rebuilt and newer than the previous one, false otherwise.
      */
-    void sendSyncCorrection(nlohmann::json &message);
+    bool receiveSnapshot(const std::string &packet, Message &message);
 
     /**
      * @brief Sends the creation of an asteroid to all clients (UDP).
@@ -0,0 +1,113 @@
+#ifndef PLAY_TOGETHER_PROTOCOL_H
+#define PLAY_TOGETHER_PROTOCOL_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <algorithm>
+#include <iterator>
+#include "../Utils/MessageQueue.h"
+#include "Snapshot.h"
+
+/**
+ * @file Protocol.h
+ * @brief Declares the binary wire format of the messages exchanged at high frequency (UDP).
+ *
+ * Every packet starts with a fixed header: the protocol version (1 byte), the packet type (1 byte) and the ID of the sending
+ * player (4 bytes), followed by the fixed-layout body of its type. Integers and floats are written in little-endian order.
+ * Snapshots are the exception, they only carry the fields that changed since a base snapshot, as variable-length integers.
+ * JSON is kept for the TCP messages, a binary packet is told apart by its first byte which is never '{'.
+ */
+
+constexpr uint8_t PROTOCOL_VERSION = 4; /**< The version written in every packet, packets of another version are rejected. */
+constexpr size_t PACKET_HEADER_SIZE = 6; /**< The size of the header in bytes. */
+constexpr size_t MAX_DATAGRAM_SIZE = 8192; /**< The size of the receive buffers of the UDP sockets. */
+constexpr size_t MAX_SNAPSHOT_SIZE = 1200; /**< The largest snapshot sent, below the usual path MTU so that it is never fragmented. */
+
+/**
+ * @enum PacketType
+ * @brief Represents the type of a binary packet.
+ */
+enum class PacketType : uint8_t {
+    PLAYER_UPDATE = 1, /**< The keyboard state of a player. */
+    SNAPSHOT = 2, /**< The positions of the players and moving objects computed by the server, relative to a base snapshot. */
+    ASTEROID_CREATION = 3, /**< An asteroid created by the server. */
+    SNAPSHOT_ACK = 4 /**< The number of the last snapshot rebuilt by a client. */
+};
+
+
+/**
+ * @brief Check if a received message is a binary packet rather than a JSON message.
+ * @param packet The received message.
+ * @return True if the message is a binary packet, false otherwise.
+ */
+bool isBinaryPacket(const std::string &packet);
+
+/**
+ * @brief Read the type of a binary packet.
+ * @param packet The received packet.
+ * @return The type written in the header, 0 if the packet is too short or of another protocol version.
+ */
+PacketType getPacketType(const std::string &packet);
+
+/**
+ * @brief Write the ID of the sending player in the header of an encoded packet, used by the server before relaying it.
+ * @param packet The encoded packet.
+ * @param playerID The ID of the sending player.
+ */
+void setPacketPlayerID(std::string &packet, int playerID);
+
+/**
+ * @brief Encode a player update packet.
+ * @param keyboardStateMask The keyboard state of the player, see Mediator::encodeKeyboardStateMask().
+ * @param tick The simulation tick of the sender when the keyboard state was read.
+ * @return The encoded packet (12 bytes).
+ */
+std::string encodePlayerUpdate(uint16_t keyboardStateMask, uint32_t tick);
+
+/**
+ * @brief Encode a snapshot as the fields that changed since a base snapshot.
+ * @param snapshot The snapshot to send.
+ * @param base The last snapshot acknowledged by the client, nullptr to send the full snapshot.
+ * @param clientID The ID of the receiving client, its own player is sent with the ID -1.
+ * @param inputTick The tick of the last player update of the client applied by the server.
+ * @return The encoded packet.
+ */
+std::string encodeSnapshot(const WorldSnapshot &snapshot, const WorldSnapshot *base, int clientID, uint32_t inputTick);
+
+/**
+ * @brief Rebuild a full snapshot from a snapshot packet and the snapshots previously received.
+ * @param packet The received packet.
+ * @param history The snapshots previously rebuilt by the client.
+ * @param[out] snapshot The rebuilt snapshot.
+ * @param[out] inputTick The tick of the last player update of the client applied by the server.
+ * @return True if the packet is valid and its base snapshot is in the history, false otherwise.
+ */
+bool decodeSnapshot(const std::string &packet, const SnapshotHistory &history, WorldSnapshot &snapshot, uint32_t &inputTick);
+
+/**
+ * @brief Encode a snapshot acknowledgement packet.
+ * @param sequence The number of the rebuilt snapshot.
+ * @return The encoded packet (10 bytes).
+ */
+std::string encodeSnapshotAck(uint32_t sequence);
+
+/**
+ * @brief Encode an asteroid creation packet.
+ * @param asteroid The properties of the asteroid.
+ * @return The encoded packet (30 bytes).
+ */
+std::string encodeAsteroidCreation(const AsteroidProperties &asteroid);
+
+/**
+ * @brief Decode a binary packet into a message for the game loop.
+ * @param packet The received packet.
+ * @param[out] message The decoded message, playerID is the one of the header.
+ * @return True if the packet is valid, false if its version, type or size is wrong.
+ * @see decodeSnapshot() for the snapshot packets, which need the previous snapshots.
+ */
+bool decodePacket(const std::string &packet, Message &message);
+
+#endif //PLAY_TOGETHER_PROTOCOL_H
@@ -0,0 +1,159 @@
+#ifndef PLAY_TOGETHER_SNAPSHOT_H
+#define PLAY_TOGETHER_SNAPSHOT_H
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include "../Utils/MessageQueue.h"
+
+/**
+ * @file Snapshot.h
+ * @brief Declares the quantized world snapshots replicated from the server to the clients.
+ *
+ * The server builds one snapshot per tick, numbered from 1. A snapshot is sent to a client as the difference with the last
+ * snapshot this client acknowledged, both sides keep a history of the recent snapshots to rebuild the full state from it.
+ * The values are quantized so that the server and the client compare and rebuild exactly the same integers.
+ */
+
+constexpr float SNAPSHOT_POSITION_SCALE = 64.0f; /**< Number of quantization steps per pixel for positions. */
+constexpr size_t SNAPSHOT_HISTORY_SIZE = 64; /**< Number of snapshots kept, a base older than that is replaced by a full snapshot. */
+
+/**
+ * @struct PlayerSnapshot
+ * @brief Represents the quantized state of a player in a snapshot.
+ */
+struct PlayerSnapshot {
+    int32_t playerID = 0; /**< The ID of the player, a client stores its own player with the ID -1. */
+    int32_t x = 0; /**< The quantized x-coordinate of the player. */
+    int32_t y = 0; /**< The quantized y-coordinate of the player. */
+};
+
+/**
+ * @struct ObjectSnapshot
+ * @brief Represents the quantized position of a moving object in a snapshot, identified by its position in the list.
+ */
+struct ObjectSnapshot {
+    int32_t x = 0; /**< The quantized x-coordinate of the object. */
+    int32_t y = 0; /**< The quantized y-coordinate of the object. */
+};
+
+/**
+ * @struct WorldSnapshot
+ * @brief Represents the quantized state of the players and moving objects at a given tick.
+ */
+struct WorldSnapshot {
+    uint32_t sequence = 0; /**< The number of the snapshot, 0 for an empty snapshot. */
+    std::vector<PlayerSnapshot> players; /**< The alive players. */
+    std::vector<ObjectSnapshot> platforms1D; /**< The 1D moving platforms, in the order of the level. */
+    std::vector<ObjectSnapshot> platforms2D; /**< The 2D moving platforms, in the order of the level. */
+    std::vector<ObjectSnapshot> crushers; /**< The crushers, in the order of the level. */
+};
+
+/**
+ * @struct PlayerState
+ * @brief Represents a player gathered for a sync correction.
+ */
+struct PlayerState {
+    int32_t playerID; /**< The ID of the player, as seen by the server. */
+    float x; /**< The x-coordinate of the player. */
+    float y; /**< The y-coordinate of the player. */
+};
+
+/**
+ * @struct ObjectPosition
+ * @brief Represents a moving object gathered for a sync correction, identified by its position in the list.
+ */
+struct ObjectPosition {
+    float x; /**< The x-coordinate of the object. */
+    float y; /**< The y-coordinate of the object. */
+};
+
+/**
+ * @struct SyncCorrectionPacket
+ * @brief Represents the state gathered by the server for a sync correction, before quantization.
+ */
+struct SyncCorrectionPacket {
+    std::vector<PlayerState> players; /**< The alive players. */
+    std::vector<ObjectPosition> platforms1D; /**< The 1D moving platforms, in the order of the level. */
+    std::vector<ObjectPosition> platforms2D; /**< The 2D moving platforms, in the order of the level. */
+    std::vector<ObjectPosition> crushers; /**< The crushers, in the order of the level. */
+};
+
+/**
+ * @class SnapshotHistory
+ * @brief Ring of the last SNAPSHOT_HISTORY_SIZE snapshots, indexed by their sequence number.
+ */
+class SnapshotHistory {
+private:
+    std::array<WorldSnapshot, SNAPSHOT_HISTORY_SIZE> snapshots; /**< The snapshots, at the index sequence % SNAPSHOT_HISTORY_SIZE. */
+
+public:
+    /**
+     * @brief Store a snapshot, replacing the one SNAPSHOT_HISTORY_SIZE sequences older.
+     * @param snapshot The snapshot to store.
+     */
+    void store(const WorldSnapshot &snapshot);
+
+    /**
+     * @brief Find a stored snapshot.
+     * @param sequence The sequence number of the snapshot.
+     * @return A pointer to the snapshot, nullptr if it is not stored anymore or if sequence is 0.
+     */
+    [[nodiscard]] const WorldSnapshot *find(uint32_t sequence) const;
+
+    /**
+     * @brief Remove every stored snapshot.
+     */
+    void clear();
+};
+
+/**
+ * @struct ClientSnapshots
+ * @brief Represents the snapshots sent by the server to a client.
+ */
+struct ClientSnapshots {
+    SnapshotHistory sent; /**< The last snapshots sent to the client. */
+    uint32_t acknowledgedSequence = 0; /**< The number of the last snapshot the client acknowledged, used as base. */
+    uint32_t lastInputTick = 0; /**< The tick of the last player update of the client applied by the server. */
+};
+
+
+/**
+ * @brief Quantize a position.
+ * @param value The position in pixels.
+ * @return The quantized position.
+ */
+inline int32_t quantizePosition(float value) {
+    return static_cast<int32_t>(std::lround(value * SNAPSHOT_POSITION_SCALE));
+}
+
+/**
+ * @brief Quantize the state gathered for a sync correction into a snapshot.
+ * @param body The state to quantize.
+ * @param sequence The number of the snapshot.
+ * @return The snapshot.
+ */
+WorldSnapshot quantizeSnapshot(const SyncCorrectionPacket &body, uint32_t sequence);
+
+/**
+ * @brief Limit the objects of a snapshot that differ from a base snapshot, to keep its encoding under a size.
+ *
+ * In each list, only the first maxObjects objects that differ from the base are kept. The other objects keep their position
+ * in the base, or are left out with the objects after them when the base does not have them yet. The objects left behind
+ * are sent by the next snapshots, once the client acknowledged this one as their base.
+ * @param snapshot The snapshot to limit.
+ * @param base The base snapshot, nullptr for a full snapshot.
+ * @param maxObjects The number of objects that may differ from the base in each list.
+ * @return The limited snapshot, with the same sequence number.
+ */
+WorldSnapshot limitSnapshot(const WorldSnapshot &snapshot, const WorldSnapshot *base, size_t maxObjects);
+
+/**
+ * @brief Convert a snapshot into a sync correction message for the game loop.
+ * @param snapshot The snapshot, with the player IDs seen by the client.
+ * @param[out] message The message, its positions are dequantized.
+ */
+void snapshotToMessage(const WorldSnapshot &snapshot, Message &message);
+
+#endif //PLAY_TOGETHER_SNAPSHOT_H
@@ -5,22 +5,41 @@
 
 #include <map>
 #include <mutex>
+#include <deque>
 #include <vector>
 #include <string>
 #include <iostream>
+#include <unordered_map>
+#include <cerrno>
+#include <fcntl.h>
 #include <unistd.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <array>
+#include <atomic>
 #include <thread>
 #include <ranges>
 #include <algorithm>
 #include <cstring>
+#include <cstdint>
 
 #include "../TCPError.h"
 #include "../../Utils/Mediator.h"
 #include "../../../dependencies/json.hpp"
 
+/**
+ * @brief The Connection struct holds the buffered state of a client connection handled by the reactor.
+ */
+struct Connection {
+    std::string readBuffer; /**< Bytes received from the client that do not form a complete frame yet. */
+    std::deque<std::string> writeQueue; /**< Frames waiting to be written to the client socket. */
+    size_t writeOffset = 0; /**< Number of bytes of the front frame already written. */
+    size_t queuedBytes = 0; /**< Number of bytes of the write queue not written yet. */
+    bool isOverflowed = false; /**< Flag indicating if the write queue exceeded its limit, the connection is being shut down. */
+};
+
 /**
  * @brief The TCPServer class provides functionality to create and manage a TCP server.
  */
@@ -29,9 +48,15 @@ private:
     /* ATTRIBUTES */
 
     int socketFileDescriptor = -1; /**< The server socket file descriptor. */
+    int epollFileDescriptor = -1; /**< The epoll instance watching the server and client sockets. */
     unsigned int maxClients = 3; /**< Maximum number of clients that can connect to the server. */
-    std::vector<std::jthread> clientThreads; /**< Threads to handle client connections. */
-    std::atomic<bool> stopRequested = false; /**< Flag to indicate if the server should stop. (exit the accept loop) */
+    static constexpr int maxEvents = 64; /**< Maximum number of events handled per epoll_wait call. */
+    static constexpr int eventTimeout = 200; /**< Timeout of epoll_wait in milliseconds, bounds the time to notice a stop request. */
+    static constexpr size_t maxFrameSize = 1 << 20; /**< Maximum size of a received frame, larger frames close the connection. */
+    static constexpr size_t maxQueuedBytes = 4 << 20; /**< Maximum number of bytes waiting to be written to a client, a client exceeding it is disconnected. */
+    mutable std::unordered_map<int, Connection> connections; /**< Buffered state of each connected client. (file descriptor, connection) */
+    mutable std::mutex connectionsMutex; /**< Mutex to protect the connections, sends can come from the game loop thread. */
+    std::atomic<bool> stopRequested = false; /**< Flag to indicate if the server should stop. (exit the event loop) */
     std::map<int, sockaddr_in> *clientAddressesPtr = nullptr; /**< Pointer to the map of client IDs and their addresses. (file descriptor, address) */
     std::mutex *clientAddressesMutexPtr = nullptr; /**< Pointer to the mutex to protect the client addresses map. */
 
@@ -58,7 +83,7 @@ public:
      * @param port The port number to listen on.
      * @return True if initialization is successful, false otherwise.
      */
-    void initialize(short port);
+    void initialize(uint16_t port);
 
     /**
      * @brief Starts the TCP server to accept incoming connections.
@@ -68,10 +93,10 @@ public:
     void start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &clientAddressesMutex);
 
     /**
-     * @brief Sends a message to the specified client.
+     * @brief Queues a message for the specified client and writes as much of it as the socket accepts.
      * @param clientSocket The client socket file descriptor.
      * @param message The message to send.
-     * @return True if the message is sent successfully, false otherwise.
+     * @return True if the message is queued successfully, false otherwise.
      */
     bool send(int clientSocket, const std::string &message) const;
 
@@ -82,13 +107,6 @@ public:
      */
     bool broadcast(const std::string &message, int socketIgnored) const;
 
-    /**
-     * @brief Receives a message from the specified client.
-     * @param clientSocket The client socket file descriptor.
-     * @return The received message.
-     */
-    [[nodiscard]] std::string receive(int clientSocket) const;
-
     /**
      * @brief Sends the game properties to the specified client.
      * @param clientSocket The client socket file descriptor.
@@ -118,21 +136,65 @@ public:
 private:
 
     /**
-     * @brief Waits for a new client connection.
-     * @return The client socket file descriptor if successful, -1 if an error occurs.
+     * @brief Runs the event loop dispatching the epoll events until a stop is requested.
      */
-    int waitForConnection();
+    void runEventLoop();
 
     /**
-     * @brief Accepts incoming client connections.
+     * @brief Accepts every pending client connection. (the listening socket is edge-triggered)
      */
     void acceptConnections();
 
     /**
-     * @brief Handles messages from a client.
+     * @brief Registers an accepted client socket, or rejects it if the server is full.
+     * @param clientSocket The client socket file descriptor.
+     * @param clientAddr The client address.
+     */
+    void registerConnection(int clientSocket, const sockaddr_in &clientAddr);
+
+    /**
+     * @brief Reads every available byte from a client and handles the complete frames.
+     * @param clientSocket The client socket file descriptor.
+     */
+    void readFromConnection(int clientSocket);
+
+    /**
+     * @brief Writes the queued frames of a client until the queue is empty or the socket would block.
+     * @param clientSocket The client socket file descriptor.
+     * @param connection The connection of the client, connectionsMutex must be locked.
+     * @return False if a write error occurred, true otherwise.
+     */
+    bool flushConnection(int clientSocket, Connection &connection) const;
+
+    /**
+     * @brief Appends a frame to the write queue of a client and writes as much of it as the socket accepts.
+     * @param clientSocket The client socket file descriptor.
+     * @param connection The connection of the client, connectionsMutex must be locked.
+     * @param frame The frame to send.
+     * @return False if the queue exceeds maxQueuedBytes, the connection is then shut down, or if a write error occurred, true otherwise.
+     */
+    bool queueFrame(int clientSocket, Connection &connection, const std::string &frame) const;
+
+    /**
+     * @brief Extracts the complete length-prefixed frames from a read buffer.
+     * @param buffer The read buffer, the extracted frames are removed from it.
+     * @param messages The vector to append the extracted messages to.
+     * @return False if a frame has an invalid size, true otherwise.
+     */
+    static bool extractFrames(std::string &buffer, std::vector<std::string> &messages);
+
+    /**
+     * @brief Builds a frame made of the message size followed by the message content.
+     * @param message The message to frame.
+     * @return The frame.
+     */
+    static std::string makeFrame(const std::string &message);
+
+    /**
+     * @brief Closes a client connection and notifies the game and the other clients.
      * @param clientSocket The client socket file descriptor.
      */
-    void handleMessage(int clientSocket);
+    void closeConnection(int clientSocket);
 
     /**
      * @brief Close all client connections and clear resources.
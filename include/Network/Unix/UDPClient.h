@@ -14,6 +14,7 @@
 #include <mutex>
 
 #include "../UDPError.h"
+#include "../Protocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
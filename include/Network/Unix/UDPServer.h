@@ -6,8 +6,11 @@
 #include <map>
 #include <mutex>
 #include <vector>
+#include <array>
 #include <string>
 #include <iostream>
+#include <unordered_map>
+#include <cerrno>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -16,8 +19,10 @@
 #include <ranges>
 #include <algorithm>
 #include <cstring>
+#include <cstdint>
 
 #include "../UDPError.h"
+#include "../Protocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -31,6 +36,13 @@ private:
     bool stopRequested = false; /**< Flag to indicate if the server should stop. */
     std::map<int, sockaddr_in> *clientAddressesPtr = nullptr; /**< Pointer to the map of client IDs and their addresses. */
     std::mutex *clientAddressesMutexPtr = nullptr; /**< Pointer to the mutex to protect the client addresses map. */
+    std::unordered_map<uint64_t, int> clientIDs; /**< Client IDs indexed by address and port, checked against the client addresses map. */
+
+    static constexpr unsigned int batchSize = 32; /**< Maximum number of datagrams received by a single recvmmsg call. */
+    std::vector<char> receiveBuffer; /**< Storage of the received datagrams, MAX_DATAGRAM_SIZE bytes per datagram. */
+    std::array<sockaddr_in, batchSize> receiveAddresses = {}; /**< Sender addresses of the received datagrams. */
+    std::array<iovec, batchSize> receiveVectors = {}; /**< Buffers given to recvmmsg, one per datagram. */
+    std::array<mmsghdr, batchSize> receiveHeaders = {}; /**< Headers given to recvmmsg, one per datagram. */
 
 
 public:
@@ -54,7 +66,7 @@ public:
      * @brief Initializes the UDP server with the given port.
      * @param port The port number to listen on.
      */
-    void initialize(short port);
+    void initialize(uint16_t port);
 
     /**
      * @brief Starts the UDP server to handle incoming messages.
@@ -72,7 +84,7 @@ public:
     bool send(const sockaddr_in& clientAddress, const std::string &message) const;
 
     /**
-     * @brief Broadcasts a message to all connected clients.
+     * @brief Broadcasts a message to all connected clients with a single sendmmsg call.
      * @param message The message to broadcast.
      * @param socketIgnored The socket to ignore when broadcasting. (0 to broadcast to all clients)
      * @return True if the message is sent successfully to all clients, false otherwise.
@@ -80,31 +92,37 @@ public:
     bool broadcast(const std::string &message, int socketIgnored) const;
 
     /**
-     * @brief Receives a message from a client.
-     * @param clientAddress The client address structure.
-     * @return The received message.
+     * @brief Shuts down the server.
      */
-    [[nodiscard]] std::string receive(sockaddr_in& clientAddress, int timeout) const;
+    void stop();
+
+private:
 
     /**
-     * @brief Sends a synchronous correction message to the client.
-     * @param clientSocket The client socket file descriptor.
-     * @param message The message to send.
-     * @return True if the message is sent successfully, false otherwise.
+     * @brief Waits for incoming messages.
      */
-    bool sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const;
+    void handleMessage();
 
     /**
-     * @brief Shuts down the server.
+     * @brief Receives the pending datagrams with a single recvmmsg call.
+     * @param timeoutMilliseconds The time to wait for a first datagram.
+     * @return The number of datagrams received, stored in the receive buffers.
      */
-    void stop();
+    unsigned int receiveBatch(int timeoutMilliseconds);
 
-private:
+    /**
+     * @brief Identifies the client that sent a datagram, clientAddressesMutexPtr must be locked.
+     * @param clientAddress The sender address.
+     * @return The client ID, -1 if the address is unknown.
+     */
+    int findClientID(const sockaddr_in &clientAddress);
 
     /**
-     * @brief Waits for incoming messages.
+     * @brief Builds the key of an address in the client IDs map.
+     * @param address The address.
+     * @return The IPv4 address in the high bits and the port in the low bits.
      */
-    void handleMessage();
+    static uint64_t addressKey(const sockaddr_in &address);
 };
 
 #endif //PLAY_TOGETHER_UDPSERVER_H
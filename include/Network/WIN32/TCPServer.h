@@ -12,6 +12,7 @@
 #include <ranges>
 #include <algorithm>
 #include <cstring>
+#include <cstdint>
 #include <winsock2.h>
 #include <ws2tcpip.h>
 
@@ -45,7 +46,7 @@ public:
      * @param port The port number to listen on.
      * @return True if initialization is successful, false otherwise.
      */
-    void initialize(short port);
+    void initialize(uint16_t port);
 
     /**
      * @brief Starts the TCP server to accept incoming connections.
@@ -12,6 +12,7 @@
 #include <ws2tcpip.h>
 
 #include "../UDPError.h"
+#include "../Protocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -12,10 +12,12 @@
 #include <ranges>
 #include <algorithm>
 #include <cstring>
+#include <cstdint>
 #include <winsock2.h>
 #include <ws2tcpip.h>
 
 #include "../UDPError.h"
+#include "../Protocol.h"
 #include "../../Utils/Mediator.h"
 
 /**
@@ -43,7 +45,7 @@ public:
      * @brief Initializes the UDP server with the given port.
      * @param port The port number to listen on.
      */
-    void initialize(short port);
+    void initialize(uint16_t port);
 
     /**
      * @brief Starts the UDP server to handle incoming messages.
@@ -75,14 +77,6 @@ public:
      */
     [[nodiscard]] std::string receive(sockaddr_in& clientAddress, int timeout) const;
 
-    /**
-     * @brief Sends a synchronous correction message to the client.
-     * @param clientSocket The client socket file descriptor.
-     * @param message The message to send.
-     * @return True if the message is sent successfully, false otherwise.
-     */
-    bool sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const;
-
     /**
      * @brief Shuts down the server.
      */
@@ -3,6 +3,9 @@
 
 #include <SDL.h>
 #include <numeric>
+#include <limits>
+#include <cmath>
+#include <vector>
 #include "Polygon.h"
 #include "../Game/Player.h"
 
@@ -20,6 +23,19 @@
  */
 bool checkAABBCollision(const SDL_FRect &a, const SDL_FRect &b);
 
+/**
+ * @brief Check for AABB collisions between one rectangle and packed rectangles, 8 at a time with AVX2 or 4 with SSE2.
+ * @param query SDL_FRect representing the rectangle tested against every packed rectangle.
+ * @param x The x-coordinates of the packed rectangles.
+ * @param y The y-coordinates of the packed rectangles.
+ * @param w The widths of the packed rectangles.
+ * @param h The heights of the packed rectangles.
+ * @param count The number of packed rectangles.
+ * @param[out] result The indices of the packed rectangles colliding with the query, sorted in ascending order.
+ * @note Without SIMD support, the rectangles are tested one by one, each pair gives the same result as checkAABBCollision().
+ */
+void checkAABBCollisions(const SDL_FRect &query, const float *x, const float *y, const float *w, const float *h, size_t count, std::vector<size_t> &result);
+
 /**
  * @brief Checks for Separating Axes Theorem (SAT) collision between two polygons.
  * @param playerVertices The vector of Point representing the vertices of the player object.
@@ -28,21 +44,58 @@ bool checkAABBCollision(const SDL_FRect &a, const SDL_FRect &b);
  */
 bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &obstacle);
 
+/**
+ * @brief Checks for Separating Axes Theorem (SAT) collision between a rectangle and a polygon, without building its vertices.
+ * @param rect SDL_FRect representing the rectangle (player, collider or broad phase area).
+ * @param obstacle The polygon obstacle.
+ * @return True if a collision is detected, false otherwise.
+ */
+bool checkSATCollision(const SDL_FRect &rect, const Polygon &obstacle);
+
+/**
+ * @struct SweepResult
+ * @brief Represents the contact between a moving rectangle and a fixed obstacle along a move.
+ */
+struct SweepResult {
+    bool hit; /**< Flag indicating if the rectangle overlaps the obstacle at some point of the move. */
+    float entryTime; /**< The fraction of the move at which the overlap starts, negative if they already overlap. */
+    float exitTime; /**< The fraction of the move at which the overlap ends, greater than 1 if they still overlap at the end. */
+    Point normal; /**< The unit normal of the obstacle face that is hit, pointing against the move. */
+};
+
+/**
+ * @brief Computes in one pass when a moving rectangle enters and leaves a fixed rectangle.
+ * @param box SDL_FRect representing the moving rectangle at the start of the move.
+ * @param move The displacement of the rectangle.
+ * @param obstacle SDL_FRect representing the fixed rectangle.
+ * @return The contact times and normal, hit is false if the rectangles never overlap during the move.
+ */
+SweepResult sweepAABB(const SDL_FRect &box, Point move, const SDL_FRect &obstacle);
+
+/**
+ * @brief Computes in one pass when a moving rectangle enters and leaves a convex polygon (swept SAT).
+ * @param box SDL_FRect representing the moving rectangle at the start of the move.
+ * @param move The displacement of the rectangle.
+ * @param obstacle The polygon obstacle.
+ * @return The contact times and normal, hit is false if the shapes never overlap during the move or the polygon is not convex.
+ */
+SweepResult sweepSAT(const SDL_FRect &box, Point move, const Polygon &obstacle);
+
 /**
  * @brief Checks for Axis-Aligned Bounding Box (AABB) collision between a player and a rectangle, specified to avoid tunnel effect.
- * @param player The player's object that will be checked for collision with the rectangle.
+ * @param player The player's object that will be checked for collision with the rectangle, its move is shortened to end inside the obstacle.
  * @param obstacle SDL_FRect representing the rectangle.
  * @return True if collision detected, false otherwise.
- * @see checkAABBCollision() to only check a collision at one position (may cause tunnel effect).
+ * @see sweepAABB() for the contact computation.
  */
 bool checkAABBCollisionTunneling(Player *player, const SDL_FRect &obstacle);
 
 /**
  * @brief Checks for Separating Axes Theorem (SAT) collision between a player and a polygons, specified to avoid tunnel effect.
- * @param player The player's object that will be checked for collision with the obstacle.
+ * @param player The player's object that will be checked for collision with the obstacle, its move is shortened to end inside the obstacle.
  * @param obstacle The polygon obstacle.
  * @return True if collision detected, false otherwise.
- * @see checkSATCollision() to only check a collision at one position (may cause tunnel effect).
+ * @see sweepSAT() for the contact computation.
  */
 bool checkSATCollisionTunneling(Player *player, const Polygon &obstacle);
 
@@ -1,8 +1,12 @@
 #ifndef PLAY_TOGETHER_POLYGON_H
 #define PLAY_TOGETHER_POLYGON_H
 
+#include <SDL_rect.h>
+#include <span>
 #include <vector>
 #include <cmath>
+#include <cstdio>
+#include <algorithm>
 #include "../Game/Point.h"
 
 /**
@@ -20,9 +24,19 @@ enum class PolygonType {
     EVENT
 };
 
+/**
+ * @struct Projection
+ * @brief Represents the interval covered by a shape projected onto an axis.
+ */
+struct Projection {
+    float min; /**< The smallest projected value. */
+    float max; /**< The largest projected value. */
+};
+
 /**
  * @class Polygon
  * @brief Represents a polygon in 2D space.
+ * @note Everything the SAT test needs (convexity, separation axes, projections and bounding box) is baked at construction.
  */
 class Polygon {
 private:
@@ -31,12 +45,30 @@ private:
     std::vector<Point> vertices; /**< The vertices of the polygon. */
     PolygonType type; /**< The type of the zone. */
 
+    // BAKED DATA
+    bool convex = false; /**< Flag indicating if the polygon is convex. */
+    SDL_FRect boundingBox = {0, 0, 0, 0}; /**< The smallest axis-aligned rectangle containing the polygon. */
+    std::vector<Point> edgeNormals; /**< The normal of each edge of the polygon, used as separation axes. */
+    std::vector<Projection> projections; /**< The projection of the polygon onto each edge normal. */
+
 
 public:
     /* CONSTRUCTORS */
 
     Polygon(const std::vector<Point> &vertices, PolygonType type);
 
+    /**
+     * @brief Construct a polygon from data baked beforehand, by the level compiler.
+     * @param vertices The vertices of the polygon.
+     * @param type The type of the zone.
+     * @param convex True if the polygon is convex.
+     * @param bounding_box The smallest axis-aligned rectangle containing the polygon.
+     * @param edge_normals The normal of each edge, as many as vertices.
+     * @param projections The projection of the polygon onto each edge normal, as many as vertices.
+     */
+    Polygon(std::span<const Point> vertices, PolygonType type, bool convex, const SDL_FRect &bounding_box,
+            std::span<const Point> edge_normals, std::span<const Projection> projections);
+
 
     /* ACCESSORS */
 
@@ -44,7 +76,7 @@ public:
      * @brief Get the vertices of the polygon.
      * @return The vertices of the polygon.
      */
-    [[nodiscard]] std::vector<Point> getVertices() const;
+    [[nodiscard]] const std::vector<Point> &getVertices() const;
 
     /**
      * @brief Get the type of the zone.
@@ -52,18 +84,40 @@ public:
      */
     [[nodiscard]] PolygonType getType() const;
 
+    /**
+     * @brief Get the smallest axis-aligned rectangle containing the polygon.
+     * @return The bounding box of the polygon.
+     */
+    [[nodiscard]] const SDL_FRect &getBoundingBox() const;
+
+    /**
+     * @brief Get the normal of each edge of the polygon.
+     * @return The edge normals, not normalized.
+     */
+    [[nodiscard]] const std::vector<Point> &getEdgeNormals() const;
+
+    /**
+     * @brief Get the projection of the polygon onto each edge normal.
+     * @return The projections, in the same order as getEdgeNormals().
+     */
+    [[nodiscard]] const std::vector<Projection> &getProjections() const;
+
 
     /* METHODS */
 
     /**
      * @brief Checks if a polygon is convex.
-     * @param polygon The polygon to check.
      * @return True if the polygon is convex, false otherwise.
      */
     [[nodiscard]] bool isConvex() const;
 
 private:
 
+    /**
+     * @brief Compute the convexity, bounding box, edge normals and projections of the polygon.
+     */
+    void bake();
+
     /**
      * @brief Calculate the distance between two points.
      * @param a The first point.
@@ -0,0 +1,124 @@
+#ifndef PLAY_TOGETHER_SPATIALGRID_H
+#define PLAY_TOGETHER_SPATIALGRID_H
+
+#include <SDL_rect.h>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <unordered_map>
+
+/**
+ * @file SpatialGrid.h
+ * @brief Defines the SpatialGrid class responsible for indexing objects of a level by their position.
+ */
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform grid hashing the bounding boxes of a collection of objects into fixed-size cells.
+ *
+ * Objects are identified by their index in the container they come from, so a grid stays valid when its owner is copied.
+ * A query only visits the cells overlapping the requested area, its cost does not depend on the size of the map.
+ */
+class SpatialGrid {
+private:
+    /**
+     * @struct CellRange
+     * @brief Represents the inclusive range of cells covered by an object.
+     */
+    struct CellRange {
+        int minX; /**< The first column covered by the object. */
+        int minY; /**< The first row covered by the object. */
+        int maxX; /**< The last column covered by the object. */
+        int maxY; /**< The last row covered by the object. */
+
+        bool operator==(const CellRange &other) const = default;
+    };
+
+
+    /* ATTRIBUTES */
+
+    float cellSize; /**< The width and height of a cell in pixels. */
+    std::unordered_map<std::int64_t, std::vector<size_t>> cells; /**< The indices of the objects overlapping each non-empty cell. */
+    std::vector<CellRange> ranges; /**< The range of cells covered by each object. */
+    std::vector<unsigned int> queryMarks; /**< The last query in which each object was collected, used to remove duplicates. */
+    unsigned int queryStamp = 0; /**< The identifier of the current query. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit SpatialGrid(float cell_size = 512.0f);
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of objects indexed by the grid.
+     * @return The number of objects.
+     */
+    [[nodiscard]] size_t size() const;
+
+
+    /* METHODS */
+
+    /**
+     * @brief Remove every object from the grid.
+     */
+    void clear();
+
+    /**
+     * @brief Add an object to the grid, its index is the number of objects previously inserted.
+     * @param bounding_box The bounding box of the object.
+     * @return The index given to the object.
+     */
+    size_t insert(const SDL_FRect &bounding_box);
+
+    /**
+     * @brief Move an object to the cells overlapping its new bounding box, does nothing if the cells did not change.
+     * @param index The index of the object.
+     * @param bounding_box The new bounding box of the object.
+     */
+    void update(size_t index, const SDL_FRect &bounding_box);
+
+    /**
+     * @brief Collect the objects whose cells overlap an area.
+     * @param area The area to search.
+     * @param[out] result The indices of the objects found, sorted in ascending order and without duplicates.
+     * @note The result is a superset of the objects overlapping the area, an exact test is still required.
+     */
+    void query(const SDL_FRect &area, std::vector<size_t> &result);
+
+private:
+
+    /**
+     * @brief Compute the range of cells covered by a bounding box.
+     * @param bounding_box The bounding box.
+     * @return The range of cells.
+     */
+    [[nodiscard]] CellRange computeRange(const SDL_FRect &bounding_box) const;
+
+    /**
+     * @brief Compute the hash key of a cell.
+     * @param x The column of the cell.
+     * @param y The row of the cell.
+     * @return The key of the cell.
+     */
+    static std::int64_t cellKey(int x, int y);
+
+    /**
+     * @brief Add an object to every cell of a range.
+     * @param index The index of the object.
+     * @param range The range of cells.
+     */
+    void addToCells(size_t index, const CellRange &range);
+
+    /**
+     * @brief Remove an object from every cell of a range.
+     * @param index The index of the object.
+     * @param range The range of cells.
+     */
+    void removeFromCells(size_t index, const CellRange &range);
+};
+
+#endif //PLAY_TOGETHER_SPATIALGRID_H
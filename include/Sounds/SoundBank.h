@@ -0,0 +1,57 @@
+#ifndef PLAY_TOGETHER_SOUNDBANK_H
+#define PLAY_TOGETHER_SOUNDBANK_H
+
+#include <SDL_mixer.h>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <unordered_map>
+
+// Define constants for directories and file names
+constexpr char SOUNDS_DIRECTORY[] = "assets/sounds/";
+
+
+/**
+ * @file SoundBank.h
+ * @brief Defines the SoundBank class responsible for decoding each sound effect once for the whole process.
+ */
+
+/**
+ * @class SoundBank
+ * @brief Owns the decoded sound effects, shared by every SoundEffect playing the same file.
+ *
+ * A file is read and decoded the first time it is requested, the following requests return the same chunk. The chunks are
+ * freed by clear(), which must be called before closing the audio device.
+ */
+class SoundBank {
+private:
+    /* ATTRIBUTES */
+
+    static std::unordered_map<std::string, Mix_Chunk*> chunks; /**< The decoded sounds, by file name relative to SOUNDS_DIRECTORY. */
+
+public:
+    static const std::vector<std::string> worldSounds; /**< The sounds played by the objects of the levels. */
+
+
+    /* METHODS */
+
+    /**
+     * @brief Return the decoded sound of a file, decoding it on the first request.
+     * @param file_name The name of the file, relative to SOUNDS_DIRECTORY.
+     * @return A pointer to the chunk owned by the bank, nullptr if the file could not be loaded or if there is no audio.
+     */
+    static Mix_Chunk *getSound(const std::string &file_name);
+
+    /**
+     * @brief Decode sounds ahead of their first use, so that the game loop never reads them from disk.
+     * @param file_names The names of the files, relative to SOUNDS_DIRECTORY.
+     */
+    static void preload(const std::vector<std::string> &file_names);
+
+    /**
+     * @brief Free every decoded sound, the chunks handed out must not be played anymore.
+     */
+    static void clear();
+};
+
+#endif //PLAY_TOGETHER_SOUNDBANK_H
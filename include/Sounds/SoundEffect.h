@@ -4,9 +4,7 @@
 #include <SDL_mixer.h>
 #include <string>
 #include <iostream>
-
-// Define constants for directories and file names
-constexpr char SOUNDS_DIRECTORY[] = "assets/sounds/";
+#include "SoundBank.h"
 
 
 /**
@@ -16,18 +14,19 @@ constexpr char SOUNDS_DIRECTORY[] = "assets/sounds/";
 
 /**
  * @class SoundEffect
- * @brief Represents the sound effect object.
+ * @brief Represents the sound effect object, a lightweight handle on a sound decoded once by the SoundBank.
  */
 class SoundEffect {
 private:
     /* ATTRIBUTES */
 
-    Mix_Chunk* sound; /**< The sound file to be played. */
+    Mix_Chunk* sound = nullptr; /**< The sound to be played, owned by the SoundBank. */
     int volume = 20; /**< The sound volume. */
 
 public:
 
     static int masterVolume; /**< The master volume. */
+    static bool muted; /**< True while the sound effects must not be played, when past ticks are simulated again. */
 
 
     /* CONSTRUCTORS */
@@ -61,11 +60,17 @@ public:
     /* MUTATORS */
 
     /**
-     * @brief Set a new volume to the sound effect.
+     * @brief Set a new volume to the sound effect, the chunk is shared so the volume is applied to the channel playing it.
      * @param volume An int value between 0 and 128.
      */
     void setVolume(int new_volume);
 
+    /**
+     * @brief Mute or unmute every sound effect, a muted sound effect is skipped instead of being played later.
+     * @param state True to mute the sound effects, false to play them again.
+     */
+    static void setMuted(bool state);
+
 
     /* METHODS */
 
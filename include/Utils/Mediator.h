@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "MessageQueue.h"
+#include "Profiler.h"
 #include "../Game/Player.h"
 #include "../Game/Events/Asteroid.h"
 #include "../../dependencies/json.hpp"
@@ -85,7 +86,7 @@ public:
     static void stopServers();
     static void stopClients();
     static void sendPlayerUpdate(uint16_t keyboardStateMask);
-    static void sendSyncCorrection(nlohmann::json &message);
+    static void sendSyncCorrection();
     static void sendAsteroidCreation(Asteroid const &asteroid);
 
     // Menu methods
@@ -105,25 +106,33 @@ public:
 
     // Other methods
     /**
-     * @brief Handles a client connection.
+     * @brief Handles a client connection, the player is added by the game loop.
      * @param playerID The ID of the player who connected.
      */
     static int handleClientConnect(int playerID);
 
     /**
-     * @brief Handles a client disconnection.
+     * @brief Handles a client disconnection, the player is removed by the game loop.
      * @param playerID The ID of the player who disconnected.
      */
     static int handleClientDisconnect(int playerID);
 
     /**
-     * @brief Handles messages received from the network.
+     * @brief Handles messages received from the network, called by the network threads.
+     *
+     * The message is relayed to the other clients if the application is a server, then decoded and pushed to the message queue.
      * @param protocol The protocol used to send the message (0 for TCP, 1 for UDP).
      * @param message The message received.
      * @param playerID The ID of the player who sent the message. (0 for server)
      */
     static void handleMessages(int protocol, const std::string &message, int playerID);
 
+    /**
+     * @brief Applies a decoded network message to the game, must only be called from the main thread.
+     * @param message The message popped from the message queue.
+     */
+    static void applyMessage(const Message &message);
+
     /**
      * @brief Creates a mask of the keyboard state. Each bit represents a key.
      * @return The mask of the keyboard state.
@@ -137,10 +146,38 @@ public:
      */
     static void decodeKeyboardStateMask(uint16_t mask, std::array<int, SDL_NUM_SCANCODES> &keyStates);
 
+    /**
+     * @brief Applies a keyboard state to a player, only the keys pressed or released since its last state trigger key events.
+     * @param player The player to apply the keyboard state to.
+     * @param mask The mask of the keyboard state.
+     */
+    static void applyKeyboardStateMask(Player *player, uint16_t mask);
+
+    /**
+     * @brief Sets the last keyboard state of a player without triggering key events, used before resimulating past steps.
+     * @param playerID The ID of the player.
+     * @param mask The mask of the keyboard state.
+     */
+    static void setKeyboardStateMask(int playerID, uint16_t mask);
+
 private:
     /** PRIVATE METHODS **/
 
     static void handleKeyboardState(Player *player, std::array<int, SDL_NUM_SCANCODES> &keyStates);
+
+    /**
+     * @brief Handles a binary packet received from the network, see Protocol.h.
+     * @param protocol The protocol used to send the packet (0 for TCP, 1 for UDP).
+     * @param packet The packet received.
+     * @param playerID The ID of the player who sent the packet. (0 for server)
+     */
+    static void handleBinaryPacket(int protocol, const std::string &packet, int playerID);
+
+    /**
+     * @brief Pushes a decoded message to the message queue, the message is dropped if the queue is full.
+     * @param message The message to push.
+     */
+    static void pushMessage(Message &message);
 };
 
 #endif //PLAY_TOGETHER_MEDIATOR_H
@@ -2,30 +2,126 @@
 #define PLAY_TOGETHER_MESSAGEQUEUE_H
 
 #include <string>
-#include <queue>
-#include <mutex>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <utility>
 
+/**
+ * @file MessageQueue.h
+ * @brief Defines the MessageQueue class carrying decoded network messages from the network threads to the game loop.
+ */
+
+/**
+ * @enum MessageType
+ * @brief Represents the kind of a message and which fields of Message it uses.
+ */
+enum class MessageType {
+    INITIALIZE_CLIENT_GAME, /**< The server sent the game properties, payload holds the raw JSON message. */
+    CLIENT_CONNECT, /**< A client connected to this server, playerID is its socket. */
+    CLIENT_DISCONNECT, /**< A client disconnected from this server, playerID is its socket. */
+    PLAYER_CONNECT, /**< The server relayed the connection of another player, playerID is its ID. */
+    PLAYER_DISCONNECT, /**< The server relayed the disconnection of another player, playerID is its ID. */
+    PLAYER_UPDATE, /**< A player sent its keyboard state, playerID, keyboardStateMask and inputTick are set. */
+    SYNC_CORRECTION, /**< The server sent the positions of the players and moving objects, sequence and inputTick are set. */
+    SNAPSHOT_ACK, /**< A client acknowledged a snapshot, playerID and sequence are set. */
+    ASTEROID_CREATION /**< The server created an asteroid, asteroid is set. */
+};
+
+/**
+ * @struct PositionCorrection
+ * @brief Represents the position of an object sent by the server.
+ */
+struct PositionCorrection {
+    int id; /**< The ID of the player, or the index of the object in its level container. */
+    float x; /**< The x-coordinate of the object. */
+    float y; /**< The y-coordinate of the object. */
+};
+
+/**
+ * @struct AsteroidProperties
+ * @brief Represents the properties of an asteroid sent by the server.
+ */
+struct AsteroidProperties {
+    float x; /**< The x-coordinate of the asteroid. */
+    float y; /**< The y-coordinate of the asteroid. */
+    float speed; /**< The speed of the asteroid. */
+    float h; /**< The height of the asteroid. */
+    float w; /**< The width of the asteroid. */
+    float angle; /**< The angle of the asteroid. */
+};
+
+/**
+ * @struct Message
+ * @brief Represents a network message decoded by a network thread, ready to be applied by the game loop.
+ */
+struct Message {
+    MessageType type = MessageType::PLAYER_UPDATE; /**< The kind of the message. */
+    int playerID = 0; /**< The ID of the player concerned by the message. */
+    uint16_t keyboardStateMask = 0; /**< The keyboard state of the player, see Mediator::encodeKeyboardStateMask(). */
+    uint32_t sequence = 0; /**< The number of the snapshot received or acknowledged. */
+    uint32_t inputTick = 0; /**< The tick of a player update, or of the last player update of this client applied by the server. */
+    AsteroidProperties asteroid = {}; /**< The properties of the created asteroid. */
+    std::string payload; /**< The raw message, for messages applied as a whole. */
+    std::vector<PositionCorrection> players; /**< The positions of the players. */
+    std::vector<PositionCorrection> platforms1D; /**< The positions of the 1D moving platforms. */
+    std::vector<PositionCorrection> platforms2D; /**< The positions of the 2D moving platforms. */
+    std::vector<PositionCorrection> crushers; /**< The positions of the crushers. */
+};
+
+/**
+ * @class MessageQueue
+ * @brief Bounded lock-free multi-producer single-consumer ring of messages.
+ *
+ * Every network thread can push concurrently, only the main thread pops. The slots are allocated once at construction and
+ * a popped message is swapped with the slot, so the buffers of the messages are recycled instead of reallocated.
+ */
 class MessageQueue {
 private:
-    std::queue<std::pair<std::string, std::vector<std::string>>> queue;
-    mutable std::mutex mutex;
+    /**
+     * @struct Slot
+     * @brief Represents a cell of the ring.
+     */
+    struct Slot {
+        std::atomic<size_t> sequence; /**< The position at which the slot can be written, or read once it is one past it. */
+        Message message; /**< The message stored in the slot. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    size_t capacityMask; /**< The capacity of the ring minus one, the capacity being a power of two. */
+    std::unique_ptr<Slot[]> slots; /**< The cells of the ring. */
+    alignas(64) std::atomic<size_t> pushPosition = 0; /**< The next position to write, shared by the producers. */
+    alignas(64) std::atomic<size_t> popPosition = 0; /**< The next position to read, owned by the consumer. */
+
 
-    
 public:
-    MessageQueue() = default;
+    /* CONSTRUCTORS */
+
+    /**
+     * @brief Construct a queue able to hold a given number of messages.
+     * @param capacity The maximum number of messages waiting in the queue, rounded up to a power of two.
+     */
+    explicit MessageQueue(size_t capacity = 1024);
+
+
+    /* METHODS */
 
     /**
-     * @brief Push a message to the queue.
-     * @param message The message to push.
-     * @param parameters The parameters to push.
+     * @brief Push a message to the queue, can be called from any thread.
+     * @param message The message to push, left in an unspecified state if it was pushed.
+     * @return True if the message was pushed, false if the queue is full.
      */
-    void push(const std::string &message, const std::vector<std::string>& parameters = {});
+    bool push(Message &message);
 
     /**
-     * @brief Pop a message from the queue.
-     * @return A tuple containing the message and the parameter.
+     * @brief Pop the oldest message from the queue, must only be called from the main thread.
+     * @param[out] message The popped message, its previous buffers are kept by the queue for later messages.
+     * @return True if a message was popped, false if the queue is empty.
      */
-    std::pair<std::string, std::vector<std::string>> pop();
+    bool pop(Message &message);
 
     /**
      * @brief Check if the queue is empty.
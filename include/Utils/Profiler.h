@@ -0,0 +1,231 @@
+#ifndef PLAY_TOGETHER_PROFILER_H
+#define PLAY_TOGETHER_PROFILER_H
+
+#include <SDL.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @file Profiler.h
+ * @brief Defines the Profiler class recording the time spent in the zones of the code, and the ProfileZone class delimiting them.
+ */
+
+/**
+ * @struct ZoneSummary
+ * @brief Represents the time spent in a zone of the game thread, averaged over the last frames.
+ */
+struct ZoneSummary {
+    const char *name; /**< The name of the zone. */
+    Uint32 depth; /**< The number of zones the zone is nested in. */
+    double averageMilliseconds; /**< The time spent in the zone per frame, on average. */
+    double maxMilliseconds; /**< The longest time spent in the zone in a single frame. */
+};
+
+/**
+ * @class Profiler
+ * @brief Records the start and end of the zones executed by every thread in a ring buffer per thread.
+ *
+ * A thread only writes to its own buffer, without lock, and the oldest zones are overwritten once the buffer is full, so a
+ * capture always holds the last seconds before it is exported. The buffers are exported as a Chrome trace-event file,
+ * to be opened in chrome://tracing or Perfetto. The zones of the game thread are also summed per frame for the overlay.
+ * Nothing is recorded while neither a capture nor the overlay is running, a zone then only costs a load of a flag.
+ */
+class Profiler {
+public:
+    static constexpr size_t bufferCapacity = 1 << 16; /**< The number of zones kept per thread. */
+    static constexpr double summaryIntervalSeconds = 0.5; /**< The time between two refreshes of the overlay. */
+
+
+private:
+    /**
+     * @struct ZoneEvent
+     * @brief Represents a zone executed by a thread.
+     */
+    struct ZoneEvent {
+        const char *name; /**< The name of the zone, a string literal. */
+        Uint64 start; /**< The performance counter when the zone was entered. */
+        Uint64 end; /**< The performance counter when the zone was left. */
+        Uint32 depth; /**< The number of zones the zone is nested in. */
+    };
+
+    /**
+     * @struct ThreadBuffer
+     * @brief Represents the ring of zones written by a thread.
+     */
+    struct ThreadBuffer {
+        std::array<ZoneEvent, bufferCapacity> events; /**< The zones, the one at index n being stored at n % bufferCapacity. */
+        std::atomic<size_t> written = 0; /**< The number of zones written since the thread started recording. */
+        int threadID; /**< The ID of the thread in the trace. */
+        std::string threadName; /**< The name of the thread in the trace. */
+    };
+
+    /**
+     * @struct ZoneStats
+     * @brief Represents the time spent in a zone of the game thread since the last refresh of the overlay.
+     */
+    struct ZoneStats {
+        const char *name; /**< The name of the zone. */
+        Uint32 depth; /**< The number of zones the zone is nested in. */
+        Uint64 firstOffset; /**< The earliest time the zone was entered after the start of a frame, to list the zones in order. */
+        Uint64 frameTicks; /**< The time spent in the zone in the current frame. */
+        Uint64 totalTicks; /**< The time spent in the zone in every frame. */
+        Uint64 maxTicks; /**< The longest time spent in the zone in a frame. */
+    };
+
+
+    /* ATTRIBUTES */
+
+    static std::atomic<bool> recording; /**< True if the zones are recorded, because of a capture or the overlay. */
+    static std::atomic<bool> capturing; /**< True if a capture is running. */
+    static std::atomic<bool> overlayShown; /**< True if the overlay is drawn. */
+    static std::atomic<Uint64> captureStart; /**< The performance counter when the capture started, older zones are not exported. */
+    static std::atomic<Uint64> captureEnd; /**< The performance counter when the capture stopped, the maximum while it runs. */
+    static std::mutex buffersMutex; /**< Protects the list of buffers. */
+    static std::vector<std::unique_ptr<ThreadBuffer>> buffers; /**< The buffer of every thread that recorded a zone, kept after it exits. */
+    static thread_local ThreadBuffer *threadBuffer; /**< The buffer of the current thread, nullptr until it records a zone. */
+    static thread_local Uint32 threadDepth; /**< The number of zones the current thread is in. */
+    static thread_local std::string currentThreadName; /**< The name given to the current thread, empty if none. */
+
+    // Overlay attributes, only accessed by the game thread
+    static size_t summaryCursor; /**< The number of zones of the game thread already summed. */
+    static int summaryFrameCount; /**< The number of frames summed since the last refresh. */
+    static Uint64 summaryStart; /**< The performance counter at the last refresh. */
+    static Uint64 frameStart; /**< The performance counter at the start of the current frame. */
+    static std::vector<ZoneStats> zoneStats; /**< The time spent in each zone since the last refresh. */
+    static std::vector<ZoneSummary> zoneSummaries; /**< The time spent in each zone at the last refresh. */
+
+
+public:
+    /* ACCESSORS */
+
+    /**
+     * @brief Check if the zones are recorded.
+     * @return True if a capture or the overlay is running, false otherwise.
+     */
+    [[nodiscard]] static bool isRecording() { return recording.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Check if a capture is running.
+     * @return True if a capture is running, false otherwise.
+     */
+    [[nodiscard]] static bool isCapturing();
+
+    /**
+     * @brief Check if the overlay is drawn.
+     * @return True if the overlay is drawn, false otherwise.
+     */
+    [[nodiscard]] static bool isOverlayShown();
+
+    /**
+     * @brief Return the time spent in each zone of the game thread, the parent zones before their children.
+     * @return The zones summed at the last refresh of the overlay.
+     */
+    [[nodiscard]] static const std::vector<ZoneSummary> &getZoneSummaries();
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Name the current thread in the trace, the threads not named are called after their ID.
+     * @param name The name of the thread.
+     * @note The buffer of the thread is only created once it records a zone.
+     */
+    static void setThreadName(const std::string &name);
+
+    /**
+     * @brief Show or hide the overlay, the zones are recorded while it is shown.
+     * @param state True to show the overlay, false to hide it.
+     */
+    static void setOverlayShown(bool state);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Start a capture, the zones recorded before are discarded.
+     */
+    static void startCapture();
+
+    /**
+     * @brief Stop the capture, the zones recorded until then can still be exported.
+     */
+    static void stopCapture();
+
+    /**
+     * @brief Write the zones of the capture kept by every thread to a Chrome trace-event file, can be called from any thread.
+     * @param file_path The path of the file.
+     * @note The zones overwritten by their thread while they are read are left out.
+     * @return True if the file was written, false otherwise.
+     */
+    static bool exportTrace(const std::string &file_path);
+
+    /**
+     * @brief Sum the zones the game thread recorded since the last call, and refresh the overlay if it is time to.
+     * @note Must be called by the game thread once per frame, outside any zone.
+     */
+    static void endFrame();
+
+    /**
+     * @brief Enter a zone, called by ProfileZone.
+     */
+    static void enterZone() { threadDepth++; }
+
+    /**
+     * @brief Leave a zone and record it in the buffer of the current thread, called by ProfileZone.
+     * @param name The name of the zone.
+     * @param start The performance counter when the zone was entered.
+     * @param end The performance counter when the zone was left.
+     */
+    static void leaveZone(const char *name, Uint64 start, Uint64 end);
+
+private:
+    /**
+     * @brief Return the buffer of the current thread, creating it on the first call.
+     * @return The buffer of the current thread.
+     */
+    static ThreadBuffer &getThreadBuffer();
+
+    /**
+     * @brief Recompute the recording flag from the capture and overlay flags.
+     */
+    static void updateRecording();
+};
+
+
+/**
+ * @class ProfileZone
+ * @brief Records the time spent between its construction and its destruction as a zone of the current thread.
+ *
+ * Declare one at the start of a function or a block, the zones of a thread nest like their scopes.
+ */
+class ProfileZone {
+private:
+    /* ATTRIBUTES */
+
+    const char *name; /**< The name of the zone, a string literal. */
+    Uint64 start = 0; /**< The performance counter when the zone was entered. */
+    bool active; /**< True if the profiler was recording when the zone was entered. */
+
+
+public:
+    /* CONSTRUCTORS */
+
+    explicit ProfileZone(const char *name) : name(name), active(Profiler::isRecording()) {
+        if (!active) return;
+        Profiler::enterZone();
+        start = SDL_GetPerformanceCounter();
+    }
+
+    ProfileZone(const ProfileZone &) = delete;
+    ProfileZone &operator=(const ProfileZone &) = delete;
+
+    ~ProfileZone() {
+        if (active) Profiler::leaveZone(name, start, SDL_GetPerformanceCounter());
+    }
+};
+
+#endif //PLAY_TOGETHER_PROFILER_H
@@ -0,0 +1,62 @@
+#ifndef PLAY_TOGETHER_SIMULATIONCLOCK_H
+#define PLAY_TOGETHER_SIMULATIONCLOCK_H
+
+#include <SDL.h>
+
+/**
+ * @file SimulationClock.h
+ * @brief Defines the SimulationClock class responsible for counting the fixed steps of the game simulation.
+ */
+
+/**
+ * @class SimulationClock
+ * @brief Counts the fixed-duration steps simulated since the game started.
+ *
+ * Gameplay timers read this clock instead of the wall clock, so a simulation replayed with the same inputs gives the same results
+ * whatever the display refresh rate or the number of steps run per rendered frame.
+ */
+class SimulationClock {
+private:
+    /* ATTRIBUTES */
+
+    static Uint64 tick; /**< The number of steps simulated since the last reset. */
+
+
+public:
+    static constexpr int TICK_RATE = 60; /**< The number of simulation steps per second. */
+    static constexpr double TIME_STEP = 1.0 / TICK_RATE; /**< The duration of a simulation step in seconds. */
+
+
+    /* ACCESSORS */
+
+    /**
+     * @brief Return the number of steps simulated since the last reset.
+     * @return The current tick.
+     */
+    [[nodiscard]] static Uint64 getTick();
+
+    /**
+     * @brief Return the simulated time in milliseconds, to be used in place of SDL_GetTicks() by gameplay timers.
+     * @return The time elapsed in the simulation in milliseconds.
+     */
+    [[nodiscard]] static Uint32 getTime();
+
+
+    /* MODIFIERS */
+
+    /**
+     * @brief Move the clock to a given step, to resimulate past steps or to start from the clock of the server.
+     * @param value The new tick.
+     */
+    static void setTick(Uint64 value);
+
+
+    /* METHODS */
+
+    /**
+     * @brief Move the clock forward by one simulation step.
+     */
+    static void advance();
+};
+
+#endif //PLAY_TOGETHER_SIMULATIONCLOCK_H
@@ -0,0 +1,232 @@
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include "../include/Game/Game.h"
+#include "../include/Network/NetworkManager.h"
+#include "../include/Utils/MessageQueue.h"
+
+/**
+ * @file Bench.cpp
+ * @brief Entry point of the simulation benchmark, running scripted players on the real maps without display.
+ *
+ * Usage: play-together-bench [players] [ticks] [output]
+ *
+ * The timings of every phase, and of saving and restoring the world of a tick for the rollback, are written as JSON, in
+ * microseconds, so that runs can be compared with a baseline.
+ */
+
+constexpr int ASTEROID_COUNT = 8; /**< The number of asteroids kept in the level during the benchmark. */
+const std::array<std::string, 2> BENCHMARK_MAPS = {"diversity", "assurance"}; /**< The maps simulated, in order. */
+
+// Masks of the actions, see Mediator::encodeKeyboardStateMask()
+constexpr uint16_t UP_MASK = 1 << 1;
+constexpr uint16_t LEFT_MASK = 1 << 2;
+constexpr uint16_t RIGHT_MASK = 1 << 3;
+constexpr uint16_t DOWN_MASK = 1 << 4;
+constexpr uint16_t RUN_MASK = 1 << 5;
+constexpr uint16_t INTERACT_MASK = 1 << 6;
+
+/**
+ * @brief Return the keyboard state of a scripted player, each player follows one of four patterns shifted by its index.
+ * @param index The index of the player, from 0.
+ * @param tick The tick being simulated.
+ * @return The keyboard state mask of the player.
+ */
+static uint16_t scriptedKeyboardStateMask(int index, Uint64 tick) {
+    Uint64 time = tick + static_cast<Uint64>(index) * 17;
+    switch (index % 4) {
+        // Run to the right and jump regularly
+        case 0: return RIGHT_MASK | RUN_MASK | (time % 45 < 12 ? UP_MASK : 0);
+        // Walk back and forth
+        case 1: return time % 240 < 120 ? RIGHT_MASK : LEFT_MASK;
+        // Jump in place, pressing the levers in between
+        case 2: return time % 30 < 10 ? UP_MASK : time % 90 < 5 ? INTERACT_MASK : 0;
+        // Alternate between crouching, walking and idling
+        default: return time % 180 < 60 ? DOWN_MASK : time % 180 < 120 ? RIGHT_MASK : 0;
+    }
+}
+
+/**
+ * @brief Return a percentile of the samples, by the nearest rank method.
+ * @param sorted_values The samples, sorted in ascending order.
+ * @param percentile The percentile, between 0 and 100.
+ * @return The value of the percentile, 0 if there is no sample.
+ */
+static double percentile(const std::vector<double> &sorted_values, double percentile) {
+    if (sorted_values.empty()) return 0.0;
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted_values.size())));
+    return sorted_values[std::clamp(rank, static_cast<size_t>(1), sorted_values.size()) - 1];
+}
+
+/**
+ * @struct RollbackTimings
+ * @brief Represents the time spent saving and restoring the world of a tick, in performance counter ticks.
+ */
+struct RollbackTimings {
+    Uint64 save = 0; /**< RollbackManager::saveTick(). */
+    Uint64 restore = 0; /**< RollbackManager::restoreTick(), restoring the world just saved. */
+};
+
+/**
+ * @brief Summarize the samples of a phase.
+ * @param samples The timings of every step.
+ * @param phase The timing of the phase in a step.
+ * @return The p50, p99 and max of the phase in microseconds.
+ */
+template <typename Timings>
+static nlohmann::json summarizePhase(const std::vector<Timings> &samples, Uint64 Timings::*phase) {
+    auto frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    std::vector<double> values;
+    values.reserve(samples.size());
+    for (const Timings &sample : samples) {
+        values.push_back(static_cast<double>(sample.*phase) * 1e6 / frequency);
+    }
+    std::ranges::sort(values);
+
+    return {
+        {"p50", percentile(values, 50.0)},
+        {"p99", percentile(values, 99.0)},
+        {"max", values.empty() ? 0.0 : values.back()}
+    };
+}
+
+/**
+ * @brief Load a map, spawn the scripted players and simulate it.
+ * @param game The game to run the map in.
+ * @param map_name The name of the map.
+ * @param player_count The number of scripted players.
+ * @param tick_count The number of steps to simulate.
+ * @return The results of the map.
+ */
+static nlohmann::json benchmarkMap(Game &game, const std::string &map_name, int player_count, int tick_count) {
+    game.setLevel(map_name);
+    Level *level = game.getLevel();
+    PlayerManager &playerManager = game.getPlayerManager();
+
+    // Start from an empty world at the first checkpoint
+    playerManager.getAlivePlayers().clear();
+    playerManager.getNeutralPlayers().clear();
+    playerManager.getDeadPlayers().clear();
+    SimulationClock::setTick(0);
+
+    if (!level->getZones(AABBType::RESCUE).empty()) playerManager.setCurrentRescueZone(level->getZones(AABBType::RESCUE)[0]);
+    std::array<Point, 4> spawnPoints = level->getSpawnPoints(level->getLastCheckpoint());
+    game.getCamera()->initializePosition(spawnPoints[0]);
+
+    for (int index = 0; index < player_count; index++) {
+        Player player(index + 1, spawnPoints[static_cast<size_t>(index) % spawnPoints.size()], 2);
+        player.setSpriteTextureByID(index % 4 + 1);
+        playerManager.addPlayer(player);
+    }
+
+    // Every tick is saved as with rollback, then restored, which leaves the world as it was saved
+    RollbackManager &rollbackManager = game.getRollbackManager();
+    std::vector<StepTimings> samples(static_cast<size_t>(tick_count));
+    std::vector<RollbackTimings> rollbackSamples(static_cast<size_t>(tick_count));
+    for (size_t i = 0; i < samples.size(); i++) {
+        Uint64 tick = SimulationClock::getTick();
+        for (int index = 0; index < player_count; index++) {
+            if (Player *playerPtr = playerManager.findPlayerById(index + 1)) {
+                Mediator::applyKeyboardStateMask(playerPtr, scriptedKeyboardStateMask(index, tick));
+            }
+        }
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        rollbackManager.saveTick();
+        Uint64 saved = SDL_GetPerformanceCounter();
+        rollbackManager.restoreTick(tick);
+        rollbackSamples[i] = {saved - start, SDL_GetPerformanceCounter() - saved};
+
+        game.benchmarkUpdate(SimulationClock::TIME_STEP, ASTEROID_COUNT, samples[i]);
+    }
+
+    std::cout << "Bench: " << map_name << " simulated for " << tick_count << " ticks, "
+              << playerManager.getAlivePlayers().size() << " players alive at the end" << std::endl;
+
+    return {
+        {"map", map_name},
+        {"phases", {
+            {"playersMovement", summarizePhase(samples, &StepTimings::playersMovement)},
+            {"applyPlatformsMovement", summarizePhase(samples, &StepTimings::platformsMovement)},
+            {"broadPhase", summarizePhase(samples, &StepTimings::broadPhase)},
+            {"handleAsteroidsCollisions", summarizePhase(samples, &StepTimings::asteroidsCollisions)},
+            {"handleCollisions", summarizePhase(samples, &StepTimings::playersCollisions)},
+            {"tick", summarizePhase(samples, &StepTimings::total)}
+        }},
+        {"rollback", {
+            {"saveTick", summarizePhase(rollbackSamples, &RollbackTimings::save)},
+            {"restoreTick", summarizePhase(rollbackSamples, &RollbackTimings::restore)}
+        }}
+    };
+}
+
+int main(int argc, char *args[]) {
+    // Read the number of players, the number of ticks and the output file from the command line
+    int playerCount = 8;
+    int tickCount = 3600;
+    std::string outputPath = "bench.json";
+    try {
+        if (argc > 1) playerCount = std::stoi(args[1]);
+        if (argc > 2) tickCount = std::stoi(args[2]);
+        if (argc > 3) outputPath = args[3];
+    } catch (const std::exception &) {
+        playerCount = 0;
+    }
+    if (playerCount <= 0 || tickCount <= 0) {
+        std::cerr << "Usage: " << args[0] << " [players] [ticks] [output]" << std::endl;
+        return 1;
+    }
+
+    // Initialize SDL without the video and audio subsystems
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) < 0) {
+        std::cerr << "Error initializing SDL2: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    // The textures giving the size of the levers and crushers are decoded by a software renderer drawing into a 1x1 surface
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 1, 1, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDL_Renderer *renderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (renderer == nullptr) {
+        std::cerr << "Could not create software renderer: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(surface);
+        SDL_Quit();
+        return 1;
+    }
+
+    // Initialize game objects, the network manager is never started
+    std::atomic<bool> quit = false;
+
+    MessageQueue messageQueue;
+    Game game(nullptr, renderer, SimulationClock::TICK_RATE, &quit, &messageQueue);
+    NetworkManager networkManager;
+
+    Mediator::setMessageQueuePtr(&messageQueue);
+    Mediator::setGamePtr(&game);
+    Mediator::setNetworkManagerPtr(&networkManager);
+
+    Asteroid::generateRandomAnglesArray(200, 0);
+    Asteroid::generateRandomPositionsArray(200, 0, game.getCamera()->getW(), 0);
+
+    nlohmann::json results = {
+        {"players", playerCount},
+        {"ticks", tickCount},
+        {"unit", "us"},
+        {"maps", nlohmann::json::array()}
+    };
+    for (const std::string &mapName : BENCHMARK_MAPS) {
+        results["maps"].push_back(benchmarkMap(game, mapName, playerCount, tickCount));
+    }
+
+    // Write the results, also shown on the standard output
+    std::ofstream output(outputPath);
+    output << results.dump(4) << std::endl;
+    std::cout << results.dump(4) << std::endl;
+    if (!output) std::cerr << "Bench: Could not write the results to " << outputPath << std::endl;
+
+    /* Clean up resources */
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    SDL_Quit();
+    return 0;
+}
@@ -32,8 +32,8 @@ float Camera::getH() const {
     return h;
 }
 
-Point Camera::getRenderingPoint() const {
-    return {x + shakeX, y + shakeY};
+Point Camera::getRenderingPoint(float interpolation) const {
+    return {std::lerp(previousX, x, interpolation) + shakeX, std::lerp(previousY, y, interpolation) + shakeY};
 }
 
 SDL_FRect Camera::getBoundingBox() const {
@@ -53,22 +53,33 @@ std::vector<Point> Camera::getBroadPhaseAreaVertices() const {
     };
 }
 
+CameraState Camera::getState() const {
+    return {x, y};
+}
+
 
 /* MODIFIERS */
 
 void Camera::setX(float val) {
     x = val;
+    previousX = val;
 }
 
 void Camera::setY(float val) {
     y = val;
+    previousY = val;
+}
+
+void Camera::setState(const CameraState &state) {
+    setX(state.x);
+    setY(state.y);
 }
 
 void Camera::setShake(int time, float amplitude) {
     // Change shakeTime only if the new time is greater
     if (time > shakeTime || time < 0) {
         shakeTime = time;
-        lastShakeUpdate = SDL_GetTicks();
+        lastShakeUpdate = SimulationClock::getTime();
         shakeAmplitude = amplitude;
     }
 }
@@ -97,6 +108,9 @@ void Camera::initializePosition(Point camera_point) {
     else if (camera_point.y < y + area.y) {
         y -= (y + area.y) - camera_point.y;
     }
+
+    previousX = x;
+    previousY = y;
 }
 
 void Camera::makeCameraShake() {
@@ -116,8 +130,8 @@ void Camera::checkShake() {
     // Shake for a given time
     if (shakeTime > 0) {
         makeCameraShake();
-        shakeTime -= static_cast<int>(SDL_GetTicks() - lastShakeUpdate);
-        lastShakeUpdate = SDL_GetTicks();
+        shakeTime -= static_cast<int>(SimulationClock::getTime() - lastShakeUpdate);
+        lastShakeUpdate = SimulationClock::getTime();
         if (shakeTime < 0) shakeTime = 0;
     }
     // Shake indefinitely
@@ -127,6 +141,10 @@ void Camera::checkShake() {
 }
 
 void Camera::applyMovement(Point camera_point, double delta_time) {
+    ProfileZone zone("Camera::applyMovement");
+    previousX = x;
+    previousY = y;
+
     auto blend = static_cast<float>(1.0f - std::pow(0.5F, delta_time * lerpSmoothingFactor));
 
     float area_left = x + area.x;
@@ -152,8 +170,6 @@ void Camera::applyMovement(Point camera_point, double delta_time) {
     else if (camera_point.y < area_top) {
         y += (camera_point.y - area_top) * blend - 0.1F;
     }
-
-    checkShake();
 }
 
 void Camera::renderCameraPoint(SDL_Renderer *renderer, Point camera_point) const {
@@ -0,0 +1,414 @@
+#include "../../include/Game/CompiledLevel.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * @file CompiledLevel.cpp
+ * @brief Implements the CompiledLevel class mapping a compiled level in memory and its converter from the JSON maps.
+ */
+
+/**
+ * @brief The JSON files a compiled level is built from, an older compiled level is ignored.
+ */
+static constexpr std::array<const char*, 8> SOURCE_FILES = {
+    "level.json", "environment.json", "polygons.json", "aabbs.json",
+    "platforms.json", "traps.json", "levers.json", "items.json"
+};
+
+
+/* CONSTRUCTORS */
+
+CompiledLevel::~CompiledLevel() {
+    close();
+}
+
+
+/* ACCESSORS */
+
+std::string_view CompiledLevel::getString(CompiledString string) const {
+    std::span<const char> characters = getSection<char>(LevelSection::STRINGS);
+    if (string.offset > characters.size() || string.length > characters.size() - string.offset) return {};
+    return {characters.data() + string.offset, string.length};
+}
+
+const CompiledLevelHeader &CompiledLevel::header() const {
+    return *reinterpret_cast<const CompiledLevelHeader*>(data);
+}
+
+
+/* METHODS */
+
+bool CompiledLevel::open(const std::string &map_directory) {
+    close();
+    namespace fs = std::filesystem;
+    std::error_code error;
+    fs::path file_path = fs::path(map_directory) / COMPILED_LEVEL_FILE;
+
+    fs::file_time_type compiled_time = fs::last_write_time(file_path, error);
+    if (error) return false;
+
+    // A map edited since it was compiled is read from its JSON files
+    for (const char *source : SOURCE_FILES) {
+        fs::file_time_type source_time = fs::last_write_time(fs::path(map_directory) / source, error);
+        if (!error && source_time > compiled_time) {
+            std::cout << "CompiledLevel: " << file_path.string() << " is older than " << source << ", it is ignored." << std::endl;
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(file_path.string().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    fileHandle = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(CompiledLevelHeader))) {
+        close();
+        return false;
+    }
+
+    mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        close();
+        return false;
+    }
+
+    data = static_cast<const std::byte*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    int file = ::open(file_path.c_str(), O_RDONLY);
+    if (file < 0) return false;
+
+    struct stat file_stat = {};
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(CompiledLevelHeader))) {
+        ::close(file);
+        return false;
+    }
+
+    // The mapping stays valid once the descriptor is closed
+    void *mapping = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping == MAP_FAILED) return false;
+
+    data = static_cast<const std::byte*>(mapping);
+    size = static_cast<size_t>(file_stat.st_size);
+#endif
+
+    if (data == nullptr || !validate()) {
+        std::cerr << "CompiledLevel: " << file_path.string() << " is invalid or of another version, it is ignored." << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CompiledLevel::close() {
+#ifdef _WIN32
+    if (data != nullptr) UnmapViewOfFile(data);
+    if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+    if (fileHandle != nullptr) CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (data != nullptr) munmap(const_cast<std::byte*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool CompiledLevel::validate() const {
+    // The records are read in place, their fields are written in little-endian order
+    if constexpr (std::endian::native != std::endian::little) return false;
+
+    const CompiledLevelHeader &file_header = header();
+    if (file_header.magic != COMPILED_LEVEL_MAGIC || file_header.version != COMPILED_LEVEL_VERSION) return false;
+    if (file_header.fileSize != size) return false;
+
+    for (const CompiledSectionEntry &entry : file_header.sections) {
+        if (entry.offset % 4 != 0 || entry.offset < sizeof(CompiledLevelHeader) || entry.offset > size) return false;
+        if (entry.recordSize != 0 && entry.count > (size - entry.offset) / entry.recordSize) return false;
+    }
+    return true;
+}
+
+
+/* CONVERTER */
+
+/**
+ * @brief Read a JSON file of a map.
+ * @param map_directory The directory of the map.
+ * @param file_name The name of the file.
+ * @param[out] json The parsed content.
+ * @return True if the file is read and parsed, false otherwise.
+ */
+static bool readJson(const std::string &map_directory, const char *file_name, nlohmann::json &json) {
+    std::ifstream file(map_directory + file_name);
+    if (!file.is_open()) {
+        std::cerr << "CompiledLevel: Unable to open " << map_directory << file_name << std::endl;
+        return false;
+    }
+
+    json = nlohmann::json::parse(file, nullptr, false);
+    if (json.is_discarded()) {
+        std::cerr << "CompiledLevel: Unable to parse " << map_directory << file_name << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Return a collection of a JSON file, a map may leave out its empty collections.
+ * @param json The content of the file.
+ * @param key The name of the collection.
+ * @return The array of the collection, an empty array if it is missing.
+ */
+static const nlohmann::json &collection(const nlohmann::json &json, const char *key) {
+    static const nlohmann::json empty = nlohmann::json::array();
+    auto it = json.find(key);
+    return it == json.end() ? empty : *it;
+}
+
+/**
+ * @brief Append the indices of the objects switched by a lever, after checking them.
+ * @param ids The JSON array of indices.
+ * @param object_count The number of objects of the switched collection.
+ * @param[out] targets The TARGETS section.
+ * @param[out] first The index of the first target appended.
+ * @param[out] count The number of targets appended.
+ * @return True if every index is in range, false otherwise.
+ */
+static bool appendTargets(const nlohmann::json &ids, size_t object_count, std::vector<uint32_t> &targets, uint32_t &first, uint32_t &count) {
+    first = static_cast<uint32_t>(targets.size());
+    count = static_cast<uint32_t>(ids.size());
+    for (const auto &id : ids) {
+        size_t index = id.get<size_t>();
+        if (index >= object_count) return false;
+        targets.push_back(static_cast<uint32_t>(index));
+    }
+    return true;
+}
+
+bool CompiledLevel::compile(const std::string &map_directory) {
+    if constexpr (std::endian::native != std::endian::little) {
+        std::cerr << "CompiledLevel: Levels can only be compiled on a little-endian machine." << std::endl;
+        return false;
+    }
+
+    std::array<nlohmann::json, SOURCE_FILES.size()> files;
+    for (size_t i = 0; i < SOURCE_FILES.size(); i++) {
+        if (!readJson(map_directory, SOURCE_FILES[i], files[i])) return false;
+    }
+    const auto &[level, environment, polygons, aabbs, platforms, traps, levers, items] = files;
+
+    CompiledProperties properties = {};
+    std::vector<char> strings;
+    std::vector<CompiledString> musics;
+    std::vector<Point> spawn_points;
+    std::vector<CompiledLayer> layers;
+    std::vector<CompiledPolygon> polygon_records;
+    std::vector<Point> vertices;
+    std::vector<Point> edge_normals;
+    std::vector<Projection> projections;
+    std::vector<CompiledAABB> aabb_records;
+    std::vector<CompiledMovingPlatform1D> moving_platforms_1D;
+    std::vector<CompiledMovingPlatform2D> moving_platforms_2D;
+    std::vector<CompiledSwitchingPlatform> switching_platforms;
+    std::vector<Point> steps;
+    std::vector<CompiledWeightPlatform> weight_platforms;
+    std::vector<CompiledTreadmill> treadmills;
+    std::vector<CompiledCrusher> crushers;
+    std::vector<CompiledLever> treadmill_levers;
+    std::vector<CompiledLever> platform_levers;
+    std::vector<CompiledLever> crusher_levers;
+    std::vector<uint32_t> targets;
+    std::vector<CompiledPowerUp> size_power_ups;
+    std::vector<CompiledPowerUp> speed_power_ups;
+    std::vector<CompiledCoin> coins;
+
+    auto addString = [&strings](const std::string &string) {
+        CompiledString reference = {static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(string.size())};
+        strings.insert(strings.end(), string.begin(), string.end());
+        return reference;
+    };
+
+    try {
+        // Properties
+        properties.worldID = level.at("worldID");
+        properties.mapID = level.at("levelID");
+        properties.name = addString(level.at("name").get<std::string>());
+        properties.nextMap = addString(level.value("nextMap", ""));
+        for (const auto &music : collection(level, "musics")) musics.push_back(addString(music.get<std::string>()));
+        for (const auto &spawn_point : collection(level, "spawnPoints")) {
+            if (spawn_point.size() != 4) {
+                std::cerr << "CompiledLevel: Every checkpoint needs 4 spawn points." << std::endl;
+                return false;
+            }
+            for (const auto &point : spawn_point) spawn_points.push_back({point.at(0), point.at(1)});
+        }
+
+        // Environment
+        for (const auto &layer : collection(environment, "backgroundLayers")) layers.push_back({layer.at("textureID"), layer.at("layerIndex"), 0});
+        for (const auto &layer : collection(environment, "foregroundLayers")) layers.push_back({layer.at("textureID"), layer.at("layerIndex"), 1});
+
+        // Polygons, baked by the same code as the JSON loading
+        using enum PolygonType;
+        constexpr std::array<std::pair<const char*, PolygonType>, 7> polygon_zones = {{
+            {"collisionZones", COLLISION}, {"iceZones", ICE}, {"sandZones", SAND}, {"deathZones", DEATH},
+            {"cinematicZones", CINEMATIC}, {"bossZones", BOSS}, {"eventZones", EVENT}
+        }};
+        for (const auto &[zone_name, type] : polygon_zones) {
+            for (const auto &zone : collection(polygons, zone_name)) {
+                std::vector<Point> zone_vertices;
+                for (const auto &vertex : zone) zone_vertices.push_back({vertex.at(0), vertex.at(1)});
+                Polygon polygon(zone_vertices, type);
+
+                polygon_records.push_back({static_cast<uint32_t>(type), static_cast<uint32_t>(vertices.size()),
+                                           static_cast<uint32_t>(zone_vertices.size()), polygon.isConvex() ? 1u : 0u,
+                                           polygon.getBoundingBox()});
+                vertices.insert(vertices.end(), zone_vertices.begin(), zone_vertices.end());
+                edge_normals.insert(edge_normals.end(), polygon.getEdgeNormals().begin(), polygon.getEdgeNormals().end());
+                projections.insert(projections.end(), polygon.getProjections().begin(), polygon.getProjections().end());
+            }
+        }
+
+        // AABBs
+        using enum AABBType;
+        constexpr std::array<std::pair<const char*, AABBType>, 4> aabb_zones = {{
+            {"saveZones", SAVE}, {"rescueZones", RESCUE}, {"toggleGravityZones", TOGGLE_GRAVITY}, {"increaseFallSpeedZones", INCREASE_FALL_SPEED}
+        }};
+        for (const auto &[zone_name, type] : aabb_zones) {
+            for (const auto &zone : collection(aabbs, zone_name)) {
+                aabb_records.push_back({static_cast<uint32_t>(type), {zone.at("x"), zone.at("y"), zone.at("width"), zone.at("height")}});
+            }
+        }
+
+        // Platforms
+        for (const auto &platform : collection(platforms, "movingPlatforms1D")) {
+            moving_platforms_1D.push_back({platform.at("x"), platform.at("y"), platform.at("size"), platform.at("speed"),
+                                           platform.at("min"), platform.at("max"), platform.at("start").get<bool>() ? 1u : 0u,
+                                           platform.at("axis").get<bool>() ? 1u : 0u, platform.at("texture")});
+        }
+        for (const auto &platform : collection(platforms, "movingPlatforms2D")) {
+            moving_platforms_2D.push_back({platform.at("x"), platform.at("y"), platform.at("size"), platform.at("speed"),
+                                           {platform.at("left").at(0), platform.at("left").at(1)},
+                                           {platform.at("right").at(0), platform.at("right").at(1)},
+                                           platform.at("start").get<bool>() ? 1u : 0u, platform.at("texture")});
+        }
+        for (const auto &platform : collection(platforms, "switchingPlatforms")) {
+            auto first_step = static_cast<uint32_t>(steps.size());
+            for (const auto &step : platform.at("steps")) steps.push_back({step.at(0), step.at(1)});
+            switching_platforms.push_back({platform.at("x"), platform.at("y"), platform.at("size"), platform.at("bpm"),
+                                           first_step, static_cast<uint32_t>(steps.size()) - first_step, platform.at("texture")});
+        }
+        for (const auto &platform : collection(platforms, "weightPlatforms")) {
+            weight_platforms.push_back({platform.at("x"), platform.at("y"), platform.at("size"), platform.at("stepDistance"), platform.at("texture")});
+        }
+        for (const auto &treadmill : collection(platforms, "treadmills")) {
+            treadmills.push_back({treadmill.at("x"), treadmill.at("y"), treadmill.at("size"), treadmill.at("speed"),
+                                  treadmill.at("direction"), treadmill.at("spriteSpeed")});
+        }
+
+        // Traps
+        for (const auto &crusher : collection(traps, "crushers")) {
+            crushers.push_back({crusher.at("x"), crusher.at("y"), crusher.at("size"), crusher.at("min"), crusher.at("max"),
+                                crusher.at("moveUpTime"), crusher.at("waitUpTime"), crusher.at("waitDownTime"), crusher.at("texture")});
+        }
+
+        // Levers, the objects they switch must exist
+        bool targets_valid = true;
+        for (const auto &lever : collection(levers, "treadmillLevers")) {
+            CompiledLever record = {lever.at("x"), lever.at("y"), lever.at("size"), lever.at("isActivated").get<bool>() ? 1u : 0u, lever.at("type"), 0, 0, 0, 0};
+            targets_valid &= appendTargets(lever.at("platformsID"), treadmills.size(), targets, record.firstTarget, record.targetCount);
+            treadmill_levers.push_back(record);
+        }
+        for (const auto &lever : collection(levers, "platformLevers")) {
+            CompiledLever record = {lever.at("x"), lever.at("y"), lever.at("size"), lever.at("isActivated").get<bool>() ? 1u : 0u, 0, 0, 0, 0, 0};
+            targets_valid &= appendTargets(lever.at("1DMovingPlatformsID"), moving_platforms_1D.size(), targets, record.firstTarget, record.targetCount);
+            targets_valid &= appendTargets(lever.at("2DMovingPlatformsID"), moving_platforms_2D.size(), targets, record.firstSecondTarget, record.secondTargetCount);
+            platform_levers.push_back(record);
+        }
+        for (const auto &lever : collection(levers, "crusherLevers")) {
+            CompiledLever record = {lever.at("x"), lever.at("y"), lever.at("size"), lever.at("isActivated").get<bool>() ? 1u : 0u, 0, 0, 0, 0, 0};
+            targets_valid &= appendTargets(lever.at("crushersID"), crushers.size(), targets, record.firstTarget, record.targetCount);
+            crusher_levers.push_back(record);
+        }
+        if (!targets_valid) {
+            std::cerr << "CompiledLevel: A lever switches an object missing from the map." << std::endl;
+            return false;
+        }
+
+        // Items
+        for (const auto &item : collection(items, "sizePowerUp")) {
+            size_power_ups.push_back({{item.at("x"), item.at("y"), item.at("width"), item.at("height")}, item.at("grow").get<bool>() ? 1u : 0u});
+        }
+        for (const auto &item : collection(items, "speedPowerUp")) {
+            speed_power_ups.push_back({{item.at("x"), item.at("y"), item.at("width"), item.at("height")}, item.at("fast").get<bool>() ? 1u : 0u});
+        }
+        for (const auto &item : collection(items, "coins")) {
+            coins.push_back({{item.at("x"), item.at("y"), item.at("width"), item.at("height")}, item.at("value")});
+        }
+    } catch (const nlohmann::json::exception &e) {
+        std::cerr << "CompiledLevel: Invalid map " << map_directory << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    // Lay the sections out after the header, each one aligned on 4 bytes
+    CompiledLevelHeader file_header = {COMPILED_LEVEL_MAGIC, COMPILED_LEVEL_VERSION, 0, {}};
+    std::vector<std::byte> content(sizeof(CompiledLevelHeader));
+    auto addSection = [&file_header, &content](LevelSection section, const void *records, size_t count, size_t record_size) {
+        content.resize((content.size() + 3) & ~size_t(3));
+        file_header.sections[static_cast<size_t>(section)] = {static_cast<uint32_t>(content.size()), static_cast<uint32_t>(count), static_cast<uint32_t>(record_size)};
+        const auto *bytes = static_cast<const std::byte*>(records);
+        content.insert(content.end(), bytes, bytes + count * record_size);
+    };
+    auto add = [&addSection]<typename T>(LevelSection section, const std::vector<T> &records) {
+        addSection(section, records.data(), records.size(), sizeof(T));
+    };
+
+    using enum LevelSection;
+    addSection(PROPERTIES, &properties, 1, sizeof(CompiledProperties));
+    add(STRINGS, strings);
+    add(MUSICS, musics);
+    add(SPAWN_POINTS, spawn_points);
+    add(LAYERS, layers);
+    add(POLYGONS, polygon_records);
+    add(VERTICES, vertices);
+    add(EDGE_NORMALS, edge_normals);
+    add(PROJECTIONS, projections);
+    add(AABBS, aabb_records);
+    add(MOVING_PLATFORMS_1D, moving_platforms_1D);
+    add(MOVING_PLATFORMS_2D, moving_platforms_2D);
+    add(SWITCHING_PLATFORMS, switching_platforms);
+    add(STEPS, steps);
+    add(WEIGHT_PLATFORMS, weight_platforms);
+    add(TREADMILLS, treadmills);
+    add(CRUSHERS, crushers);
+    add(TREADMILL_LEVERS, treadmill_levers);
+    add(PLATFORM_LEVERS, platform_levers);
+    add(CRUSHER_LEVERS, crusher_levers);
+    add(TARGETS, targets);
+    add(SIZE_POWER_UPS, size_power_ups);
+    add(SPEED_POWER_UPS, speed_power_ups);
+    add(COINS, coins);
+
+    content.resize((content.size() + 3) & ~size_t(3));
+    file_header.fileSize = static_cast<uint32_t>(content.size());
+    std::memcpy(content.data(), &file_header, sizeof(CompiledLevelHeader));
+
+    std::string file_path = map_directory + COMPILED_LEVEL_FILE;
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()))) {
+        std::cerr << "CompiledLevel: Unable to write " << file_path << std::endl;
+        return false;
+    }
+
+    std::cout << "CompiledLevel: Compiled " << file_path << " (" << content.size() << " bytes)." << std::endl;
+    return true;
+}
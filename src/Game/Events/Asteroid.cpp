@@ -18,13 +18,15 @@ std::vector<float> Asteroid::positions;
 
 // Constructor for Asteroid class with default parameters
 Asteroid::Asteroid(float x, float y, size_t seed): x(x + Asteroid::getRandomPosition(seed)), y(y - 60), speed(0.6f) {
+    previousX = this->x;
+    previousY = this->y;
     angle = getRandomAngle(seed);
     sprite = Sprite(*spriteTexturePtr, Asteroid::idle, 64, 64); // Initialize sprite with default animation
 }
 
 // Constructor for Asteroid class with specified parameters
 Asteroid::Asteroid(float x, float y, float speed, float h, float w, float angle)
-        : x(x), y(y), h(h), w(w), speed(speed), angle(angle) {
+        : x(x), y(y), previousX(x), previousY(y), h(h), w(w), speed(speed), angle(angle) {
     sprite = Sprite(*spriteTexturePtr, Asteroid::idle, 64, 64); // Initialize sprite with default animation
 }
 
@@ -75,15 +77,21 @@ std::vector<Point> Asteroid::getVertices() const {
     };
 }
 
+AsteroidState Asteroid::getState() const {
+    return {x, y, previousX, previousY, h, w, speed, horizontalSpeed, verticalSpeed, angle, angle_radians};
+}
+
 
 /* MODIFIERS */
 
 void Asteroid::setX(float val) {
     x = val;
+    previousX = val; // Do not interpolate the jump to the new position
 }
 
 void Asteroid::setY(float val) {
     y = val;
+    previousY = val; // Do not interpolate the jump to the new position
 }
 
 void Asteroid::setW(float val) {
@@ -98,12 +106,38 @@ void Asteroid::setAngle(float val) {
     angle = val;
 }
 
+void Asteroid::setState(const AsteroidState &state) {
+    x = state.x;
+    y = state.y;
+    previousX = state.previousX;
+    previousY = state.previousY;
+    h = state.h;
+    w = state.w;
+    speed = state.speed;
+    horizontalSpeed = state.horizontalSpeed;
+    verticalSpeed = state.verticalSpeed;
+    angle = state.angle;
+    angle_radians = state.angle_radians;
+}
+
 
 /* METHODS */
 
-bool Asteroid::loadTextures(SDL_Renderer &renderer) {
+void Asteroid::respawn(float x_start, float y_start, size_t seed) {
+    x = x_start + getRandomPosition(seed);
+    y = y_start - 60;
+    previousX = x;
+    previousY = y;
+    h = 80;
+    w = 80;
+    speed = 0.6f;
+    angle = getRandomAngle(seed);
+    sprite = Sprite(*spriteTexturePtr, Asteroid::idle, 64, 64); // Restart the default animation
+}
+
+bool Asteroid::loadTextures(SDL_Renderer &renderer, TextureAtlas &atlas) {
     // Load asteroid sprite texture
-    spriteTexturePtr = IMG_LoadTexture(&renderer, "assets/sprites/asteroid/asteroid.png");
+    spriteTexturePtr = atlas.loadTexture(renderer, "assets/sprites/asteroid/asteroid.png");
 
     // Check for errors
     if (spriteTexturePtr == nullptr) {
@@ -113,20 +147,23 @@ bool Asteroid::loadTextures(SDL_Renderer &renderer) {
     return true; // Return success
 }
 
-void Asteroid::render(SDL_Renderer *renderer, Point camera) {
+void Asteroid::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) {
     sprite.updateAnimation(); // Update sprite animation
     SDL_Rect srcRect = sprite.getSrcRect();
-    SDL_FRect asteroidRect = {x - camera.x, y - camera.y, w, h};
-    SDL_RenderCopyExF(renderer, sprite.getTexture(), &srcRect, &asteroidRect, angle, nullptr, sprite.getFlip());
+    SDL_FRect asteroidRect = {std::lerp(previousX, x, interpolation) - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
+    RenderQueue::draw(RenderLayer::ASTEROIDS, sprite.getTexture(), srcRect, asteroidRect, angle, sprite.getFlip());
 }
 
-void Asteroid::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Asteroid::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     SDL_SetRenderDrawColor(renderer, 173, 79, 9, 255);
-    SDL_FRect asteroid_rect = {x - camera.x, y - camera.y, w, h};
+    SDL_FRect asteroid_rect = {std::lerp(previousX, x, interpolation) - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
     SDL_RenderFillRectF(renderer, &asteroid_rect);
 }
 
 void Asteroid::applyMovement(double delta_time) {
+    previousX = x;
+    previousY = y;
+
     angle_radians = static_cast<float>(angle * (M_PI / 180)); // Convert the angle to radians
 
     // Calculate horizontal and vertical speeds
@@ -0,0 +1,101 @@
+#include "../../../include/Game/Events/AsteroidPool.h"
+
+/**
+ * @file AsteroidPool.cpp
+ * @brief Implements the AsteroidPool class holding the asteroids of a level.
+ */
+
+
+/* CONSTRUCTORS */
+
+AsteroidPool::AsteroidPool() {
+    slots.reserve(capacity);
+}
+
+AsteroidPool::AsteroidPool(const AsteroidPool &other) : AsteroidPool() {
+    *this = other;
+}
+
+AsteroidPool &AsteroidPool::operator=(const AsteroidPool &other) {
+    if (this == &other) return *this;
+
+    // Overwrite the slots already constructed, only construct the missing ones
+    size_t reused_count = std::min(slots.size(), other.count);
+    std::copy(other.slots.begin(), other.slots.begin() + static_cast<std::ptrdiff_t>(reused_count), slots.begin());
+    for (size_t i = reused_count; i < other.count; i++) slots.push_back(other.slots[i]);
+    count = other.count;
+    return *this;
+}
+
+
+/* ACCESSORS */
+
+size_t AsteroidPool::size() const {
+    return count;
+}
+
+Asteroid &AsteroidPool::operator[](size_t index) {
+    return slots[index];
+}
+
+const Asteroid &AsteroidPool::operator[](size_t index) const {
+    return slots[index];
+}
+
+Asteroid *AsteroidPool::begin() {
+    return slots.data();
+}
+
+Asteroid *AsteroidPool::end() {
+    return slots.data() + count;
+}
+
+const Asteroid *AsteroidPool::begin() const {
+    return slots.data();
+}
+
+const Asteroid *AsteroidPool::end() const {
+    return slots.data() + count;
+}
+
+
+/* METHODS */
+
+Asteroid *AsteroidPool::spawn(float x, float y, size_t seed) {
+    Asteroid *slot = acquire();
+    if (slot != nullptr) slot->respawn(x, y, seed);
+    return slot;
+}
+
+Asteroid *AsteroidPool::spawn(const Asteroid &asteroid) {
+    Asteroid *slot = acquire();
+    if (slot != nullptr) *slot = asteroid;
+    return slot;
+}
+
+void AsteroidPool::remove(size_t index) {
+    count--;
+    if (index != count) std::swap(slots[index], slots[count]);
+}
+
+void AsteroidPool::clear() {
+    count = 0;
+}
+
+void AsteroidPool::saveState(std::vector<AsteroidState> &states) const {
+    states.clear();
+    for (const Asteroid &asteroid : *this) states.push_back(asteroid.getState());
+}
+
+void AsteroidPool::restoreState(const std::vector<AsteroidState> &states) {
+    count = 0;
+    for (const AsteroidState &state : states) {
+        if (Asteroid *slot = acquire()) slot->setState(state);
+    }
+}
+
+Asteroid *AsteroidPool::acquire() {
+    if (count == capacity) return nullptr;
+    if (count == slots.size()) slots.emplace_back(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+    return &slots[count++];
+}
@@ -8,7 +8,7 @@
 
 /* CONSTRUCTORS */
 
-Game::Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quitFlag, MessageQueue *messageQueue)
+Game::Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, std::atomic<bool> *quitFlag, MessageQueue *messageQueue)
         : window(window), renderer(renderer), frameRate(frameRate), quitFlagPtr(quitFlag), messageQueue(messageQueue) {
 
     // Initialize managers
@@ -20,6 +20,9 @@ Game::Game(SDL_Window *window, SDL_Renderer *renderer, int frameRate, bool *quit
     playerManager = std::make_unique<PlayerManager>(this);
     playerCollisionManager = std::make_unique<PlayerCollisionManager>(this);
     eventCollisionManager = std::make_unique<EventCollisionManager>(this);
+    predictionManager = std::make_unique<PredictionManager>(this);
+    rollbackManager = std::make_unique<RollbackManager>(this);
+    levelPreloader = std::make_unique<LevelPreloader>(this);
 
     // Create the game seed
     std::random_device rd;
@@ -57,6 +60,18 @@ BroadPhaseManager &Game::getBroadPhaseManager() {
     return *broadPhaseManager;
 }
 
+PredictionManager &Game::getPredictionManager() {
+    return *predictionManager;
+}
+
+RollbackManager &Game::getRollbackManager() {
+    return *rollbackManager;
+}
+
+LevelPreloader &Game::getLevelPreloader() {
+    return *levelPreloader;
+}
+
 Camera *Game::getCamera() {
     return &camera;
 }
@@ -79,7 +94,12 @@ Uint32 Game::getPlaytime() {
 /* MODIFIERS */
 
 void Game::setLevel(std::string const &map_name) {
+    // Only the images not preloaded in the background are read during the switch
+    levelPreloader->finish(map_name);
     level = Level(map_name, renderer, textureManager.get());
+    textureManager->clearPreloadedImages();
+    broadPhaseManager->clear();
+    rollbackManager->clear();
 }
 
 void Game::setFrameRate(int fps) {
@@ -101,6 +121,8 @@ void Game::initializeHostedGame(int slot) {
     if (!saveManager->loadGameState()) {
         setPlaytime(0);
         level = Level("diversity", renderer, textureManager.get());
+        broadPhaseManager->clear();
+        rollbackManager->clear();
         std::cout << "Game: No save file found in slot " << slot << ", starting new game at level: " << level.getMapName() << std::endl;
     }
 
@@ -117,8 +139,11 @@ void Game::initializeHostedGame(int slot) {
     Asteroid::generateRandomAnglesArray(200, seed);
     Asteroid::generateRandomPositionsArray(200, 0, camera.getW(), seed);
 
+    // The dedicated server has no player of its own, only the clients play
+#ifndef HEADLESS
     initialPlayer.setSpriteTextureByID(2);
     playerManager->addPlayer(initialPlayer);
+#endif
 }
 
 using json = nlohmann::json;
@@ -189,82 +214,87 @@ void Game::loadLevel(const std::string &map_name, short last_checkpoint, const j
 }
 
 void Game::update(double delta_time) {
-    inputManager->handleKeyboardEvents();
-    calculatePlayersMovement(delta_time);
-    if (level.applyTrapsMovement(delta_time)) camera.setShake(150);
-
-    level.applyPlatformsMovement(delta_time);
-    level.applyAsteroidsMovement(delta_time);
-    applyPlayersMovement(delta_time);
-    camera.applyMovement(playerManager->getAveragePlayerPosition(), delta_time);
-
-    // Handle collisions
-    broadPhaseManager->broadPhase();
-    narrowPhase(delta_time);
+    ProfileZone zone("Game::update");
+    handleMessages();
+    step(delta_time, false);
+}
 
-    playerManager->setTheBestPlayer();
-    updatePlayersSpriteAnimation();
+void Game::resimulate(double delta_time) {
+    ProfileZone zone("Game::resimulate");
+    step(delta_time, true);
+}
 
-    if (!Mediator::isClientRunning()) level.generateAsteroid(0, {camera.getX(), camera.getY()}, seed);
-    renderManager->render();
+void Game::handleMessages() {
+    ProfileZone zone("Game::handleMessages");
+    while (messageQueue->pop(receivedMessage)) {
+        Mediator::applyMessage(receivedMessage);
+    }
 }
 
 void Game::run() {
     gameState = GameState::RUNNING;
+    Profiler::setThreadName("Game");
 
     // Variables for controlling FPS and calculating delta time
     Uint64 lastFrameTime = SDL_GetPerformanceCounter(); // Time at the start of the game frame
     Uint64 frequency = SDL_GetPerformanceFrequency();
     double accumulatedTime = 0.0; // Accumulated time since last effective game FPS update
+    double simulationTime = 0.0; // Elapsed time not simulated yet
     int frameCounter = 0;
 
     double elapsedTimeSinceLastReset = 0.0; // Time elapsed since last reset
 
     // Game loop
-    while (gameState != GameState::STOPPED) {
-
-        // Process messages from other threads in the queue
-        if (!messageQueue->empty()) {
-            auto [mainMessage, parameters] = messageQueue->pop();
-
-            if (mainMessage == "InitializeClientGame") {
-                nlohmann::json message = nlohmann::json::parse(parameters[0]);
-                loadLevel(
-                        message["mapName"],
-                        message["lastCheckpoint"],
-                        message["players"],
-                        message["camera"],
-                        message["platforms1D"],
-                        message["platforms2D"],
-                        message["crushers"]
-                );
-            }
-        }
+    while (gameState != GameState::STOPPED && !*quitFlagPtr) {
+        Profiler::endFrame();
+        ProfileZone frame_zone("Game::run frame");
 
-        // Calculate delta time for game logic
+        // Calculate the time elapsed since the last frame
         Uint64 currentFrameTime = SDL_GetPerformanceCounter();
         Uint64 frameTicks = currentFrameTime - lastFrameTime;
-        float delta_time = static_cast<float>(frameTicks) / static_cast<float>(frequency); // Delta time in seconds for game logic
+        double frame_time = static_cast<double>(frameTicks) / static_cast<double>(frequency); // Frame time in seconds
         lastFrameTime = currentFrameTime;
 
-        // Accumulate time for game logic and rendering
-        accumulatedTime += delta_time;
-        elapsedTimeSinceLastReset += delta_time;
+        // Accumulate time for the simulation, bounded so that a long stall does not freeze the game catching up
+        simulationTime += std::min(frame_time, maxFrameTimeSeconds);
+        accumulatedTime += frame_time;
+        elapsedTimeSinceLastReset += frame_time;
+
+        // Run as many fixed simulation steps as the elapsed time requires, the dedicated server has no keyboard
+#ifndef HEADLESS
+        inputManager->handleKeyboardEvents();
+#endif
+        int steps = 0;
+        while (simulationTime >= SimulationClock::TIME_STEP && steps < maxSimulationStepsPerFrame && gameState != GameState::STOPPED) {
+            // With rollback, the late inputs received during the step are applied by simulating the past steps again
+            if (RollbackManager::enabled) rollbackManager->saveTick();
+            update(SimulationClock::TIME_STEP);
+            if (RollbackManager::enabled) rollbackManager->resimulate();
+            simulationTime -= SimulationClock::TIME_STEP;
+            steps++;
+
+            // Snapshots only carry what changed since the last one acknowledged, send one every tick
+            if (Mediator::isServerRunning() && !RollbackManager::enabled) inputManager->sendSyncCorrectionToNetwork();
+
+            // Remember the predicted position of the local player to reconcile it with the server
+            if (Mediator::isClientRunning() && !RollbackManager::enabled) predictionManager->recordTick();
+        }
+        if (steps == maxSimulationStepsPerFrame) simulationTime = std::min(simulationTime, SimulationClock::TIME_STEP);
+
+        // Upload a few images of the next level decoded in the background
+        levelPreloader->update(renderer);
 
-        // Calculate game rendering at the specified rate (frameRate)
+        // Render the game at the specified rate (frameRate), between the two last simulation steps
         if (accumulatedTime >= 1.0 / frameRate) {
             frameCounter++;
-            update(delta_time);
+#ifndef HEADLESS
+            renderManager->render(static_cast<float>(simulationTime / SimulationClock::TIME_STEP));
 
             // Every 1/60 seconds or more, send the keyboard state to the network
             if (elapsedTimeSinceLastReset > networkInputSendIntervalSeconds) {
                 inputManager->sendKeyboardStateToNetwork();
             }
-
-            // Every 20 seconds or more, send the sync correction to the network
-            if (Mediator::isServerRunning() && elapsedTimeSinceLastReset > networkSyncCorrectionIntervalSeconds) {
-                inputManager->sendSyncCorrectionToNetwork();
-            }
+#endif
 
             // Check if one second has passed since the last reset, and if so, reset frame counters and elapsed time
             if (elapsedTimeSinceLastReset >= effectiveFrameRateUpdateIntervalSeconds) {
@@ -278,6 +308,7 @@ void Game::run() {
         }
 
         // Waiting to maintain the desired game FPS
+        ProfileZone wait_zone("Game::run wait");
         Uint64 desiredTicksPerFrame = frequency / frameRate;
         Uint64 elapsedGameTicks = SDL_GetPerformanceCounter() - currentFrameTime;
         Uint64 ticksToWait = desiredTicksPerFrame > elapsedGameTicks ? desiredTicksPerFrame - elapsedGameTicks : 0;
@@ -286,6 +317,7 @@ void Game::run() {
 }
 
 void Game::calculatePlayersMovement(double delta_time) {
+    ProfileZone zone("Game::calculatePlayersMovement");
     // Apply movement to all players
     for (Player &player: playerManager->getAlivePlayers()) {
         player.calculateMovement(delta_time);
@@ -297,7 +329,12 @@ void Game::calculatePlayersMovement(double delta_time) {
     }
 }
 
+void Game::benchmarkUpdate(double delta_time, int asteroid_count, StepTimings &timings) {
+    step(delta_time, false, asteroid_count, &timings);
+}
+
 void Game::updatePlayersSpriteAnimation() {
+    ProfileZone zone("Game::updatePlayersSpriteAnimation");
 
     // Update sprite animation for all living players
     for (Player &player: playerManager->getAlivePlayers()) {
@@ -325,6 +362,7 @@ void Game::updatePlayersSpriteAnimation() {
 }
 
 void Game::applyPlayersMovement(double delta_time) {
+    ProfileZone zone("Game::applyPlayersMovement");
     // Apply movement for all living players
     for (Player &player: playerManager->getAlivePlayers()) {
         player.applyMovement(delta_time);
@@ -345,9 +383,51 @@ void Game::switchMavity() {
     }
 }
 
-void Game::narrowPhase(double delta_time) {
-    eventCollisionManager->handleAsteroidsCollisions(); // Handle collisions for asteroids
-    playerCollisionManager->handleCollisions(delta_time); // Handle collisions for all players
+void Game::step(double delta_time, bool replayed, int asteroid_count, StepTimings *timings) {
+    if (timings != nullptr) *timings = StepTimings();
+    Uint64 start = timings != nullptr ? SDL_GetPerformanceCounter() : 0;
+    Uint64 last = start;
+
+    // Add the time elapsed since the previous call to a phase, nullptr for the phases not measured
+    auto lap = [timings, &last](Uint64 StepTimings::*phase) {
+        if (timings == nullptr) return;
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (phase != nullptr) timings->*phase += now - last;
+        last = now;
+    };
+
+    calculatePlayersMovement(delta_time);
+    lap(&StepTimings::playersMovement);
+    if (level.applyTrapsMovement(delta_time) && !replayed) camera.setShake(150);
+    lap(nullptr);
+
+    level.applyPlatformsMovement(delta_time);
+    lap(&StepTimings::platformsMovement);
+    level.applyAsteroidsMovement(delta_time);
+    lap(nullptr);
+    applyPlayersMovement(delta_time);
+    lap(&StepTimings::playersMovement);
+    camera.applyMovement(playerManager->getAveragePlayerPosition(), delta_time);
+    if (!replayed) camera.checkShake();
+    lap(nullptr);
+
+    // Handle collisions
+    broadPhaseManager->broadPhase();
+    lap(&StepTimings::broadPhase);
+    {
+        ProfileZone narrow_zone("Game::narrowPhase");
+        eventCollisionManager->handleAsteroidsCollisions(); // Handle collisions for asteroids
+        lap(&StepTimings::asteroidsCollisions);
+        playerCollisionManager->handleCollisions(delta_time); // Handle collisions for all players
+        lap(&StepTimings::playersCollisions);
+    }
+
+    playerManager->setTheBestPlayer();
+    updatePlayersSpriteAnimation();
+
+    if (!replayed && !Mediator::isClientRunning()) level.generateAsteroid(asteroid_count, {camera.getX(), camera.getY()}, seed);
+    SimulationClock::advance();
+    if (timings != nullptr) timings->total = SDL_GetPerformanceCounter() - start;
 }
 
 void Game::togglePause() {
@@ -13,338 +13,462 @@ BroadPhaseManager::BroadPhaseManager(Game *game) : gamePtr(game) {}
 
 /* ACCESSORS */
 
-std::vector<AABB> &BroadPhaseManager::getSaveZones() {
-    return saveZones;
+const std::vector<size_t> &BroadPhaseManager::getSaveZones() const {
+    return visibleSet.saveZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getRescueZones() {
-    return rescueZones;
+const std::vector<size_t> &BroadPhaseManager::getRescueZones() const {
+    return visibleSet.rescueZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getToggleGravityZones() {
-    return toggleGravityZones;
+const std::vector<size_t> &BroadPhaseManager::getToggleGravityZones() const {
+    return visibleSet.toggleGravityZones;
 }
 
-std::vector<AABB> &BroadPhaseManager::getIncreaseFallSpeedZones() {
-    return increaseFallSpeedZones;
+const std::vector<size_t> &BroadPhaseManager::getIncreaseFallSpeedZones() const {
+    return visibleSet.increaseFallSpeedZones;
 }
 
-std::vector<Polygon> &BroadPhaseManager::getDeathZones() {
-    return deathZones;
+const std::vector<size_t> &BroadPhaseManager::getDeathZones() const {
+    return visibleSet.deathZones;
 }
 
-std::vector<Polygon> &BroadPhaseManager::getObstacles() {
-    return obstacles;
+const std::vector<size_t> &BroadPhaseManager::getObstacles() const {
+    return visibleSet.obstacles;
 }
 
-std::vector<TreadmillLever> &BroadPhaseManager::getTreadmillLevers() {
-    return treadmillLevers;
+const std::vector<size_t> &BroadPhaseManager::getTreadmillLevers() const {
+    return visibleSet.treadmillLevers;
 }
 
-std::vector<PlatformLever> &BroadPhaseManager::getPlatformLevers() {
-    return platformLevers;
+const std::vector<size_t> &BroadPhaseManager::getPlatformLevers() const {
+    return visibleSet.platformLevers;
 }
 
-std::vector<CrusherLever> &BroadPhaseManager::getCrusherLevers() {
-    return crusherLevers;
+const std::vector<size_t> &BroadPhaseManager::getCrusherLevers() const {
+    return visibleSet.crusherLevers;
 }
 
-std::vector<MovingPlatform1D> &BroadPhaseManager::getMovingPlatforms1D() {
-    return movingPlatforms1D;
+const std::vector<size_t> &BroadPhaseManager::getMovingPlatforms1D() const {
+    return visibleSet.movingPlatforms1D;
 }
 
-std::vector<MovingPlatform2D> &BroadPhaseManager::getMovingPlatforms2D() {
-    return movingPlatforms2D;
+const std::vector<size_t> &BroadPhaseManager::getMovingPlatforms2D() const {
+    return visibleSet.movingPlatforms2D;
 }
 
-std::vector<SwitchingPlatform> &BroadPhaseManager::getSwitchingPlatforms() {
-    return switchingPlatforms;
+const std::vector<size_t> &BroadPhaseManager::getSwitchingPlatforms() const {
+    return visibleSet.switchingPlatforms;
 }
 
-std::vector<WeightPlatform> &BroadPhaseManager::getWeightPlatforms() {
-    return weightPlatforms;
+const std::vector<size_t> &BroadPhaseManager::getWeightPlatforms() const {
+    return visibleSet.weightPlatforms;
 }
 
-std::vector<Treadmill> &BroadPhaseManager::getTreadmills() {
-    return treadmills;
+const std::vector<size_t> &BroadPhaseManager::getTreadmills() const {
+    return visibleSet.treadmills;
 }
 
-std::vector<Crusher> &BroadPhaseManager::getCrushers() {
-    return crushers;
+const std::vector<size_t> &BroadPhaseManager::getCrushers() const {
+    return visibleSet.crushers;
 }
 
-std::vector<SizePowerUp> &BroadPhaseManager::getSizePowerUps() {
-    return sizePowerUp;
+const std::vector<size_t> &BroadPhaseManager::getSizePowerUps() const {
+    return visibleSet.sizePowerUp;
 }
 
-std::vector<SpeedPowerUp> &BroadPhaseManager::getSpeedPowerUps() {
-    return speedPowerUp;
+const std::vector<size_t> &BroadPhaseManager::getSpeedPowerUps() const {
+    return visibleSet.speedPowerUp;
 }
 
-std::vector<Coin> &BroadPhaseManager::getCoins() {
-    return coins;
+const std::vector<size_t> &BroadPhaseManager::getCoins() const {
+    return visibleSet.coins;
 }
 
-std::vector<Item*> &BroadPhaseManager::getItems() {
-    return items;
+const std::vector<size_t> &BroadPhaseManager::getItems() const {
+    return visibleSet.items;
+}
+
+const VisibleSet &BroadPhaseManager::getVisibleSet() const {
+    return visibleSet;
 }
 
 
 /* METHODS */
 
-void BroadPhaseManager::checkSavesZones(const SDL_FRect& broad_phase_area) {
-    saveZones.clear(); // Empty old save zones
+void BroadPhaseManager::checkSavesZones(const SDL_FRect &broad_phase_area) {
+    visibleSet.saveZones.clear(); // Empty old save zones
+    const std::vector<AABB> &level_objects = gamePtr->getLevel()->getZones(AABBType::SAVE);
 
-    // Check collisions with each save zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::SAVE)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            saveZones.push_back(aabb);
+    // Check collisions with each save zone in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::SAVE_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getRect())) {
+            visibleSet.saveZones.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkRescueZones(const SDL_FRect &broad_phase_area) {
-    rescueZones.clear(); // Empty old rescue zones
-
-    // Check collisions with each rescue zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::RESCUE)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            rescueZones.push_back(aabb);
+    visibleSet.rescueZones.clear(); // Empty old rescue zones
+    const std::vector<AABB> &level_objects = gamePtr->getLevel()->getZones(AABBType::RESCUE);
+
+    // Check collisions with each rescue zone in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::RESCUE_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getRect())) {
+            visibleSet.rescueZones.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkToggleGravityZones(const SDL_FRect &broad_phase_area) {
-    toggleGravityZones.clear(); // Empty old toggle gravity zones
-
-    // Check collisions with each toggle gravity zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::TOGGLE_GRAVITY)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            toggleGravityZones.push_back(aabb);
+    visibleSet.toggleGravityZones.clear(); // Empty old toggle gravity zones
+    const std::vector<AABB> &level_objects = gamePtr->getLevel()->getZones(AABBType::TOGGLE_GRAVITY);
+
+    // Check collisions with each toggle gravity zone in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::TOGGLE_GRAVITY_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getRect())) {
+            visibleSet.toggleGravityZones.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkIncreaseFallSpeedZones(const SDL_FRect &broad_phase_area) {
-    increaseFallSpeedZones.clear(); // Empty old increase fall speed zones
-
-    // Check collisions with each increase fall speed zone
-    for (const AABB &aabb: gamePtr->getLevel()->getZones(AABBType::INCREASE_FALL_SPEED)) {
-        if (checkAABBCollision(broad_phase_area, aabb.getRect())) {
-            increaseFallSpeedZones.push_back(aabb);
+    visibleSet.increaseFallSpeedZones.clear(); // Empty old increase fall speed zones
+    const std::vector<AABB> &level_objects = gamePtr->getLevel()->getZones(AABBType::INCREASE_FALL_SPEED);
+
+    // Check collisions with each increase fall speed zone in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::INCREASE_FALL_SPEED_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getRect())) {
+            visibleSet.increaseFallSpeedZones.push_back(i);
         }
     }
 }
 
-void BroadPhaseManager::checkDeathZones(const std::vector<Point>& broad_phase_area) {
-    deathZones.clear(); // Empty old death zones
+void BroadPhaseManager::checkDeathZones(const SDL_FRect &broad_phase_area) {
+    visibleSet.deathZones.clear(); // Empty old death zones
+    const std::vector<Polygon> &level_objects = gamePtr->getLevel()->getZones(PolygonType::DEATH);
 
-    // Check collisions with each save zone
-    for (const Polygon &zone: gamePtr->getLevel()->getZones(PolygonType::DEATH)) {
-        if (checkSATCollision(broad_phase_area, zone)) {
-            deathZones.push_back(zone);
+    // Check collisions with each death zone in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::DEATH_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkSATCollision(broad_phase_area, level_objects[i])) {
+            visibleSet.deathZones.push_back(i);
         }
     }
 }
 
-void BroadPhaseManager::checkObstacles(const std::vector<Point> &broad_phase_area) {
-    obstacles.clear(); // Empty old death zones
+void BroadPhaseManager::checkObstacles(const SDL_FRect &broad_phase_area) {
+    visibleSet.obstacles.clear(); // Empty old obstacles
+    const std::vector<Polygon> &level_objects = gamePtr->getLevel()->getZones(PolygonType::COLLISION);
 
-    // Check collisions with each obstacle
-    for (const Polygon &obstacle: gamePtr->getLevel()->getZones(PolygonType::COLLISION)) {
-        if (checkSATCollision(broad_phase_area, obstacle)) {
-            obstacles.push_back(obstacle);
+    // Check collisions with each obstacle in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::COLLISION_ZONES).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkSATCollision(broad_phase_area, level_objects[i])) {
+            visibleSet.obstacles.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkTreadmillLevers(const SDL_FRect &broad_phase_area) {
-    treadmillLevers.clear(); // Empty old treadmill levers
-
-    // Check for collisions with each treadmill lever
-    for (const TreadmillLever &lever: gamePtr->getLevel()->getTreadmillLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            treadmillLevers.push_back(lever);
+    visibleSet.treadmillLevers.clear(); // Empty old treadmill levers
+    const std::vector<TreadmillLever> &level_objects = gamePtr->getLevel()->getTreadmillLevers();
+
+    // Check for collisions with each treadmill lever in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::TREADMILL_LEVERS).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getBoundingBox())) {
+            visibleSet.treadmillLevers.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkPlatformLevers(const SDL_FRect &broad_phase_area) {
-    platformLevers.clear(); // Empty old platform levers
-
-    // Check for collisions with each platform lever
-    for (PlatformLever &lever: gamePtr->getLevel()->getPlatformLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            lever.setIsOnScreen(true);
-            platformLevers.push_back(lever);
-        } else {
-            lever.setIsOnScreen(false);
+    std::vector<PlatformLever> &level_objects = gamePtr->getLevel()->getPlatformLevers();
+
+    // Hide the platform levers found by the last broad phase
+    for (size_t i : visibleSet.platformLevers) {
+        if (i < level_objects.size()) level_objects[i].setIsOnScreen(false);
+    }
+    visibleSet.platformLevers.clear(); // Empty old platform levers
+
+    // Check for collisions with each platform lever in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::PLATFORM_LEVERS).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getBoundingBox())) {
+            level_objects[i].setIsOnScreen(true);
+            visibleSet.platformLevers.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkCrusherLevers(const SDL_FRect &broad_phase_area) {
-    crusherLevers.clear(); // Empty old crusher levers
-
-    // Check for collisions with each crusher lever
-    for (CrusherLever &lever: gamePtr->getLevel()->getCrusherLevers()) {
-        if (checkAABBCollision(broad_phase_area, lever.getBoundingBox())) {
-            lever.setIsOnScreen(true);
-            crusherLevers.push_back(lever);
-        } else {
-            lever.setIsOnScreen(false);
+    std::vector<CrusherLever> &level_objects = gamePtr->getLevel()->getCrusherLevers();
+
+    // Hide the crusher levers found by the last broad phase
+    for (size_t i : visibleSet.crusherLevers) {
+        if (i < level_objects.size()) level_objects[i].setIsOnScreen(false);
+    }
+    visibleSet.crusherLevers.clear(); // Empty old crusher levers
+
+    // Check for collisions with each crusher lever in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::CRUSHER_LEVERS).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getBoundingBox())) {
+            level_objects[i].setIsOnScreen(true);
+            visibleSet.crusherLevers.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::check1DMovingPlatforms(const SDL_FRect &broad_phase_area) {
-    movingPlatforms1D.clear(); // Empty old 1D moving platforms
-
-    // Check for collisions with each 1D moving platform
-    for (MovingPlatform1D &platform: gamePtr->getLevel()->getMovingPlatforms1D()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            movingPlatforms1D.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
+    std::vector<MovingPlatform1D> &level_objects = gamePtr->getLevel()->getMovingPlatforms1D();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::MOVING_PLATFORMS_1D);
+
+    // Hide the 1D moving platforms found by the last broad phase
+    for (size_t i : visibleSet.movingPlatforms1D) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.movingPlatforms1D.clear(); // Empty old 1D moving platforms
+
+    // Check for collisions with the packed bounding box of each 1D moving platform
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.movingPlatforms1D.push_back(i);
+    }
 }
 
 void BroadPhaseManager::check2DMovingPlatforms(const SDL_FRect &broad_phase_area) {
-    movingPlatforms2D.clear(); // Empty old 2D moving platforms
-
-    // Check for collisions with each 2D moving platform
-    for (MovingPlatform2D &platform: gamePtr->getLevel()->getMovingPlatforms2D()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            movingPlatforms2D.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
+    std::vector<MovingPlatform2D> &level_objects = gamePtr->getLevel()->getMovingPlatforms2D();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::MOVING_PLATFORMS_2D);
+
+    // Hide the 2D moving platforms found by the last broad phase
+    for (size_t i : visibleSet.movingPlatforms2D) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.movingPlatforms2D.clear(); // Empty old 2D moving platforms
+
+    // Check for collisions with the packed bounding box of each 2D moving platform
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.movingPlatforms2D.push_back(i);
+    }
 }
 
 void BroadPhaseManager::checkSwitchingPlatforms(const SDL_FRect &broad_phase_area) {
-    switchingPlatforms.clear(); // Empty old switching platforms
-
-    // Check for collisions with each switching platform
-    for (SwitchingPlatform &platform: gamePtr->getLevel()->getSwitchingPlatforms()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            switchingPlatforms.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
+    std::vector<SwitchingPlatform> &level_objects = gamePtr->getLevel()->getSwitchingPlatforms();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::SWITCHING_PLATFORMS);
+
+    // Hide the switching platforms found by the last broad phase
+    for (size_t i : visibleSet.switchingPlatforms) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.switchingPlatforms.clear(); // Empty old switching platforms
+
+    // Check for collisions with the packed bounding box of each switching platform
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.switchingPlatforms.push_back(i);
+    }
 }
 
 void BroadPhaseManager::checkWeightPlatforms(const SDL_FRect &broad_phase_area) {
-    weightPlatforms.clear(); // Empty old weight platforms
-
-    // Check for collisions with each weight platform
-    for (WeightPlatform &platform: gamePtr->getLevel()->getWeightPlatforms()) {
-        if (checkAABBCollision(broad_phase_area, platform.getBoundingBox())) {
-            platform.setIsOnScreen(true);
-            weightPlatforms.push_back(platform);
-        } else {
-            platform.setIsOnScreen(false);
+    std::vector<WeightPlatform> &level_objects = gamePtr->getLevel()->getWeightPlatforms();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::WEIGHT_PLATFORMS);
+
+    // Hide the weight platforms found by the last broad phase
+    for (size_t i : visibleSet.weightPlatforms) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.weightPlatforms.clear(); // Empty old weight platforms
+
+    // Check for collisions with the packed bounding box of each weight platform
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.weightPlatforms.push_back(i);
+    }
 }
 
 void BroadPhaseManager::checkTreadmills(const SDL_FRect &broad_phase_area) {
-    treadmills.clear(); // Empty old treadmills
-
-    // Check for collisions with each treadmill
-    for (Treadmill &treadmill: gamePtr->getLevel()->getTreadmills()) {
-        if (checkAABBCollision(broad_phase_area, treadmill.getBoundingBox())) {
-            treadmill.setIsOnScreen(true);
-            treadmills.push_back(treadmill);
-        } else {
-            treadmill.setIsOnScreen(false);
+    std::vector<Treadmill> &level_objects = gamePtr->getLevel()->getTreadmills();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::TREADMILLS);
+
+    // Hide the treadmills found by the last broad phase
+    for (size_t i : visibleSet.treadmills) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.treadmills.clear(); // Empty old treadmills
+
+    // Check for collisions with the packed bounding box of each treadmill
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.treadmills.push_back(i);
+    }
 }
 
 void BroadPhaseManager::checkCrushers(const SDL_FRect &broad_phase_area) {
-    crushers.clear(); // Empty old crushers
-
-    // Check for collisions with each crusher
-    for (Crusher &crusher: gamePtr->getLevel()->getCrushers()) {
-        if (checkAABBCollision(broad_phase_area, crusher.getBoundingBox())) {
-            crusher.setIsOnScreen(true);
-            crushers.push_back(crusher);
-        } else {
-            crusher.setIsOnScreen(false);
+    std::vector<Crusher> &level_objects = gamePtr->getLevel()->getCrushers();
+    BodyStreams &bodies = gamePtr->getLevel()->getBodies(GridType::CRUSHERS);
+
+    // Hide the crushers found by the last broad phase
+    for (size_t i : visibleSet.crushers) {
+        if (i < level_objects.size()) {
+            level_objects[i].setIsOnScreen(false);
+            bodies.setOnScreen(i, false);
         }
     }
+    visibleSet.crushers.clear(); // Empty old crushers
+
+    // Check for collisions with the packed bounding box of each crusher
+    checkAABBCollisions(broad_phase_area, bodies.getX().data(), bodies.getY().data(), bodies.getW().data(), bodies.getH().data(), bodies.size(), candidates);
+    for (size_t i : candidates) {
+        level_objects[i].setIsOnScreen(true);
+        bodies.setOnScreen(i, true);
+        visibleSet.crushers.push_back(i);
+    }
 }
 
 void BroadPhaseManager::checkPowerUps(const SDL_FRect &broad_phase_area) {
-    sizePowerUp.clear(); // Empty old size power-up
-    speedPowerUp.clear(); // Empty old speed power-up
-
-    // Check for collisions with size power-up
-    for (SizePowerUp &item: gamePtr->getLevel()->getSizePowerUp()) {
-        if (checkAABBCollision(broad_phase_area, item.getBoundingBox())) {
-            item.setIsOnScreen(true);
-            sizePowerUp.push_back(item);
-        } else {
-            item.setIsOnScreen(false);
+    std::vector<SizePowerUp> &level_size_power_ups = gamePtr->getLevel()->getSizePowerUp();
+
+    // Hide the size power-up found by the last broad phase
+    for (size_t i : visibleSet.sizePowerUp) {
+        if (i < level_size_power_ups.size()) level_size_power_ups[i].setIsOnScreen(false);
+    }
+    visibleSet.sizePowerUp.clear(); // Empty old size power-up
+
+    // Check for collisions with each size power-up in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::SIZE_POWER_UP).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_size_power_ups[i].getBoundingBox())) {
+            level_size_power_ups[i].setIsOnScreen(true);
+            visibleSet.sizePowerUp.push_back(i);
         }
     }
 
-    // Check for collisions with speed power-up
-    for (SpeedPowerUp &item: gamePtr->getLevel()->getSpeedPowerUp()) {
-        if (checkAABBCollision(broad_phase_area, item.getBoundingBox())) {
-            item.setIsOnScreen(true);
-            speedPowerUp.push_back(item);
-        } else {
-            item.setIsOnScreen(false);
+    std::vector<SpeedPowerUp> &level_speed_power_ups = gamePtr->getLevel()->getSpeedPowerUp();
+
+    // Hide the speed power-up found by the last broad phase
+    for (size_t i : visibleSet.speedPowerUp) {
+        if (i < level_speed_power_ups.size()) level_speed_power_ups[i].setIsOnScreen(false);
+    }
+    visibleSet.speedPowerUp.clear(); // Empty old speed power-up
+
+    // Check for collisions with each speed power-up in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::SPEED_POWER_UP).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_speed_power_ups[i].getBoundingBox())) {
+            level_speed_power_ups[i].setIsOnScreen(true);
+            visibleSet.speedPowerUp.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkCoins(const SDL_FRect &broad_phase_area) {
-    coins.clear(); // Empty old coins
-
-    // Check for collisions with coins
-    for (Coin &coin: gamePtr->getLevel()->getCoins()) {
-        if (checkAABBCollision(broad_phase_area, coin.getBoundingBox())) {
-            coin.setIsOnScreen(true);
-            coins.push_back(coin);
-        } else {
-            coin.setIsOnScreen(false);
+    std::vector<Coin> &level_objects = gamePtr->getLevel()->getCoins();
+
+    // Hide the coins found by the last broad phase
+    for (size_t i : visibleSet.coins) {
+        if (i < level_objects.size()) level_objects[i].setIsOnScreen(false);
+    }
+    visibleSet.coins.clear(); // Empty old coins
+
+    // Check for collisions with each coin in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::COINS).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i].getBoundingBox())) {
+            level_objects[i].setIsOnScreen(true);
+            visibleSet.coins.push_back(i);
         }
     }
 }
 
 void BroadPhaseManager::checkItems(const SDL_FRect &broad_phase_area) {
-    items.clear(); // Empty old items
-
-    // Check for collisions with items
-    for (Item *item: gamePtr->getLevel()->getItems()) {
-        if (checkAABBCollision(broad_phase_area, item->getBoundingBox())) {
-            item->setIsOnScreen(true);
-            items.push_back(item);
-        } else {
-            item->setIsOnScreen(false);
+    const std::vector<Item*> &level_objects = gamePtr->getLevel()->getItems();
+
+    // Hide the items found by the last broad phase
+    for (size_t i : visibleSet.items) {
+        if (i < level_objects.size()) level_objects[i]->setIsOnScreen(false);
+    }
+    visibleSet.items.clear(); // Empty old items
+
+    // Check for collisions with each item in the cells overlapping the area
+    gamePtr->getLevel()->getGrid(GridType::ITEMS).query(broad_phase_area, candidates);
+    for (size_t i : candidates) {
+        if (checkAABBCollision(broad_phase_area, level_objects[i]->getBoundingBox())) {
+            level_objects[i]->setIsOnScreen(true);
+            visibleSet.items.push_back(i);
         }
     }
 }
 
+void BroadPhaseManager::removeSizePowerUp(size_t position) {
+    gamePtr->getLevel()->removeItemFromSizePowerUp(visibleSet.sizePowerUp[position]);
+    removeIndex(visibleSet.sizePowerUp, position);
+}
+
+void BroadPhaseManager::removeSpeedPowerUp(size_t position) {
+    gamePtr->getLevel()->removeItemFromSpeedPowerUp(visibleSet.speedPowerUp[position]);
+    removeIndex(visibleSet.speedPowerUp, position);
+}
+
+void BroadPhaseManager::removeCoin(size_t position) {
+    gamePtr->getLevel()->removeItemFromCoins(visibleSet.coins[position]);
+    removeIndex(visibleSet.coins, position);
+}
+
+void BroadPhaseManager::removeItem(size_t position) {
+    gamePtr->getLevel()->removeItem(visibleSet.items[position]);
+    removeIndex(visibleSet.items, position);
+}
+
+void BroadPhaseManager::removeIndex(std::vector<size_t> &indices, size_t position) {
+    indices.erase(indices.begin() + static_cast<std::ptrdiff_t>(position));
+
+    // Indices are sorted, every object after the removed one moved back by one
+    for (size_t i = position; i < indices.size(); i++) indices[i]--;
+}
+
 void BroadPhaseManager::broadPhase() {
+    ProfileZone zone("BroadPhaseManager::broadPhase");
 
-    std::vector<Point> broad_phase_area_vertices = gamePtr->getCamera()->getBroadPhaseAreaVertices();
     SDL_FRect broad_phase_area_bounding_box = gamePtr->getCamera()->getBroadPhaseArea();
 
     checkSavesZones(broad_phase_area_bounding_box);
     checkRescueZones(broad_phase_area_bounding_box);
     checkToggleGravityZones(broad_phase_area_bounding_box);
     checkIncreaseFallSpeedZones(broad_phase_area_bounding_box);
-    checkDeathZones(broad_phase_area_vertices);
-    checkObstacles(broad_phase_area_vertices);
+    checkDeathZones(broad_phase_area_bounding_box);
+    checkObstacles(broad_phase_area_bounding_box);
     check1DMovingPlatforms(broad_phase_area_bounding_box);
     check2DMovingPlatforms(broad_phase_area_bounding_box);
     checkSwitchingPlatforms(broad_phase_area_bounding_box);
@@ -354,16 +478,12 @@ void BroadPhaseManager::broadPhase() {
     checkCoins(broad_phase_area_bounding_box);
     checkItems(broad_phase_area_bounding_box);
 
-    // Check if a player is hitting
-    bool player_is_hitting = false;
-    for (const Player &player: gamePtr->getPlayerManager().getAlivePlayers()) {
-        if (player.getIsHitting()) player_is_hitting = true;
-    }
+    // The levers are drawn from the visible set, the collision managers only test them when a player is hitting
+    checkTreadmillLevers(broad_phase_area_bounding_box);
+    checkPlatformLevers(broad_phase_area_bounding_box);
+    checkCrusherLevers(broad_phase_area_bounding_box);
+}
 
-    // Check hit collision only if a player is hitting
-    if (player_is_hitting) {
-        checkTreadmillLevers(broad_phase_area_bounding_box);
-        checkPlatformLevers(broad_phase_area_bounding_box);
-        checkCrusherLevers(broad_phase_area_bounding_box);
-    }
-}
\ No newline at end of file
+void BroadPhaseManager::clear() {
+    visibleSet.clear();
+}
@@ -14,13 +14,16 @@ EventCollisionManager::EventCollisionManager(Game *game) : gamePtr(game) {}
 /* METHODS */
 
 void EventCollisionManager::handleAsteroidsCollisions() {
-    std::vector<Asteroid> asteroids = gamePtr->getLevel()->getAsteroids();
+    ProfileZone zone("EventCollisionManager::handleAsteroidsCollisions");
+    AsteroidPool &asteroids = gamePtr->getLevel()->getAsteroids();
     const std::vector<Polygon>& collisionObstacles = gamePtr->getLevel()->getZones(PolygonType::COLLISION);
+    std::vector<Player>& characters = gamePtr->getPlayerManager().getAlivePlayers();
 
-    for (auto asteroidIt = asteroids.begin(); asteroidIt != asteroids.end();) {
-        Asteroid& asteroid = *asteroidIt;
+    // Update the asteroids in place, a removed asteroid is replaced by the last one which is checked next
+    size_t i = 0;
+    while (i < asteroids.size()) {
+        Asteroid& asteroid = asteroids[i];
         bool alreadyExplode = false;
-        std::vector<Player>& characters = gamePtr->getPlayerManager().getAlivePlayers();
 
         // Check collisions with characters
         auto characterIt = characters.begin();
@@ -33,13 +36,14 @@ void EventCollisionManager::handleAsteroidsCollisions() {
             ++characterIt;
         }
 
-        // Check collisions with obstacles
-        auto obstacleIt = collisionObstacles.begin();
-        while (!alreadyExplode && obstacleIt != collisionObstacles.end()) {
-            const Polygon& obstacle = *obstacleIt;
-            if (checkSATCollision(asteroid.getVertices(), obstacle)) {
+        // Check collisions with the obstacles around the asteroid
+        if (!alreadyExplode) gamePtr->getLevel()->queryCollisionZones(asteroid.getBoundingBox(), {0, 0}, candidates);
+        auto obstacleIt = candidates.begin();
+        while (!alreadyExplode && obstacleIt != candidates.end()) {
+            const Polygon& obstacle = collisionObstacles[*obstacleIt];
+            if (checkSATCollision(asteroid.getBoundingBox(), obstacle)) {
                 alreadyExplode = true;
-                gamePtr->getCamera()->setShake(250);
+                if (!gamePtr->getRollbackManager().getIsResimulating()) gamePtr->getCamera()->setShake(250);
                 break; // No need to check further obstacles if the asteroid already exploded
             }
             ++obstacleIt;
@@ -53,11 +57,9 @@ void EventCollisionManager::handleAsteroidsCollisions() {
         // Handle explosion or move to the next asteroid
         if (alreadyExplode) {
             asteroid.explode();
-            asteroidIt = asteroids.erase(asteroidIt); // Remove the asteroid and update the iterator
+            asteroids.remove(i); // Recycle the asteroid, the last one takes its index
         } else {
-            ++asteroidIt; // Move to the next asteroid
+            i++; // Move to the next asteroid
         }
     }
-
-    gamePtr->getLevel()->setAsteroids(asteroids);
-}
\ No newline at end of file
+}
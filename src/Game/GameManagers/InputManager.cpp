@@ -14,6 +14,7 @@ InputManager::InputManager(Game *game) : gamePtr(game) {}
 /* METHODS */
 
 void InputManager::handleKeyboardEvents() {
+    ProfileZone zone("InputManager::handleKeyboardEvents");
     SDL_Event e;
     Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
 
@@ -171,6 +172,7 @@ void InputManager::handleKeyDownEvent(Player *player, const SDL_KeyboardEvent &k
 
 
 void InputManager::sendKeyboardStateToNetwork() {
+    ProfileZone zone("InputManager::sendKeyboardStateToNetwork");
 
     // Check if the game is in development mode
 #ifdef DEVELOPMENT_MODE
@@ -194,9 +196,6 @@ void InputManager::sendKeyboardStateToNetwork() {
 }
 
 void InputManager::sendSyncCorrectionToNetwork() const {
-    using json = nlohmann::json;
-    json message;
-
-    message["messageType"] = "syncCorrection";
-    Mediator::sendSyncCorrection(message);
+    ProfileZone zone("InputManager::sendSyncCorrectionToNetwork");
+    Mediator::sendSyncCorrection();
 }
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "../../../include/Game/GameManagers/LevelPreloader.h"
+
+/**
+ * @file LevelPreloader.cpp
+ * @brief Implements the LevelPreloader class responsible for preparing the images of the next level during the game.
+ */
+
+
+/* CONSTRUCTORS */
+
+LevelPreloader::LevelPreloader(Game *game) : gamePtr(game) {}
+
+LevelPreloader::~LevelPreloader() {
+    worker.request_stop();
+    if (worker.joinable()) worker.join();
+
+    // The renderer is destroyed before the game, its textures are already gone
+    release(false);
+}
+
+
+/* ACCESSORS */
+
+bool LevelPreloader::isReady(const std::string &map_name) const {
+    return mapName == map_name && decoded.load(std::memory_order_acquire) && uploadedCount == images.size();
+}
+
+
+/* METHODS */
+
+void LevelPreloader::preload(const std::string &map_name) {
+    if (map_name.empty() || map_name == mapName) return;
+    cancel();
+
+    mapName = map_name;
+    int current_world_id = gamePtr->getTextureManager().getWorldID();
+    worker = std::jthread([this, map_name, current_world_id](const std::stop_token &stop_token) {
+        Profiler::setThreadName("Level preloader");
+        decode(stop_token, map_name, current_world_id);
+    });
+    std::cout << "LevelPreloader: Preloading level " << map_name << "..." << std::endl;
+}
+
+void LevelPreloader::update(SDL_Renderer *renderer) {
+    if (renderer == nullptr || !decoded.load(std::memory_order_acquire) || uploadedCount == images.size()) return;
+    ProfileZone zone("LevelPreloader::update");
+
+    // Upload at least one image per frame, then as many as the budget allows
+    Uint64 start = SDL_GetPerformanceCounter();
+    auto budget_ticks = static_cast<Uint64>(uploadBudgetSeconds * static_cast<double>(SDL_GetPerformanceFrequency()));
+    do {
+        PreloadedImage &image = images[uploadedCount++].second;
+        if (image.surface != nullptr) image.texture = SDL_CreateTextureFromSurface(renderer, image.surface);
+    } while (uploadedCount < images.size() && SDL_GetPerformanceCounter() - start < budget_ticks);
+}
+
+void LevelPreloader::finish(const std::string &map_name) {
+    if (mapName != map_name) {
+        cancel();
+        return;
+    }
+
+    if (!isReady(map_name)) std::cout << "LevelPreloader: Level " << map_name << " is not fully preloaded yet." << std::endl;
+    if (worker.joinable()) worker.join();
+
+    // The images not uploaded yet are turned into textures by the texture manager
+    std::unordered_map<std::string, PreloadedImage> loaded_images;
+    for (auto &[path, image] : images) {
+        if (image.surface != nullptr) loaded_images.emplace(path, image);
+    }
+    gamePtr->getTextureManager().setPreloadedImages(std::move(loaded_images));
+
+    images.clear();
+    uploadedCount = 0;
+    decoded.store(false, std::memory_order_relaxed);
+    mapName.clear();
+}
+
+void LevelPreloader::cancel() {
+    worker.request_stop();
+    if (worker.joinable()) worker.join();
+
+    release(true);
+    uploadedCount = 0;
+    decoded.store(false, std::memory_order_relaxed);
+    mapName.clear();
+}
+
+void LevelPreloader::decode(const std::stop_token &stop_token, const std::string &map_name, int current_world_id) {
+    ProfileZone zone("LevelPreloader::decode");
+    std::string map_directory = std::string(MAPS_DIRECTORY) + map_name + "/";
+    int world_id;
+    [[maybe_unused]] int map_id; // The middleground is never drawn by the dedicated server
+
+    // Read the IDs of the map, from the compiled level when it is up to date
+    CompiledLevel compiled;
+    if (compiled.open(map_directory)) {
+        const CompiledProperties &properties = compiled.getSection<CompiledProperties>(LevelSection::PROPERTIES)[0];
+        world_id = properties.worldID;
+        map_id = properties.mapID;
+    } else {
+        std::ifstream file(map_directory + "level.json");
+        if (!file.is_open()) {
+            std::cerr << "LevelPreloader: Unable to open the properties file of " << map_name << "." << std::endl;
+            decoded.store(true, std::memory_order_release);
+            return;
+        }
+
+        nlohmann::json j;
+        file >> j;
+        world_id = j["worldID"];
+        map_id = j["levelID"];
+    }
+
+    // Only the images loaded by the Level constructor are needed
+    std::vector<std::string> paths;
+#ifndef HEADLESS
+    paths.push_back(TextureManager::getMiddlegroundPath(map_id));
+#endif
+    if (world_id != current_world_id) {
+        std::vector<std::string> world_paths = TextureManager::getWorldImagePaths(world_id);
+        paths.insert(paths.end(), world_paths.begin(), world_paths.end());
+    }
+
+    images.reserve(paths.size());
+    for (const std::string &path : paths) {
+        if (stop_token.stop_requested()) return;
+
+        SDL_Surface *surface = IMG_Load(path.c_str());
+        if (surface == nullptr) std::cerr << "LevelPreloader: Unable to decode " << path << ": " << IMG_GetError() << std::endl;
+        images.emplace_back(path, PreloadedImage{surface, nullptr});
+    }
+
+    decoded.store(true, std::memory_order_release);
+}
+
+void LevelPreloader::release(bool destroy_textures) {
+    for (auto &[path, image] : images) {
+        if (destroy_textures) SDL_DestroyTexture(image.texture);
+        SDL_FreeSurface(image.surface);
+    }
+    images.clear();
+}
@@ -15,27 +15,31 @@ PlayerCollisionManager::PlayerCollisionManager(Game *game) : gamePtr(game) {}
 /* METHODS */
 
 void PlayerCollisionManager::handleCollisionsWithObstacles(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithObstacles");
+    const std::vector<Polygon> &level_obstacles = gamePtr->getLevel()->getZones(PolygonType::COLLISION);
+
     // Check collisions with each obstacle
-    for (const Polygon &obstacle: gamePtr->getBroadPhaseManager().getObstacles()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getObstacles()) {
+        const Polygon &obstacle = level_obstacles[i];
         // Check if a collision is detected
-        if (checkSATCollision(player->getVertices(), obstacle)) {
+        if (checkSATCollision(player->getBoundingBox(), obstacle)) {
 
             correctSATCollision(player, obstacle); // Correct the collision
 
             // If the collision is with the roof, the player can't jump anymore
-            if (checkSATCollision(player->getRoofColliderVertices(), obstacle)) {
+            if (checkSATCollision(player->getRoofColliderBoundingBox(), obstacle)) {
                 player->setRoofCollider(true);
                 player->setIsJumping(false);
                 player->setMoveY(0);
             }
             // If the collision is with the ground, the player is on the ground
-            if (!player->getIsGrounded() && checkSATCollision(player->getGroundColliderVertices(), obstacle)) {
+            if (!player->getIsGrounded() && checkSATCollision(player->getGroundColliderBoundingBox(), obstacle)) {
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
             }
         }
         // If the collision is with the wall, the player can't move
-        if (player->getCanMove() && checkSATCollision(player->getHorizontalColliderVertices(), obstacle)) {
+        if (player->getCanMove() && checkSATCollision(player->getHorizontalColliderBoundingBox(), obstacle)) {
             player->getDirectionX() > 0 ? player->setRightCollider(true) : player->setLeftCollider(true);
             player->setCanMove(false);
         }
@@ -43,13 +47,17 @@ void PlayerCollisionManager::handleCollisionsWithObstacles(Player *player) {
 }
 
 bool PlayerCollisionManager::handleCollisionsWithTreadmillLevers(const Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithTreadmillLevers");
+    const std::vector<TreadmillLever> &level_levers = gamePtr->getLevel()->getTreadmillLevers();
+
     // Check for collisions with each lever
-    for (const TreadmillLever &lever: gamePtr->getBroadPhaseManager().getTreadmillLevers()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getTreadmillLevers()) {
+        const TreadmillLever &lever = level_levers[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
             // If the player is on the lever, activate it
             if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activateTreadmillLever(lever);
+                gamePtr->getLevel()->activateTreadmillLever(i);
                 return true;
             }
         }
@@ -58,13 +66,17 @@ bool PlayerCollisionManager::handleCollisionsWithTreadmillLevers(const Player *p
 }
 
 bool PlayerCollisionManager::handleCollisionsWithPlatformLevers(const Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithPlatformLevers");
+    const std::vector<PlatformLever> &level_levers = gamePtr->getLevel()->getPlatformLevers();
+
     // Check for collisions with each lever
-    for (const PlatformLever &lever: gamePtr->getBroadPhaseManager().getPlatformLevers()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getPlatformLevers()) {
+        const PlatformLever &lever = level_levers[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
             // If the player is on the lever, activate it
             if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activatePlatformLever(lever);
+                gamePtr->getLevel()->activatePlatformLever(i);
                 return true;
             }
         }
@@ -73,13 +85,17 @@ bool PlayerCollisionManager::handleCollisionsWithPlatformLevers(const Player *pl
 }
 
 bool PlayerCollisionManager::handleCollisionsWithCrusherLevers(const Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithCrusherLevers");
+    const std::vector<CrusherLever> &level_levers = gamePtr->getLevel()->getCrusherLevers();
+
     // Check for collisions with each lever
-    for (const CrusherLever &lever: gamePtr->getBroadPhaseManager().getCrusherLevers()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getCrusherLevers()) {
+        const CrusherLever &lever = level_levers[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getHitZoneBoundingBox(), lever.getBoundingBox())) {
             // If the player is on the lever, activate it
             if (checkAABBCollision(player->getGroundColliderBoundingBox(), lever.getBoundingBox())) {
-                gamePtr->getLevel()->activateCrusherLever(lever);
+                gamePtr->getLevel()->activateCrusherLever(i);
                 return true;
             }
         }
@@ -88,8 +104,12 @@ bool PlayerCollisionManager::handleCollisionsWithCrusherLevers(const Player *pla
 }
 
 void PlayerCollisionManager::handleCollisionsWithMovingPlatform1D(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithMovingPlatform1D");
+    const std::vector<MovingPlatform1D> &level_platforms = gamePtr->getLevel()->getMovingPlatforms1D();
+
     // Check for collisions with each 1D moving platform
-    for (const MovingPlatform1D &platform: gamePtr->getBroadPhaseManager().getMovingPlatforms1D()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getMovingPlatforms1D()) {
+        const MovingPlatform1D &platform = level_platforms[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
 
@@ -120,9 +140,12 @@ void PlayerCollisionManager::handleCollisionsWithMovingPlatform1D(Player *player
 }
 
 void PlayerCollisionManager::handleCollisionsWithMovingPlatform2D(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithMovingPlatform2D");
+    const std::vector<MovingPlatform2D> &level_platforms = gamePtr->getLevel()->getMovingPlatforms2D();
 
     // Check for collisions with each 2D moving platform
-    for (const MovingPlatform2D &platform: gamePtr->getBroadPhaseManager().getMovingPlatforms2D()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getMovingPlatforms2D()) {
+        const MovingPlatform2D &platform = level_platforms[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
 
@@ -153,9 +176,12 @@ void PlayerCollisionManager::handleCollisionsWithMovingPlatform2D(Player *player
 }
 
 void PlayerCollisionManager::handleCollisionsWithSwitchingPlatform(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithSwitchingPlatform");
+    const std::vector<SwitchingPlatform> &level_platforms = gamePtr->getLevel()->getSwitchingPlatforms();
 
     // Check for collisions with each switching platform
-    for (const SwitchingPlatform &platform: gamePtr->getBroadPhaseManager().getSwitchingPlatforms()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getSwitchingPlatforms()) {
+        const SwitchingPlatform &platform = level_platforms[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
 
@@ -183,8 +209,12 @@ void PlayerCollisionManager::handleCollisionsWithSwitchingPlatform(Player *playe
 }
 
 void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player) {
-    // Check for collisions with each switching platform
-    for (const WeightPlatform &platform: gamePtr->getBroadPhaseManager().getWeightPlatforms()) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithWeightPlatform");
+    const std::vector<WeightPlatform> &level_platforms = gamePtr->getLevel()->getWeightPlatforms();
+
+    // Check for collisions with each weight platform
+    for (size_t i : gamePtr->getBroadPhaseManager().getWeightPlatforms()) {
+        const WeightPlatform &platform = level_platforms[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getBoundingBox(), platform.getBoundingBox())) {
 
@@ -201,8 +231,8 @@ void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player)
                 player->setGroundCollider(true);
                 player->setIsGrounded(true);
                 player->setIsOnPlatform(true);
-                if (player->getMavity() > 0) gamePtr->getLevel()->increaseWeightForPlatform(platform);
-                else gamePtr->getLevel()->decreaseWeightForPlatform(platform);
+                if (player->getMavity() > 0) gamePtr->getLevel()->increaseWeightForPlatform(i);
+                else gamePtr->getLevel()->decreaseWeightForPlatform(i);
             }
             // If the collision is with the wall, the player can't move
             if (checkAABBCollision(player->getHorizontalColliderBoundingBox(), platform.getBoundingBox())) {
@@ -214,8 +244,12 @@ void PlayerCollisionManager::handleCollisionsWithWeightPlatform(Player *player)
 }
 
 void PlayerCollisionManager::handleCollisionsWithTreadmills(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithTreadmills");
+    const std::vector<Treadmill> &level_treadmills = gamePtr->getLevel()->getTreadmills();
+
     // Check for collisions with each treadmill
-    for (const Treadmill &treadmill: gamePtr->getBroadPhaseManager().getTreadmills()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getTreadmills()) {
+        const Treadmill &treadmill = level_treadmills[i];
         // Check if a collision is detected
         if (checkAABBCollision(player->getBoundingBox(), treadmill.getBoundingBox())) {
 
@@ -251,8 +285,12 @@ void PlayerCollisionManager::handleCollisionsWithTreadmills(Player *player) {
 }
 
 bool PlayerCollisionManager::handleCollisionsWithCrushers(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithCrushers");
+    const std::vector<Crusher> &level_crushers = gamePtr->getLevel()->getCrushers();
+
     // Check for collisions with each crusher
-    for (Crusher const &crusher : gamePtr->getBroadPhaseManager().getCrushers()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getCrushers()) {
+        Crusher const &crusher = level_crushers[i];
         // Check if a collision is detected
             if (checkAABBCollision(player->getBoundingBox(), crusher.getBoundingBox())) {
                 // If the player is being crushed, return true to kill him
@@ -290,6 +328,7 @@ bool PlayerCollisionManager::handleCollisionsWithCrushers(Player *player) {
 }
 
 bool PlayerCollisionManager::handleCollisionsWithCameraBorders(const SDL_FRect player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithCameraBorders");
     const SDL_FRect &camera = gamePtr->getCamera()->getBoundingBox();
 
     return player.x < camera.x - DISTANCE_OUT_MAP_BEFORE_DEATH                           // Left border
@@ -299,11 +338,13 @@ bool PlayerCollisionManager::handleCollisionsWithCameraBorders(const SDL_FRect p
 }
 
 bool PlayerCollisionManager::handleCollisionsWithDeathZones(const Player &player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithDeathZones");
     size_t i = 0;
-    const std::vector<Polygon> &deathZones = gamePtr->getBroadPhaseManager().getDeathZones();
+    const std::vector<Polygon> &level_death_zones = gamePtr->getLevel()->getZones(PolygonType::DEATH);
+    const std::vector<size_t> &deathZones = gamePtr->getBroadPhaseManager().getDeathZones();
 
     // Check collisions with each death zone until the player is dead
-    while (i < deathZones.size() && !checkSATCollision(player.getVertices(), deathZones[i])) {
+    while (i < deathZones.size() && !checkSATCollision(player.getBoundingBox(), level_death_zones[deathZones[i]])) {
         i++;
     }
 
@@ -311,21 +352,37 @@ bool PlayerCollisionManager::handleCollisionsWithDeathZones(const Player &player
 }
 
 void PlayerCollisionManager::handleCollisionsWithSaveZones(Player &player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithSaveZones");
+    const std::vector<AABB> &level_save_zones = gamePtr->getLevel()->getZones(AABBType::SAVE);
+
     // Check collisions with each save zone
-    for (const AABB &save_zone : gamePtr->getBroadPhaseManager().getSaveZones()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getSaveZones()) {
+        const AABB &save_zone = level_save_zones[i];
         // Check a collision is detected and the zone has not yet been reached
         if (static_cast<int>(player.getCurrentZoneID()) == (save_zone.getID() + 1)) return;
         if (checkAABBCollision(player.getBoundingBox(), save_zone.getRect()) && gamePtr->getLevel()->getLastCheckpoint() < save_zone.getID()) {
             gamePtr->getLevel()->setLastCheckpoint(static_cast<short>(save_zone.getID()));
             player.setCurrentZoneID(save_zone.getID() + 1);
+            if (gamePtr->getRollbackManager().getIsResimulating()) continue; // Already reported when the tick was first simulated
             std::cout << "Checkpoint reached: " << save_zone.getID() << std::endl;
+
+#ifndef HEADLESS
+            // Prepare the next level in the background once the last checkpoint is reached, a server has nothing to draw
+            if (save_zone.getID() + 1 == static_cast<int>(level_save_zones.size())) {
+                gamePtr->getLevelPreloader().preload(gamePtr->getLevel()->getNextMapName());
+            }
+#endif
         }
     }
 }
 
 void PlayerCollisionManager::handleCollisionsWithRescueZones(const Player &player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithRescueZones");
+    const std::vector<AABB> &level_rescue_zones = gamePtr->getLevel()->getZones(AABBType::RESCUE);
+
     // Check collisions with each rescue zone
-    for (const AABB &zone : gamePtr->getBroadPhaseManager().getRescueZones()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getRescueZones()) {
+        const AABB &zone = level_rescue_zones[i];
         // Check a collision is detected
         if (checkAABBCollision(player.getBoundingBox(), zone.getRect())) {
             gamePtr->getPlayerManager().setCurrentRescueZone(zone);
@@ -334,11 +391,12 @@ void PlayerCollisionManager::handleCollisionsWithRescueZones(const Player &playe
 }
 
 void PlayerCollisionManager::handleCollisionsWithToggleGravityZones(Player &player, double delta_time) {
-    const std::vector<AABB> &toggleGravityZones = gamePtr->getBroadPhaseManager().getToggleGravityZones();
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithToggleGravityZones");
+    const std::vector<AABB> &level_toggle_gravity_zones = gamePtr->getLevel()->getZones(AABBType::TOGGLE_GRAVITY);
 
     // Check collisions with each toggle gravity zone
-    for (size_t i = 0; i < toggleGravityZones.size(); ++i) {
-        const AABB &toggleGravityZone = toggleGravityZones[i];
+    for (size_t i : gamePtr->getBroadPhaseManager().getToggleGravityZones()) {
+        const AABB &toggleGravityZone = level_toggle_gravity_zones[i];
         const SDL_FRect &playerBoundingBox = player.getBoundingBox();
         const SDL_FRect &toggleGravityRect = toggleGravityZone.getRect();
 
@@ -371,8 +429,12 @@ void PlayerCollisionManager::handleCollisionsWithToggleGravityZones(Player &play
 }
 
 void PlayerCollisionManager::handleCollisionsWithIncreaseFallSpeedZones(Player &player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithIncreaseFallSpeedZones");
+    const std::vector<AABB> &level_increase_fall_speed_zones = gamePtr->getLevel()->getZones(AABBType::INCREASE_FALL_SPEED);
+
     // Check collisions with each increase fall speed zone
-    for (const auto & increaseFallSpeedZone : gamePtr->getBroadPhaseManager().getIncreaseFallSpeedZones()) {
+    for (size_t i : gamePtr->getBroadPhaseManager().getIncreaseFallSpeedZones()) {
+        const AABB &increaseFallSpeedZone = level_increase_fall_speed_zones[i];
         // Check if the player is already in the increase fall speed zone
         if (checkAABBCollision(player.getBoundingBox(), increaseFallSpeedZone.getRect())) {
             player.setMaxFallSpeed(1300);
@@ -384,39 +446,58 @@ void PlayerCollisionManager::handleCollisionsWithIncreaseFallSpeedZones(Player &
 }
 
 void PlayerCollisionManager::handleCollisionsWithSizePowerUps(Player *player) {
-    // Check for collisions with each item
-    for (SizePowerUp &item : gamePtr->getBroadPhaseManager().getSizePowerUps()) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithSizePowerUps");
+    BroadPhaseManager &broad_phase_manager = gamePtr->getBroadPhaseManager();
+    std::vector<SizePowerUp> &level_items = gamePtr->getLevel()->getSizePowerUp();
+    const std::vector<size_t> &items = broad_phase_manager.getSizePowerUps();
+
+    // Check for collisions with each item, from the last one so removals do not shift the remaining indices
+    for (size_t position = items.size(); position-- > 0;) {
+        SizePowerUp &item = level_items[items[position]];
         // If a collision is detected, apply item's effect to the player and erase it
         if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
             item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromSizePowerUp(item);
+            broad_phase_manager.removeSizePowerUp(position);
         }
     }
 }
 
 void PlayerCollisionManager::handleCollisionsWithSpeedPowerUps(Player *player) {
-    // Check for collisions with each item
-    for (SpeedPowerUp &item : gamePtr->getBroadPhaseManager().getSpeedPowerUps()) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithSpeedPowerUps");
+    BroadPhaseManager &broad_phase_manager = gamePtr->getBroadPhaseManager();
+    std::vector<SpeedPowerUp> &level_items = gamePtr->getLevel()->getSpeedPowerUp();
+    const std::vector<size_t> &items = broad_phase_manager.getSpeedPowerUps();
+
+    // Check for collisions with each item, from the last one so removals do not shift the remaining indices
+    for (size_t position = items.size(); position-- > 0;) {
+        SpeedPowerUp &item = level_items[items[position]];
         // If a collision is detected, apply item's effect to the player and erase it
         if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
             item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromSpeedPowerUp(item);
+            broad_phase_manager.removeSpeedPowerUp(position);
         }
     }
 }
 
 void PlayerCollisionManager::handleCollisionsWithCoins(Player *player) {
-    // Check for collisions with each item
-    for (Coin &item : gamePtr->getBroadPhaseManager().getCoins()) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithCoins");
+    BroadPhaseManager &broad_phase_manager = gamePtr->getBroadPhaseManager();
+    std::vector<Coin> &level_items = gamePtr->getLevel()->getCoins();
+    const std::vector<size_t> &items = broad_phase_manager.getCoins();
+
+    // Check for collisions with each item, from the last one so removals do not shift the remaining indices
+    for (size_t position = items.size(); position-- > 0;) {
+        Coin &item = level_items[items[position]];
         // If a collision is detected, apply item's effect to the player and erase it
         if (checkAABBCollision(player->getBoundingBox(), item.getBoundingBox())) {
             item.applyEffect(*player);
-            gamePtr->getLevel()->removeItemFromCoins(item);
+            broad_phase_manager.removeCoin(position);
         }
     }
 }
 
 void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithItem");
     //section check if the time of the power has not passed
 
     //checks if the queue is empty
@@ -428,7 +509,7 @@ void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
             //we get the first element of the queue
             GameData* current = timeQueue.front();
             //check if the time of the power has passed
-            if (difftime(time(nullptr) ,current->t) >= 4){
+            if (SimulationClock::getTime() >= current->t + POWER_UP_DURATION){
                 //we remove the element form the queue since is not necessary
                 current->item->inverseEffect(*player);
                 timeQueue.pop();
@@ -445,22 +526,27 @@ void PlayerCollisionManager::handleCollisionsWithItem(Player *player) {
     }
 
     //section to get the new power
-    for(Item* item : gamePtr->getLevel()->getItems()){
+    BroadPhaseManager &broad_phase_manager = gamePtr->getBroadPhaseManager();
+    const std::vector<Item*> &level_items = gamePtr->getLevel()->getItems();
+    const std::vector<size_t> &items = broad_phase_manager.getItems();
+    for (size_t position = items.size(); position-- > 0;) {
+        Item *item = level_items[items[position]];
         // If a collision is detected, apply item's effect to the player and erase it
         if (checkAABBCollision(player->getBoundingBox(), item->getBoundingBox())) {
             item->applyEffect(*player);
             auto* data = static_cast<GameData *>(calloc(1, sizeof(GameData)));
             //initialise the gameData
-            time(&data->t);
+            data->t = SimulationClock::getTime();
             data->item = item;
             timeQueue.push(data);
-            gamePtr->getLevel()->removeItem(*item);
+            broad_phase_manager.removeItem(position);
         }
     }
 
 }
 
 bool PlayerCollisionManager::handleCollisionsWithDeadPlayers(const Player *player) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisionsWithDeadPlayers");
     // Check for collisions with each dead player
     for (Player &dead_player : gamePtr->getPlayerManager().getDeadPlayers()) {
         // If a collision is detected, respawn the dead player
@@ -473,6 +559,7 @@ bool PlayerCollisionManager::handleCollisionsWithDeadPlayers(const Player *playe
 }
 
 void PlayerCollisionManager::handleCollisions(double delta_time) {
+    ProfileZone zone("PlayerCollisionManager::handleCollisions");
     // Handle collisions for each living player
     for (Player &player: gamePtr->getPlayerManager().getAlivePlayers()) {
         player.updateCollisionBox();
@@ -0,0 +1,57 @@
+#include "../../../include/Game/GameManagers/PredictionManager.h"
+
+/**
+ * @file PredictionManager.cpp
+ * @brief Implements the PredictionManager class responsible for reconciling the predicted local player with the server.
+ */
+
+/* CONSTRUCTORS */
+
+PredictionManager::PredictionManager(Game *game) : gamePtr(game) {}
+
+
+/* METHODS */
+
+void PredictionManager::recordTick() {
+    ProfileZone zone("PredictionManager::recordTick");
+    Player const *playerPtr = gamePtr->getPlayerManager().findPlayerById(-1);
+    if (playerPtr == nullptr) return;
+
+    auto tick = static_cast<uint32_t>(SimulationClock::getTick());
+    Buffer buffer = playerPtr->getBuffer();
+    history[tick % historySize] = {tick, playerPtr->getX() + buffer.deltaX, playerPtr->getY() + buffer.deltaY};
+}
+
+bool PredictionManager::reconcile(Player &player, float serverX, float serverY, uint32_t inputTick) {
+    // The server did not apply a newer input, this state is already taken into account
+    if (inputTick <= lastReconciledTick) return true;
+
+    PredictedState &acknowledged = history[inputTick % historySize];
+    if (acknowledged.tick != inputTick) return false;
+    lastReconciledTick = inputTick;
+
+    // Error of the prediction at the acknowledged tick
+    float errorX = serverX - acknowledged.x;
+    float errorY = serverY - acknowledged.y;
+    if (std::abs(errorX) < correctionThreshold && std::abs(errorY) < correctionThreshold) return true;
+
+    // Rewind to the server state and replay the movement of the ticks it has not seen yet: they moved the player by the
+    // same amounts from the corrected position, so the recorded states are shifted by the error
+    auto currentTick = static_cast<uint32_t>(SimulationClock::getTick());
+    for (PredictedState &state : history) {
+        if (state.tick >= inputTick && state.tick <= currentTick) {
+            state.x += errorX;
+            state.y += errorY;
+        }
+    }
+
+    // The player reaches the replayed position over the next frames through its buffer
+    Buffer buffer = player.getBuffer();
+    player.setBuffer({buffer.deltaX + errorX, buffer.deltaY + errorY});
+    return true;
+}
+
+void PredictionManager::clear() {
+    history.fill({});
+    lastReconciledTick = 0;
+}
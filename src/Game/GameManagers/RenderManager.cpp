@@ -9,26 +9,31 @@
 /* CONSTRUCTORS */
 
 std::vector<TTF_Font*> RenderManager::fonts;
+std::vector<std::unique_ptr<GlyphAtlas>> RenderManager::glyphAtlases;
 
 RenderManager::RenderManager(SDL_Renderer *renderer, Game *game) : renderer(renderer), gamePtr(game) {
 
     // Load the textures
-    if (!Player::loadTextures(*renderer)) {
+    if (!Player::loadTextures(*renderer, spriteAtlas)) {
         std::cerr << "Error loading player textures" << std::endl;
         exit(1);
     }
-    if (!Asteroid::loadTextures(*renderer)) {
+    if (!Asteroid::loadTextures(*renderer, spriteAtlas)) {
         std::cerr << "Error loading asteroid textures" << std::endl;
         exit(1);
     }
-    if(!Coin::loadTexture(*renderer)){
+    if(!Coin::loadTexture(*renderer, spriteAtlas)){
         std::cerr << "Error loading coin textures" << std::endl;
         exit(1);
     }
-    // Load the fonts
-    TTF_Font *font16 = TTF_OpenFont("assets/font/arial.ttf", 16);
-    TTF_Font *font24 = TTF_OpenFont("assets/font/arial.ttf", 24);
-    for (TTF_Font const* font : fonts) {
+
+    // Pack the sprites and load the fonts, the dedicated server never draws and does not initialize SDL_ttf
+#ifndef HEADLESS
+    spriteAtlas.build(*renderer);
+
+    TTF_Font *font16 = TTF_OpenFont(FONT_FILE, 16);
+    TTF_Font *font24 = TTF_OpenFont(FONT_FILE, 24);
+    for (TTF_Font const* font : {font16, font24}) {
         if (font == nullptr) {
             std::cerr << "Error loading font: " << TTF_GetError() << std::endl;
             exit(1);
@@ -37,6 +42,12 @@ RenderManager::RenderManager(SDL_Renderer *renderer, Game *game) : renderer(rend
 
     fonts.push_back(font16);
     fonts.push_back(font24);
+
+    // Rasterize the glyphs of each font once, the text is then drawn from the atlases
+    for (TTF_Font *font : fonts) {
+        glyphAtlases.push_back(std::make_unique<GlyphAtlas>(renderer, font));
+    }
+#endif
 }
 
 
@@ -50,6 +61,10 @@ std::vector<TTF_Font *> &RenderManager::getFonts() {
     return fonts;
 }
 
+std::vector<std::unique_ptr<GlyphAtlas>> &RenderManager::getGlyphAtlases() {
+    return glyphAtlases;
+}
+
 void RenderManager::setRenderTextures(bool renderTextures) {
     render_textures = renderTextures;
 }
@@ -93,11 +108,14 @@ void RenderManager::toggleRenderFps() {
 
 /* METHODS */
 
-void RenderManager::render() {
+void RenderManager::render(float interpolation) {
+    ProfileZone zone("RenderManager::render");
     Level *level = gamePtr->getLevel();
     PlayerManager &playerManager = gamePtr->getPlayerManager();
 
-    Point camera_point = gamePtr->getCamera()->getRenderingPoint();
+    const VisibleSet &visible = gamePtr->getBroadPhaseManager().getVisibleSet();
+
+    Point camera_point = gamePtr->getCamera()->getRenderingPoint(interpolation);
 
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     SDL_RenderClear(renderer);
@@ -107,18 +125,24 @@ void RenderManager::render() {
         // Draw the environment
         level->renderBackgrounds(renderer, camera_point); // Draw the background
 
-        level->renderPolygonsDebug(renderer, camera_point); // Draw the obstacles
-        level->renderItems(renderer, camera_point); // Draw the items
-        level->renderLevers(renderer, camera_point); // Draw the levers
+        level->renderPolygonsDebug(renderer, camera_point, visible); // Draw the obstacles
 
-        // Draw the players
-        for (Player &player : playerManager.getDeadPlayers()) player.render(renderer, camera_point);
-        for (Player &player : playerManager.getNeutralPlayers()) player.render(renderer, camera_point);
-        for (Player &player : playerManager.getAlivePlayers()) player.render(renderer, camera_point);
+        // Queue the sprites of the level objects and the players
+        {
+            ProfileZone sprites_zone("RenderManager::render sprites");
+            level->renderItems(renderer, camera_point, visible); // Draw the items
+            level->renderLevers(renderer, camera_point, visible); // Draw the levers
+
+            // Draw the players
+            for (Player &player : playerManager.getDeadPlayers()) player.render(renderer, camera_point, interpolation);
+            for (Player &player : playerManager.getNeutralPlayers()) player.render(renderer, camera_point, interpolation);
+            for (Player &player : playerManager.getAlivePlayers()) player.render(renderer, camera_point, interpolation);
 
-        level->renderAsteroids(renderer, camera_point); // Draw the asteroids
-        level->renderPlatforms(renderer, camera_point); // Draw the platforms
-        level->renderTraps(renderer, camera_point); // Draw the traps
+            level->renderAsteroids(renderer, camera_point, interpolation); // Draw the asteroids
+            level->renderPlatforms(renderer, camera_point, visible, interpolation); // Draw the platforms
+            level->renderTraps(renderer, camera_point, visible, interpolation); // Draw the traps
+        }
+        RenderQueue::flush(renderer); // Draw the sprites queued above, batched by texture
 
         level->renderMiddleground(renderer, camera_point); // Draw the middleground
         level->renderForegrounds(renderer, camera_point); // Draw the foreground
@@ -126,31 +150,29 @@ void RenderManager::render() {
 
     // Render collision boxes
     else {
-        level->renderAsteroidsDebug(renderer, camera_point); // Draw the asteroids
-        level->renderPolygonsDebug(renderer, camera_point); // Draw the obstacles
-        level->renderLeversDebug(renderer, camera_point); // Draw the levers
-        level->renderPlatformsDebug(renderer, camera_point); // Draw the platforms
-        level->renderTrapsDebug(renderer, camera_point); // Draw the traps
-        level->renderItemsDebug(renderer, camera_point); // Draw the items
+        level->renderAsteroidsDebug(renderer, camera_point, interpolation); // Draw the asteroids
+        level->renderPolygonsDebug(renderer, camera_point, visible); // Draw the obstacles
+        level->renderLeversDebug(renderer, camera_point, visible); // Draw the levers
+        level->renderPlatformsDebug(renderer, camera_point, visible, interpolation); // Draw the platforms
+        level->renderTrapsDebug(renderer, camera_point, visible, interpolation); // Draw the traps
+        level->renderItemsDebug(renderer, camera_point, visible); // Draw the items
 
         // Draw the players
-        for (const Player &player : playerManager.getDeadPlayers()) player.renderDebug(renderer, camera_point);
-        for (const Player &player : playerManager.getNeutralPlayers()) player.renderDebug(renderer, camera_point);
-        for (const Player &player : playerManager.getAlivePlayers()) player.renderDebug(renderer, camera_point);
+        for (const Player &player : playerManager.getDeadPlayers()) player.renderDebug(renderer, camera_point, interpolation);
+        for (const Player &player : playerManager.getNeutralPlayers()) player.renderDebug(renderer, camera_point, interpolation);
+        for (const Player &player : playerManager.getAlivePlayers()) player.renderDebug(renderer, camera_point, interpolation);
 
     }
 
     // Render the fps counter
     if (render_fps) {
         SDL_Color color = {160, 160, 160, 255};
-        SDL_Surface *surface = TTF_RenderUTF8_Blended(fonts[0], std::to_string(gamePtr->getEffectiveFrameRate()).c_str(), color);
-        SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_Rect rect = {10, 10, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-        SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
+        glyphAtlases[0]->render(renderer, std::to_string(gamePtr->getEffectiveFrameRate()), 10, 10, color);
     }
 
+    // Render the time spent in each zone of the game thread
+    if (Profiler::isOverlayShown()) renderProfilerOverlay();
+
     // Render the camera point
     if (render_camera_point) {
         Point averagePlayersPosition = playerManager.getAveragePlayerPosition();
@@ -181,5 +203,33 @@ void RenderManager::render() {
         Mediator::renderMenu();
     }
 
+    ProfileZone present_zone("RenderManager::render present");
     SDL_RenderPresent(renderer);
-}
\ No newline at end of file
+}
+
+void RenderManager::renderProfilerOverlay() {
+    GlyphAtlas &atlas = *glyphAtlases[0];
+
+    // Indent each zone under its parent
+    std::vector<std::string> lines = {"Zone: average / max ms per frame"};
+    for (const ZoneSummary &zone : Profiler::getZoneSummaries()) {
+        lines.push_back(std::format("{}{}  {:.2f} / {:.2f}", std::string(zone.depth * 2, ' '), zone.name,
+                                    zone.averageMilliseconds, zone.maxMilliseconds));
+    }
+
+    // Darken the area behind the text to keep it readable over the level
+    int width = 0;
+    for (const std::string &line : lines) width = std::max(width, atlas.getTextSize(line).x);
+    int line_height = atlas.getTextSize(lines[0]).y;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 160);
+    SDL_Rect background = {45, 5, width + 10, static_cast<int>(lines.size()) * line_height + 10};
+    SDL_RenderFillRect(renderer, &background);
+
+    SDL_Color color = {230, 230, 230, 255};
+    int y = 10;
+    for (const std::string &line : lines) {
+        atlas.render(renderer, line, 50, y, color);
+        y += line_height;
+    }
+}
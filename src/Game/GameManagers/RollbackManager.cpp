@@ -0,0 +1,222 @@
+#include "../../../include/Game/GameManagers/RollbackManager.h"
+
+/**
+ * @file RollbackManager.cpp
+ * @brief Implements the RollbackManager class responsible for resimulating the game when inputs arrive late.
+ */
+
+/* CONSTRUCTORS */
+
+RollbackManager::RollbackManager(Game *game) : gamePtr(game) {}
+
+
+/* ACCESSORS */
+
+bool RollbackManager::getIsResimulating() const {
+    return isResimulating;
+}
+
+
+/* METHODS */
+
+void RollbackManager::saveTick() {
+    ProfileZone zone("RollbackManager::saveTick");
+    Uint64 tick = SimulationClock::getTick();
+    WorldState &state = history[tick % historySize];
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+
+    // The local input of the tick is already applied by the keyboard events, the remote ones are applied during the step
+    state.tick = tick;
+    saveWorld(state);
+    state.spawnedAsteroids.clear();
+
+    // The remote players are predicted to keep their last keyboard state
+    uint16_t localMask = Mediator::encodeKeyboardStateMask(SDL_GetKeyboardState(nullptr));
+    state.inputs.clear();
+    for (const Player &player : playerManager.getAlivePlayers()) {
+        int playerID = player.getPlayerID();
+        auto lastMask = lastMasks.find(playerID);
+        uint16_t mask = playerID == -1 ? localMask : lastMask != lastMasks.end() ? lastMask->second : 0;
+        state.inputs.push_back({playerID, mask});
+    }
+}
+
+bool RollbackManager::receiveInput(int playerID, uint16_t keyboardStateMask, Uint64 tick) {
+    Uint64 currentTick = SimulationClock::getTick();
+
+    // An older update overtaken by a newer one only applies to the ticks before the newer one
+    auto lastInputTick = lastInputTicks.find(playerID);
+    bool isNewest = lastInputTick == lastInputTicks.end() || lastInputTick->second <= tick;
+    if (isNewest) {
+        lastMasks[playerID] = keyboardStateMask;
+        lastInputTicks[playerID] = tick;
+    }
+
+    // An input of the tick being simulated or of a later one is applied now, as well as one too old to resimulate
+    if (tick >= currentTick || findState(tick) == nullptr || findState(tick - 1) == nullptr) {
+        if (!isNewest) return true; // Applying an overtaken input now would override the newer one, it is dropped
+        if (WorldState *state = findState(currentTick)) {
+            if (PlayerInput *input = findInput(state->inputs, playerID)) input->keyboardStateMask = keyboardStateMask;
+        }
+        return false;
+    }
+
+    // Replace the prediction of every tick the input covers, an update stamped after the present only covers the ticks kept
+    Uint64 lastTick = isNewest ? currentTick : std::min(lastInputTick->second - 1, currentTick);
+    for (Uint64 t = tick; t <= lastTick; t++) {
+        if (WorldState *state = findState(t)) {
+            if (PlayerInput *input = findInput(state->inputs, playerID)) input->keyboardStateMask = keyboardStateMask;
+        }
+    }
+
+    rollbackTick = rollbackTick == 0 ? tick : std::min(rollbackTick, tick);
+    return true;
+}
+
+void RollbackManager::recordAsteroid(const Asteroid &asteroid) {
+    if (WorldState *state = findState(SimulationClock::getTick())) state->spawnedAsteroids.push_back(asteroid);
+}
+
+void RollbackManager::resimulate() {
+    ProfileZone zone("RollbackManager::resimulate");
+    if (rollbackTick == 0) return;
+
+    Uint64 firstTick = rollbackTick;
+    Uint64 currentTick = SimulationClock::getTick();
+    rollbackTick = 0;
+
+    WorldState const *first = findState(firstTick);
+    WorldState const *previous = findState(firstTick - 1);
+    if (first == nullptr || previous == nullptr) return;
+
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+    restoreWorld(*first);
+
+    // Only the keys changed during a step trigger key events, the saved local player already holds the keys of the first tick
+    for (const PlayerInput &input : previous->inputs) {
+        if (input.playerID != -1) Mediator::setKeyboardStateMask(input.playerID, input.keyboardStateMask);
+    }
+    for (const PlayerInput &input : first->inputs) {
+        if (input.playerID == -1) Mediator::setKeyboardStateMask(input.playerID, input.keyboardStateMask);
+    }
+
+    // The sounds of the replayed ticks were already played when they were first simulated
+    isResimulating = true;
+    SoundEffect::setMuted(true);
+    for (Uint64 tick = firstTick; tick < currentTick; tick++) {
+        WorldState &state = history[tick % historySize];
+        SimulationClock::setTick(tick);
+
+        // Save the corrected world the same way as a live step, the local input before the save and the remote ones after
+        if (tick != firstTick) {
+            if (PlayerInput *input = findInput(state.inputs, -1)) {
+                if (Player *playerPtr = playerManager.findPlayerById(-1)) Mediator::applyKeyboardStateMask(playerPtr, input->keyboardStateMask);
+            }
+            saveWorld(state);
+        }
+
+        for (const PlayerInput &input : state.inputs) {
+            if (input.playerID == -1) continue;
+            if (Player *playerPtr = playerManager.findPlayerById(input.playerID)) Mediator::applyKeyboardStateMask(playerPtr, input.keyboardStateMask);
+        }
+
+        // The messages are not replayed, the asteroids they spawned at the start of the step are added again
+        for (const Asteroid &asteroid : state.spawnedAsteroids) gamePtr->getLevel()->addAsteroid(asteroid);
+
+        gamePtr->resimulate(SimulationClock::TIME_STEP);
+    }
+    isResimulating = false;
+    SoundEffect::setMuted(false);
+}
+
+bool RollbackManager::restoreTick(Uint64 tick) {
+    WorldState const *state = findState(tick);
+    if (state == nullptr) return false;
+    restoreWorld(*state);
+    return true;
+}
+
+void RollbackManager::clear() {
+    // Items are saved only when their generation changes, the generations of a previous level must not be compared
+    for (WorldState &state : history) {
+        state.tick = 0;
+        state.level.sizePowerUpGeneration = 0;
+        state.level.speedPowerUpGeneration = 0;
+        state.level.coinsGeneration = 0;
+        state.level.itemsGeneration = 0;
+    }
+    rollbackTick = 0;
+
+    // The ticks of the last updates may come from a previous clock, a player may come back under the same ID
+    lastMasks.clear();
+    lastInputTicks.clear();
+}
+
+PlayerInput *RollbackManager::findInput(std::vector<PlayerInput> &inputs, int playerID) {
+    auto input = std::ranges::find(inputs, playerID, &PlayerInput::playerID);
+    return input != inputs.end() ? &*input : nullptr;
+}
+
+void RollbackManager::saveWorld(WorldState &state) {
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+    gamePtr->getLevel()->saveState(state.level);
+    state.camera = gamePtr->getCamera()->getState();
+    savePlayers(playerManager.getAlivePlayers(), state.alivePlayers);
+    savePlayers(playerManager.getNeutralPlayers(), state.neutralPlayers);
+    savePlayers(playerManager.getDeadPlayers(), state.deadPlayers);
+}
+
+void RollbackManager::restoreWorld(const WorldState &state) {
+    gamePtr->getLevel()->restoreState(state.level);
+    gamePtr->getCamera()->setState(state.camera);
+    restorePlayers(state);
+
+    // The last broad phase of the saved tick ran with the same camera and positions, only the frozen flags are not rebuilt
+    gamePtr->getBroadPhaseManager().broadPhase();
+    gamePtr->getLevel()->restoreBodyFlags(state.level);
+}
+
+void RollbackManager::savePlayers(const std::vector<Player> &players, std::vector<PlayerSimulationState> &states) {
+    states.clear();
+    for (const Player &player : players) states.push_back(player.getState());
+}
+
+void RollbackManager::restorePlayers(const WorldState &state) {
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+    std::array<std::vector<Player> *, 3> lists = {&playerManager.getAlivePlayers(), &playerManager.getNeutralPlayers(), &playerManager.getDeadPlayers()};
+    std::array<const std::vector<PlayerSimulationState> *, 3> savedLists = {&state.alivePlayers, &state.neutralPlayers, &state.deadPlayers};
+
+    // Usually every player is still in its saved list at the same index, its state is restored in place
+    bool isSameOrder = true;
+    for (size_t i = 0; i < lists.size(); i++) {
+        isSameOrder = isSameOrder && std::ranges::equal(*lists[i], *savedLists[i], {}, &Player::getPlayerID, &PlayerSimulationState::playerID);
+    }
+    if (isSameOrder) {
+        for (size_t i = 0; i < lists.size(); i++) {
+            for (size_t j = 0; j < lists[i]->size(); j++) (*lists[i])[j].setState((*savedLists[i])[j]);
+        }
+        return;
+    }
+
+    // Otherwise the players are taken out of the lists and put back in their saved order, the players are kept during a rollback
+    movedPlayers.clear();
+    for (std::vector<Player> *players : lists) {
+        std::ranges::move(*players, std::back_inserter(movedPlayers));
+        players->clear();
+    }
+    for (size_t i = 0; i < lists.size(); i++) {
+        for (const PlayerSimulationState &playerState : *savedLists[i]) {
+            auto player = std::ranges::find(movedPlayers, playerState.playerID, &Player::getPlayerID);
+            if (player == movedPlayers.end()) continue;
+            lists[i]->push_back(std::move(*player));
+            lists[i]->back().setState(playerState);
+        }
+    }
+}
+
+WorldState *RollbackManager::findState(Uint64 tick) {
+    // The slot may hold a newer or an older tick, the tick 0 marks an empty slot
+    if (tick == 0) return nullptr;
+    WorldState &state = history[tick % historySize];
+    return state.tick == tick ? &state : nullptr;
+}
@@ -122,6 +122,7 @@ bool SaveManager::loadGameState() {
         // Load the game state
         Level *level = gamePtr->getLevel();
         *level = Level(game_state_json["level"], gamePtr->getRenderManager().getRenderer(), &gamePtr->getTextureManager());
+        gamePtr->getBroadPhaseManager().clear();
         level->setLastCheckpoint(game_state_json["lastCheckpoint"]);
         gamePtr->setPlaytime(game_state_json["playtime"]);
 
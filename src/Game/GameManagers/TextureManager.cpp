@@ -40,9 +40,7 @@ std::vector<SDL_Texture*>& TextureManager::getForegrounds() {
 /* METHODS */
 
 void TextureManager::loadMiddlegroundTexture(SDL_Renderer *renderer, int level_id) {
-    std::string folder_path = std::format("{}world_{}/environment/", TEXTURES_DIRECTORY, level_id); // Get the folder path
-    std::string file_path = std::format("{}middlegrounds/level_{}.png", folder_path, level_id); // Get the file path
-    middleground = IMG_LoadTexture(renderer, file_path.c_str());
+    middleground = loadImage(*renderer, getMiddlegroundPath(level_id), false);
 
     if (middleground == nullptr) {
         std::cerr << "Error loading middleground texture" << std::endl;
@@ -67,12 +65,7 @@ void TextureManager::loadPlatformTextures(SDL_Renderer &renderer) {
     file.close();
 
     // Count the number of files in the folder
-    int file_count = 0;
-    for (const auto& entry : std::filesystem::directory_iterator(folder_path)) {
-        if (std::filesystem::is_regular_file(entry) && entry.path().extension() == ".png") {
-            file_count++;
-        }
-    }
+    int file_count = countImages(folder_path);
 
     // Check if every texture has its properties
     if (file_count > static_cast<int>(j["offsets"].size())) {
@@ -83,7 +76,7 @@ void TextureManager::loadPlatformTextures(SDL_Renderer &renderer) {
     // Load all the textures of the platforms
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}platform_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = loadImage(renderer, file_path, true);
         float x = j["offsets"][i][0];
         float y = j["offsets"][i][1];
         float w = j["offsets"][i][2];
@@ -95,7 +88,7 @@ void TextureManager::loadPlatformTextures(SDL_Renderer &renderer) {
 
 void TextureManager::loadTreadmillTexture(SDL_Renderer &renderer){
     std::string file_path = std::format("{}world_{}/treadmill.png", SPRITES_DIRECTORY, worldID); // Get the file path
-    SDL_Texture *texture = IMG_LoadTexture(&renderer, file_path.c_str());
+    SDL_Texture *texture = loadImage(renderer, file_path, true);
 
     if (texture == nullptr) {
         std::cerr << "Error loading treadmill texture" << std::endl;
@@ -121,12 +114,7 @@ void TextureManager::loadCrusherTextures(SDL_Renderer &renderer) {
     file.close();
 
     // Count the number of files in the folder
-    int file_count = 0;
-    for (const auto& entry : std::filesystem::directory_iterator(folder_path)) {
-        if (std::filesystem::is_regular_file(entry) && entry.path().extension() == ".png") {
-            file_count++;
-        }
-    }
+    int file_count = countImages(folder_path);
 
     // Check if every texture has its properties
     if (file_count > static_cast<int>(j["offsets"].size())) {
@@ -137,7 +125,7 @@ void TextureManager::loadCrusherTextures(SDL_Renderer &renderer) {
     // Load all the textures of the crushers
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}crusher_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = loadImage(renderer, file_path, true);
 
         if (new_texture == nullptr) {
             std::cerr << "Error loading crusher textures" << std::endl;
@@ -155,7 +143,7 @@ void TextureManager::loadCrusherTextures(SDL_Renderer &renderer) {
 
 void TextureManager::loadLeverTexture(SDL_Renderer &renderer) {
     std::string file_path = std::format("{}world_{}/lever.png", TEXTURES_DIRECTORY, worldID); // Get the file path
-    lever = IMG_LoadTexture(&renderer, file_path.c_str());
+    lever = loadImage(renderer, file_path, true);
 
     if (lever == nullptr) {
         std::cerr << "Error loading lever texture" << std::endl;
@@ -169,17 +157,12 @@ void TextureManager::loadBackgroundTextures(SDL_Renderer &renderer) {
     std::string folder_path = std::format("{}world_{}/environment/backgrounds/", TEXTURES_DIRECTORY, worldID); // Get the folder path
 
     // Count the number of files in the folder
-    int file_count = 0;
-    for (const auto& entry : std::filesystem::directory_iterator(folder_path)) {
-        if (std::filesystem::is_regular_file(entry) && entry.path().extension() == ".png") {
-            file_count++;
-        }
-    }
+    int file_count = countImages(folder_path);
 
     // Load all the textures of the backgrounds
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}background_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = loadImage(renderer, file_path, false);
 
         if (new_texture == nullptr) {
             std::cerr << "Error loading background textures" << std::endl;
@@ -196,17 +179,12 @@ void TextureManager::loadForegroundTextures(SDL_Renderer &renderer) {
     std::string folder_path = std::format("{}world_{}/environment/foregrounds/", TEXTURES_DIRECTORY, worldID); // Get the folder path
 
     // Count the number of files in the folder
-    int file_count = 0;
-    for (const auto& entry : std::filesystem::directory_iterator(folder_path)) {
-        if (std::filesystem::is_regular_file(entry) && entry.path().extension() == ".png") {
-            file_count++;
-        }
-    }
+    int file_count = countImages(folder_path);
 
     // Load all the textures of the backgrounds
     for (int i = 0; i < file_count; i++) {
         std::string file_path = std::format("{}foreground_{}.png", folder_path, i); // Get the file path
-        SDL_Texture *new_texture = IMG_LoadTexture(&renderer, file_path.c_str());
+        SDL_Texture *new_texture = loadImage(renderer, file_path, false);
 
         if (new_texture == nullptr) {
             std::cerr << "Error loading foreground textures" << std::endl;
@@ -219,13 +197,95 @@ void TextureManager::loadForegroundTextures(SDL_Renderer &renderer) {
 
 void TextureManager::loadWorldTextures(SDL_Renderer *renderer, int world_id) {
     worldID = world_id;
+    worldAtlas.clear(); // Free the sprites of the previous world
 
     loadPlatformTextures(*renderer);
     loadTreadmillTexture(*renderer);
     loadCrusherTextures(*renderer);
     loadLeverTexture(*renderer);
+
+    // The decoration layers are never drawn by the dedicated server
+#ifndef HEADLESS
+    worldAtlas.build(*renderer);
     loadBackgroundTextures(*renderer);
     loadForegroundTextures(*renderer);
+#endif
 
     std::cout << "TextureManager: Loaded world textures." << std::endl;
-}
\ No newline at end of file
+}
+
+void TextureManager::setPreloadedImages(std::unordered_map<std::string, PreloadedImage> &&images) {
+    clearPreloadedImages();
+    preloadedImages = std::move(images);
+}
+
+void TextureManager::clearPreloadedImages() {
+    for (auto &[path, image] : preloadedImages) {
+        SDL_DestroyTexture(image.texture);
+        SDL_FreeSurface(image.surface);
+    }
+    preloadedImages.clear();
+}
+
+std::string TextureManager::getMiddlegroundPath(int level_id) {
+    return std::format("{}world_{}/environment/middlegrounds/level_{}.png", TEXTURES_DIRECTORY, level_id, level_id);
+}
+
+std::vector<std::string> TextureManager::getWorldImagePaths(int world_id) {
+    std::vector<std::string> paths;
+
+    std::string platforms_path = std::format("{}world_{}/platforms/", TEXTURES_DIRECTORY, world_id);
+    int platforms_count = countImages(platforms_path);
+    for (int i = 0; i < platforms_count; i++) paths.push_back(std::format("{}platform_{}.png", platforms_path, i));
+
+    paths.push_back(std::format("{}world_{}/treadmill.png", SPRITES_DIRECTORY, world_id));
+
+    std::string crushers_path = std::format("{}world_{}/crushers/", TEXTURES_DIRECTORY, world_id);
+    int crushers_count = countImages(crushers_path);
+    for (int i = 0; i < crushers_count; i++) paths.push_back(std::format("{}crusher_{}.png", crushers_path, i));
+
+    paths.push_back(std::format("{}world_{}/lever.png", TEXTURES_DIRECTORY, world_id));
+
+    // The decoration layers are never drawn by the dedicated server
+#ifndef HEADLESS
+    std::string backgrounds_path = std::format("{}world_{}/environment/backgrounds/", TEXTURES_DIRECTORY, world_id);
+    int backgrounds_count = countImages(backgrounds_path);
+    for (int i = 0; i < backgrounds_count; i++) paths.push_back(std::format("{}background_{}.png", backgrounds_path, i));
+
+    std::string foregrounds_path = std::format("{}world_{}/environment/foregrounds/", TEXTURES_DIRECTORY, world_id);
+    int foregrounds_count = countImages(foregrounds_path);
+    for (int i = 0; i < foregrounds_count; i++) paths.push_back(std::format("{}foreground_{}.png", foregrounds_path, i));
+#endif
+
+    return paths;
+}
+
+SDL_Texture *TextureManager::loadImage(SDL_Renderer &renderer, const std::string &file_path, bool atlased) {
+    auto preloaded = preloadedImages.find(file_path);
+    if (preloaded == preloadedImages.end()) {
+        return atlased ? worldAtlas.loadTexture(renderer, file_path) : IMG_LoadTexture(&renderer, file_path.c_str());
+    }
+
+    PreloadedImage image = preloaded->second;
+    preloadedImages.erase(preloaded);
+    if (image.texture == nullptr) image.texture = SDL_CreateTextureFromSurface(&renderer, image.surface);
+    if (image.texture == nullptr) {
+        SDL_FreeSurface(image.surface);
+        return nullptr;
+    }
+
+    if (atlased) return worldAtlas.addTexture(image.texture, image.surface);
+    SDL_FreeSurface(image.surface);
+    return image.texture;
+}
+
+int TextureManager::countImages(const std::string &folder_path) {
+    int file_count = 0;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(folder_path, error)) {
+        if (std::filesystem::is_regular_file(entry) && entry.path().extension() == ".png") {
+            file_count++;
+        }
+    }
+    return file_count;
+}
@@ -33,9 +33,9 @@ void Coin::setValue(int newValue) {
 
 /* METHODS */
 
-bool Coin::loadTexture(SDL_Renderer &renderer) {
+bool Coin::loadTexture(SDL_Renderer &renderer, TextureAtlas &atlas) {
     // Load players' sprite texture
-    spriteTexturePtr = IMG_LoadTexture(&renderer, "assets/sprites/items/coins.png");
+    spriteTexturePtr = atlas.loadTexture(renderer, "assets/sprites/items/coins.png");
 
     // Check errors
     if (spriteTexturePtr == nullptr) {
@@ -54,9 +54,9 @@ void Coin::inverseEffect([[maybe_unused]] Player &player) {
     // Do nothing
 }
 
-void Coin::render(SDL_Renderer *renderer, Point camera) {
+void Coin::render([[maybe_unused]] SDL_Renderer *renderer, Point camera) {
     sprite.updateAnimation();
     SDL_Rect srcRect = (*spritePtr).getSrcRect();
     SDL_FRect itemRect = {getX() - camera.x, getY() - camera.y, getWidth(), getHeight()};
-    SDL_RenderCopyExF(renderer, (*spritePtr).getTexture(), &srcRect, &itemRect, 0.0, nullptr, (*spritePtr).getFlip());
+    RenderQueue::draw(RenderLayer::ITEMS, (*spritePtr).getTexture(), srcRect, itemRect, 0.0, (*spritePtr).getFlip());
 }
\ No newline at end of file
@@ -6,24 +6,153 @@
  */
 
 
+/* SPATIAL INDEX HELPERS */
+
+/**
+ * @brief Fill a grid with the bounding boxes of a collection of objects.
+ * @param grid The grid to fill.
+ * @param objects The collection of objects, each index in the grid refers to this collection.
+ */
+template <typename T>
+static void fillGrid(SpatialGrid &grid, const std::vector<T> &objects) {
+    grid.clear();
+    for (const T &object : objects) grid.insert(object.getBoundingBox());
+}
+
+static void fillGrid(SpatialGrid &grid, const std::vector<AABB> &zones) {
+    grid.clear();
+    for (const AABB &zone : zones) grid.insert(zone.getRect());
+}
+
+static void fillGrid(SpatialGrid &grid, const std::vector<Item*> &items) {
+    grid.clear();
+    for (const Item *item : items) grid.insert(item->getBoundingBox());
+}
+
+/**
+ * @brief Simulate the objects of a collection that are not frozen, then store their bounding box.
+ * @param bodies The streams of the collection, only their flags are read to skip the frozen objects.
+ * @param objects The collection of objects.
+ * @param apply_movement The function simulating one object.
+ */
+template <typename T, typename F>
+static void moveBodies(BodyStreams &bodies, std::vector<T> &objects, F &&apply_movement) {
+    for (size_t i = 0; i < objects.size(); i++) {
+        if (!bodies.isSimulated(i)) continue;
+        apply_movement(objects[i]);
+        bodies.settle(i);
+        bodies.setBoundingBox(i, objects[i].getBoundingBox());
+    }
+}
+
+
+/* STATE HELPERS */
+
+/**
+ * @brief Copy the state of every object of a collection.
+ * @param objects The collection of objects.
+ * @param[out] states The states, in the order of the collection.
+ */
+template <typename T, typename S>
+static void saveStates(const std::vector<T> &objects, std::vector<S> &states) {
+    states.resize(objects.size());
+    for (size_t i = 0; i < objects.size(); i++) states[i] = objects[i].getState();
+}
+
+/**
+ * @brief Restore the state of every object of a collection.
+ * @param states The states, in the order of the collection.
+ * @param[out] objects The collection of objects.
+ */
+template <typename T, typename S>
+static void restoreStates(const std::vector<S> &states, std::vector<T> &objects) {
+    for (size_t i = 0; i < objects.size() && i < states.size(); i++) objects[i].setState(states[i]);
+}
+
+/**
+ * @brief Copy the isActivated flag of every lever of a collection.
+ * @param levers The collection of levers.
+ * @param[out] states The flags, in the order of the collection.
+ */
+template <typename T>
+static void saveLevers(const std::vector<T> &levers, std::vector<bool> &states) {
+    states.resize(levers.size());
+    for (size_t i = 0; i < levers.size(); i++) states[i] = levers[i].getIsActivated();
+}
+
+/**
+ * @brief Restore the isActivated flag of every lever of a collection.
+ * @param states The flags, in the order of the collection.
+ * @param[out] levers The collection of levers.
+ */
+template <typename T>
+static void restoreLevers(const std::vector<bool> &states, std::vector<T> &levers) {
+    for (size_t i = 0; i < levers.size() && i < states.size(); i++) levers[i].setIsActivated(states[i]);
+}
+
+/**
+ * @brief Copy a collection of items, unless the saved copy already has the same generation.
+ * @param objects The collection of items.
+ * @param generation The generation of the collection.
+ * @param[out] saved The saved items.
+ * @param[out] saved_generation The generation of the saved items.
+ */
+template <typename T>
+static void saveItems(const std::vector<T> &objects, Uint64 generation, std::vector<T> &saved, Uint64 &saved_generation) {
+    if (saved_generation == generation) return;
+    saved = objects;
+    saved_generation = generation;
+}
+
+/**
+ * @brief Restore a saved collection of items, unless the collection already has the same generation.
+ * @param saved The saved items.
+ * @param saved_generation The generation of the saved items.
+ * @param[out] objects The collection of items.
+ * @param[out] generation The generation of the collection.
+ * @return True if the collection was replaced, false otherwise.
+ */
+template <typename T>
+static bool restoreItems(const std::vector<T> &saved, Uint64 saved_generation, std::vector<T> &objects, Uint64 &generation) {
+    if (generation == saved_generation) return false;
+    objects = saved;
+    generation = saved_generation;
+    return true;
+}
+
+
 /* CONSTRUCTORS */
 
 Level::Level(const std::string &map_name, SDL_Renderer *renderer, TextureManager *textureManager) : textureManagerPtr(textureManager) {
     std::cout << "Level: Loading level " << map_name << "..." << std::endl;
 
-    loadMapProperties(map_name);
+    // Read the compiled level when it is up to date, the JSON files otherwise
+    CompiledLevel compiled;
+    bool is_compiled = compiled.open(std::string(MAPS_DIRECTORY) + map_name + "/");
+    is_compiled ? loadMapProperties(compiled) : loadMapProperties(map_name);
+
+    // Load textures and decode the sounds of the world if needed
+    if (textureManager->getWorldID() != worldID) {
+        textureManager->loadWorldTextures(renderer, worldID);
+        SoundBank::preload(SoundBank::worldSounds);
+    }
 
-    // Load textures if needed
-    if (textureManager->getWorldID() != worldID) textureManager->loadWorldTextures(renderer, worldID);
+    // Load map environment, the decoration layers are never drawn by the dedicated server
+#ifndef HEADLESS
     textureManager->loadMiddlegroundTexture(renderer, mapID);
+    is_compiled ? loadEnvironmentFromMap(compiled) : loadEnvironmentFromMap(map_name);
+#endif
+    if (is_compiled) {
+        loadObjectsFromMap(compiled);
+    } else {
+        loadPolygonsFromMap(map_name);
+        loadPlatformsFromMap(map_name);
+        loadTrapsFromMap(map_name);
+        loadLeversFromMap(map_name);
+        loadItemsFromMap(map_name);
+    }
 
-    // Load map environment
-    loadEnvironmentFromMap(map_name);
-    loadPolygonsFromMap(map_name);
-    loadPlatformsFromMap(map_name);
-    loadTrapsFromMap(map_name);
-    loadLeversFromMap(map_name);
-    loadItemsFromMap(map_name);
+    buildGrids();
 }
 
 
@@ -41,11 +170,16 @@ std::string Level::getMapName() const {
     return mapName;
 }
 
+std::string Level::getNextMapName() const {
+    return nextMapName;
+}
+
 std::array<Point, 4> Level::getSpawnPoints(int index) const {
     return spawnPoints[index];
 }
 
-std::vector<Polygon> Level::getZones(PolygonType type) const {
+const std::vector<Polygon>& Level::getZones(PolygonType type) const {
+    static const std::vector<Polygon> no_zones;
     switch(type) {
         using enum PolygonType;
         case COLLISION: return collisionZones;
@@ -55,18 +189,19 @@ std::vector<Polygon> Level::getZones(PolygonType type) const {
         case CINEMATIC: return cinematicZones;
         case BOSS: return bossZones;
         case EVENT: return eventZones;
-        default: return {};
+        default: return no_zones;
     }
 }
 
-std::vector<AABB> Level::getZones(AABBType type) const {
+const std::vector<AABB>& Level::getZones(AABBType type) const {
+    static const std::vector<AABB> no_zones;
     switch(type) {
         using enum AABBType;
         case SAVE: return saveZones;
         case RESCUE: return rescueZones;
         case TOGGLE_GRAVITY: return toggleGravityZones;
         case INCREASE_FALL_SPEED: return increaseFallSpeedZones;
-        default: return {};
+        default: return no_zones;
     }
 }
 
@@ -74,11 +209,11 @@ Music& Level::getMusicById(int id) {
     return musics[id];
 }
 
-std::vector<Asteroid> Level::getAsteroids() const {
+AsteroidPool& Level::getAsteroids() {
     return asteroids;
 }
 
-std::vector<TreadmillLever> Level::getTreadmillLevers() const {
+const std::vector<TreadmillLever>& Level::getTreadmillLevers() const {
     return treadmillLevers;
 }
 
@@ -126,7 +261,7 @@ std::vector<Coin>& Level::getCoins() {
     return coins;
 }
 
-std::vector<Item*> Level::getItems() const {
+const std::vector<Item*>& Level::getItems() const {
     return items;
 }
 
@@ -134,6 +269,14 @@ short Level::getLastCheckpoint() const {
     return lastCheckpoint;
 }
 
+SpatialGrid& Level::getGrid(GridType type) {
+    return grids[static_cast<size_t>(type)];
+}
+
+BodyStreams& Level::getBodies(GridType type) {
+    return bodies[static_cast<size_t>(type)];
+}
+
 
 /* MUTATORS */
 
@@ -141,103 +284,70 @@ void Level::setLastCheckpoint(short checkpoint) {
     lastCheckpoint = checkpoint;
 }
 
-void Level::setAsteroids(std::vector<Asteroid> const &value) {
-    this->asteroids = value;
-}
-
-void Level::activateTreadmillLever(const TreadmillLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(treadmillLevers, lever);
-    if (it != treadmillLevers.end()) {
-        it->toggleIsActivated();
-    }
+void Level::activateTreadmillLever(size_t index) {
+    treadmillLevers[index].toggleIsActivated();
 }
 
-void Level::activatePlatformLever(const PlatformLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(platformLevers, lever);
-    if (it != platformLevers.end()) {
-        it->toggleIsActivated();
-    }
+void Level::activatePlatformLever(size_t index) {
+    platformLevers[index].toggleIsActivated();
 }
 
-void Level::activateCrusherLever(const CrusherLever &lever) {
-    // Search the lever and activate it
-    auto it = std::ranges::find(crusherLevers, lever);
-    if (it != crusherLevers.end()) {
-        it->toggleIsActivated();
-    }
+void Level::activateCrusherLever(size_t index) {
+    crusherLevers[index].toggleIsActivated();
 }
 
-void Level::increaseWeightForPlatform(const WeightPlatform &platform) {
-    // Search the platform and increase its weight
-    auto it = std::ranges::find(weightPlatforms, platform);
-    if (it != weightPlatforms.end()) {
-        it->increaseWeight();
-    }
+void Level::increaseWeightForPlatform(size_t index) {
+    weightPlatforms[index].increaseWeight();
 }
 
-void Level::decreaseWeightForPlatform(const WeightPlatform &platform) {
-    // Search the platform and decrease its weight
-    auto it = std::ranges::find(weightPlatforms, platform);
-    if (it != weightPlatforms.end()) {
-        it->decreaseWeight();
-    }
+void Level::decreaseWeightForPlatform(size_t index) {
+    weightPlatforms[index].decreaseWeight();
 }
 
-void Level::removeItemFromSizePowerUp(SizePowerUp const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(sizePowerUp, item);
-    if (it != sizePowerUp.end()) {
-        sizePowerUp.erase(it);
-    }
+void Level::removeItemFromSizePowerUp(size_t index) {
+    sizePowerUp.erase(sizePowerUp.begin() + static_cast<std::ptrdiff_t>(index));
+    sizePowerUpGeneration = ++lastItemsGeneration;
+    fillGrid(getGrid(GridType::SIZE_POWER_UP), sizePowerUp); // Indices after the item have shifted
 }
 
-void Level::removeItemFromSpeedPowerUp(SpeedPowerUp const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(speedPowerUp, item);
-    if (it != speedPowerUp.end()) {
-        speedPowerUp.erase(it);
-    }
+void Level::removeItemFromSpeedPowerUp(size_t index) {
+    speedPowerUp.erase(speedPowerUp.begin() + static_cast<std::ptrdiff_t>(index));
+    speedPowerUpGeneration = ++lastItemsGeneration;
+    fillGrid(getGrid(GridType::SPEED_POWER_UP), speedPowerUp); // Indices after the item have shifted
 }
 
-void Level::removeItemFromCoins(Coin const &item) {
-    // Search the item and remove it
-    auto it = std::ranges::find(coins, item);
-    if (it != coins.end()) {
-        coins.erase(it);
-    }
+void Level::removeItemFromCoins(size_t index) {
+    coins.erase(coins.begin() + static_cast<std::ptrdiff_t>(index));
+    coinsGeneration = ++lastItemsGeneration;
+    fillGrid(getGrid(GridType::COINS), coins); // Indices after the coin have shifted
 }
 
-void Level::removeItem(Item const &item) {
-    // Search the item and remove it
-    for (auto it = items.begin(); it != items.end(); ++it) {
-        if (it != items.end() && *it == &item) {
-            items.erase(it);
-            break; // Found and removed the item, exit the loop
-        }
-    }
+void Level::removeItem(size_t index) {
+    items.erase(items.begin() + static_cast<std::ptrdiff_t>(index));
+    itemsGeneration = ++lastItemsGeneration;
+    fillGrid(getGrid(GridType::ITEMS), items); // Indices after the item have shifted
 }
 
 
 /* METHODS */
 
 void Level::generateAsteroid(int nbAsteroid, Point camera, size_t seed) {
+    ProfileZone zone("Level::generateAsteroid");
     // Loop to generate asteroids until the desired number is reached
     for (auto i = static_cast<int>(asteroids.size()); i < nbAsteroid; i++){
-        // Add a new asteroid to the asteroids vector with coordinates based on the camera position
-        Asteroid new_asteroid(camera.x, camera.y, seed);
-        asteroids.emplace_back(new_asteroid);
+        // Recycle a free asteroid of the pool with coordinates based on the camera position
+        Asteroid *new_asteroid = asteroids.spawn(camera.x, camera.y, seed);
+        if (new_asteroid == nullptr) break; // The pool is full
 
         // Send the asteroid throw the network
         if (Mediator::isServerRunning()) {
-            Mediator::sendAsteroidCreation(new_asteroid);
+            Mediator::sendAsteroidCreation(*new_asteroid);
         }
     }
 }
 
 void Level::addAsteroid(Asteroid const &asteroid) {
-    asteroids.emplace_back(asteroid);
+    asteroids.spawn(asteroid);
 }
 
 void Level::togglePlatformsMovement(bool state){
@@ -252,7 +362,95 @@ void Level::toggleCrushersMovement(bool state){
     for (Crusher &crusher: crushers) crusher.setIsMoving(state);
 }
 
+void Level::saveState(LevelState &state) const {
+    asteroids.saveState(state.asteroids);
+
+    saveLevers(treadmillLevers, state.treadmillLevers);
+    saveLevers(platformLevers, state.platformLevers);
+    saveLevers(crusherLevers, state.crusherLevers);
+
+    saveStates(movingPlatforms1D, state.movingPlatforms1D);
+    saveStates(movingPlatforms2D, state.movingPlatforms2D);
+    saveStates(switchingPlatforms, state.switchingPlatforms);
+    saveStates(weightPlatforms, state.weightPlatforms);
+    saveStates(treadmills, state.treadmills);
+    saveStates(crushers, state.crushers);
+    for (size_t i = 0; i < bodies.size(); i++) state.bodyFlags[i] = bodies[i].getFlags();
+
+    // A generation is given to a single content, an entry holding the same generation already holds the same items
+    saveItems(sizePowerUp, sizePowerUpGeneration, state.sizePowerUp, state.sizePowerUpGeneration);
+    saveItems(speedPowerUp, speedPowerUpGeneration, state.speedPowerUp, state.speedPowerUpGeneration);
+    saveItems(coins, coinsGeneration, state.coins, state.coinsGeneration);
+    saveItems(items, itemsGeneration, state.items, state.itemsGeneration);
+}
+
+void Level::restoreState(const LevelState &state) {
+    using enum GridType;
+
+    asteroids.restoreState(state.asteroids);
+
+    restoreLevers(state.treadmillLevers, treadmillLevers);
+    restoreLevers(state.platformLevers, platformLevers);
+    restoreLevers(state.crusherLevers, crusherLevers);
+
+    restoreStates(state.movingPlatforms1D, movingPlatforms1D);
+    restoreStates(state.movingPlatforms2D, movingPlatforms2D);
+    restoreStates(state.switchingPlatforms, switchingPlatforms);
+    restoreStates(state.weightPlatforms, weightPlatforms);
+    restoreStates(state.treadmills, treadmills);
+    restoreStates(state.crushers, crushers);
+
+    // Keep the streams of the moving objects matching their restored position
+    getBodies(MOVING_PLATFORMS_1D).assign(movingPlatforms1D);
+    getBodies(MOVING_PLATFORMS_2D).assign(movingPlatforms2D);
+    getBodies(SWITCHING_PLATFORMS).assign(switchingPlatforms);
+    getBodies(WEIGHT_PLATFORMS).assign(weightPlatforms);
+    getBodies(CRUSHERS).assign(crushers);
+
+    // Only the collections changed since the save are restored, their grid indices have shifted
+    if (restoreItems(state.sizePowerUp, state.sizePowerUpGeneration, sizePowerUp, sizePowerUpGeneration)) {
+        fillGrid(getGrid(SIZE_POWER_UP), sizePowerUp);
+    }
+    if (restoreItems(state.speedPowerUp, state.speedPowerUpGeneration, speedPowerUp, speedPowerUpGeneration)) {
+        fillGrid(getGrid(SPEED_POWER_UP), speedPowerUp);
+    }
+    if (restoreItems(state.coins, state.coinsGeneration, coins, coinsGeneration)) {
+        fillGrid(getGrid(COINS), coins);
+    }
+    if (restoreItems(state.items, state.itemsGeneration, items, itemsGeneration)) {
+        fillGrid(getGrid(ITEMS), items);
+    }
+}
+
+void Level::restoreBodyFlags(const LevelState &state) {
+    for (size_t i = 0; i < bodies.size(); i++) bodies[i].setFlags(state.bodyFlags[i]);
+}
+
+void Level::queryCollisionZones(const SDL_FRect &bounding_box, Point move, std::vector<size_t> &result) {
+    // The area swept by the box during its move
+    SDL_FRect swept_area = {
+        std::min(bounding_box.x, bounding_box.x + move.x),
+        std::min(bounding_box.y, bounding_box.y + move.y),
+        bounding_box.w + std::abs(move.x),
+        bounding_box.h + std::abs(move.y)
+    };
+    getGrid(GridType::COLLISION_ZONES).query(swept_area, result);
+
+    // Only keep the zones actually crossed, the swept area of a diagonal move holds a lot of empty space
+    if (move.x == 0 && move.y == 0) {
+        std::erase_if(result, [&](size_t i) { return !checkAABBCollision(bounding_box, collisionZones[i].getBoundingBox()); });
+    } else {
+        std::erase_if(result, [&](size_t i) { return !sweepAABB(bounding_box, move, collisionZones[i].getBoundingBox()).hit; });
+    }
+}
+
+void Level::queryCollisionZones(Point start, Point end, std::vector<size_t> &result) {
+    // A segment is an empty box moving from one end to the other
+    queryCollisionZones({start.x, start.y, 0, 0}, {end.x - start.x, end.y - start.y}, result);
+}
+
 void Level::applyAsteroidsMovement(double delta_time) {
+    ProfileZone zone("Level::applyAsteroidsMovement");
     // Apply movement to all players
     for (Asteroid &asteroid: asteroids) {
         asteroid.applyMovement(delta_time);
@@ -260,47 +458,67 @@ void Level::applyAsteroidsMovement(double delta_time) {
 }
 
 void Level::applyPlatformsMovement(double delta_time) {
-    for (MovingPlatform1D &platform: movingPlatforms1D) platform.applyMovement(delta_time); // Apply movement for 1D platforms
-    for (MovingPlatform2D &platform: movingPlatforms2D) platform.applyMovement(delta_time); // Apply movement for 2D platforms
-    for (SwitchingPlatform &platform: switchingPlatforms) platform.applyMovement(delta_time); // Apply movement for switching platforms
-    for (WeightPlatform &platform: weightPlatforms) platform.applyMovement(delta_time); // Apply movement for weight platforms
-    for (Treadmill &treadmill: treadmills) treadmill.calculateMovement(delta_time); // Calculate movement for treadmills
+    ProfileZone zone("Level::applyPlatformsMovement");
+    using enum GridType;
+
+    // The platforms off screen do not move, only the ones flagged in their streams are visited
+    moveBodies(getBodies(MOVING_PLATFORMS_1D), movingPlatforms1D, [delta_time](MovingPlatform1D &platform) {
+        platform.applyMovement(delta_time);
+    });
+    moveBodies(getBodies(MOVING_PLATFORMS_2D), movingPlatforms2D, [delta_time](MovingPlatform2D &platform) {
+        platform.applyMovement(delta_time);
+    });
+    moveBodies(getBodies(WEIGHT_PLATFORMS), weightPlatforms, [delta_time](WeightPlatform &platform) {
+        platform.applyMovement(delta_time);
+    });
+    moveBodies(getBodies(TREADMILLS), treadmills, [delta_time](Treadmill &treadmill) {
+        treadmill.calculateMovement(delta_time);
+    });
+
+    // Switching platforms follow the beat even off screen
+    for (SwitchingPlatform &platform: switchingPlatforms) platform.applyMovement(delta_time);
+    getBodies(SWITCHING_PLATFORMS).assign(switchingPlatforms);
 }
 
 bool Level::applyTrapsMovement(double delta_time) {
+    ProfileZone zone("Level::applyTrapsMovement");
     bool check = false;
 
-    // Apply movement to all crushers
-    for (Crusher &crusher: crushers) {
+    // Apply movement to the crushers on screen, the others are frozen
+    moveBodies(getBodies(GridType::CRUSHERS), crushers, [delta_time, &check](Crusher &crusher) {
         if (crusher.applyMovement(delta_time)) check = true;
-    }
+    });
 
     return check;
 }
 
 void Level::renderBackgrounds(SDL_Renderer *renderer, const Point camera) const {
+    ProfileZone zone("Level::renderBackgrounds");
     for (const Layer &layer: backgrounds) {
         layer.render(renderer, &camera);
     }
 }
 
 void Level::renderMiddleground(SDL_Renderer *renderer, const Point camera) const {
+    ProfileZone zone("Level::renderMiddleground");
     SDL_Rect src_rect = middleground.getSize();
     SDL_FRect layer_rect_1 = { -40 - camera.x, -350 - camera.y, static_cast<float>(src_rect.w), static_cast<float>(src_rect.h)}; // TODO: change static values to 0
     SDL_RenderCopyExF(renderer, middleground.getTexture(), &src_rect, &layer_rect_1, 0.0, nullptr, SDL_FLIP_NONE);
 }
 
 void Level::renderForegrounds(SDL_Renderer *renderer, const Point camera) const {
+    ProfileZone zone("Level::renderForegrounds");
     for (const Layer &layer: foregrounds) {
         layer.render(renderer, &camera);
     }
 }
 
-void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
+void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const {
+    ProfileZone zone("Level::renderPolygonsDebug");
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    for (const Polygon &obstacle: collisionZones) {
-        for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-            std::vector<Point> vertices = obstacle.getVertices();
+    for (size_t index : visible.obstacles) {
+        const std::vector<Point> &vertices = collisionZones[index].getVertices();
+        for (size_t i = 0; i < vertices.size(); ++i) {
             const auto &vertex1 = vertices[i];
             const auto &vertex2 = vertices[(i + 1) % vertices.size()];
             SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
@@ -308,9 +526,9 @@ void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
     }
 
     SDL_SetRenderDrawColor(renderer, 255, 25, 25, 255);
-    for (const Polygon &obstacle: deathZones) {
-        for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-            std::vector<Point> vertices = obstacle.getVertices();
+    for (size_t index : visible.deathZones) {
+        const std::vector<Point> &vertices = deathZones[index].getVertices();
+        for (size_t i = 0; i < vertices.size(); ++i) {
             const auto &vertex1 = vertices[i];
             const auto &vertex2 = vertices[(i + 1) % vertices.size()];
             SDL_RenderDrawLineF(renderer, vertex1.x - camera.x, vertex1.y - camera.y, vertex2.x - camera.x, vertex2.y - camera.y);
@@ -318,101 +536,105 @@ void Level::renderPolygonsDebug(SDL_Renderer *renderer, Point camera) const {
     }
 
     SDL_SetRenderDrawColor(renderer, 144, 238, 144, 255);
-    for (const AABB &save_zone: saveZones) {
+    for (size_t index : visible.saveZones) {
         // Draw only the outline of the save zone
+        const AABB &save_zone = saveZones[index];
         SDL_FRect save_zone_rect = {save_zone.getX() - camera.x, save_zone.getY() - camera.y, save_zone.getWidth(), save_zone.getHeight()};
         SDL_RenderDrawRectF(renderer, &save_zone_rect);
     }
 
     SDL_SetRenderDrawColor(renderer, 144, 190, 144, 255);
-    for (const AABB &rescue_zone: rescueZones) {
+    for (size_t index : visible.rescueZones) {
         // Draw only the outline of the save zone
+        const AABB &rescue_zone = rescueZones[index];
         SDL_FRect rescue_zone_rect = {rescue_zone.getX() - camera.x, rescue_zone.getY() - camera.y, rescue_zone.getWidth(), rescue_zone.getHeight()};
         SDL_RenderDrawRectF(renderer, &rescue_zone_rect);
     }
 
     SDL_SetRenderDrawColor(renderer, 127, 25, 230, 255);
-    for (const AABB &toggle_gravity_zone: toggleGravityZones) {
+    for (size_t index : visible.toggleGravityZones) {
         // Draw only the outline of the toggle gravity zone
+        const AABB &toggle_gravity_zone = toggleGravityZones[index];
         SDL_FRect toggle_gravity_zone_rect = {toggle_gravity_zone.getX() - camera.x, toggle_gravity_zone.getY() - camera.y, toggle_gravity_zone.getWidth(), toggle_gravity_zone.getHeight()};
         SDL_RenderDrawRectF(renderer, &toggle_gravity_zone_rect);
     }
 
     SDL_SetRenderDrawColor(renderer, 58, 92, 217, 255);
-    for (const AABB &increase_fall_speed_zone: increaseFallSpeedZones) {
+    for (size_t index : visible.increaseFallSpeedZones) {
         // Draw only the outline of the increase fall speed zone
+        const AABB &increase_fall_speed_zone = increaseFallSpeedZones[index];
         SDL_FRect increase_fall_speed_zone_rect = {increase_fall_speed_zone.getX() - camera.x, increase_fall_speed_zone.getY() - camera.y, increase_fall_speed_zone.getWidth(), increase_fall_speed_zone.getHeight()};
         SDL_RenderDrawRectF(renderer, &increase_fall_speed_zone_rect);
     }
 }
 
-void Level::renderAsteroids(SDL_Renderer *renderer, Point camera) {
+void Level::renderAsteroids(SDL_Renderer *renderer, Point camera, float interpolation) {
     for (Asteroid &asteroid : asteroids) {
-        asteroid.render(renderer, camera);
+        asteroid.render(renderer, camera, interpolation);
     }
 }
 
-void Level::renderAsteroidsDebug(SDL_Renderer *renderer, Point camera) const {
+void Level::renderAsteroidsDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     for (Asteroid const &asteroid : asteroids) {
-        asteroid.renderDebug(renderer, camera);
+        asteroid.renderDebug(renderer, camera, interpolation);
     }
 }
 
-void Level::renderLevers(SDL_Renderer *renderer, Point camera) const {
-    for (const TreadmillLever &lever : treadmillLevers) lever.render(renderer, camera);
-    for (const PlatformLever &lever : platformLevers) lever.render(renderer, camera);
-    for (const CrusherLever &lever : crusherLevers) lever.render(renderer, camera);
+void Level::renderLevers(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const {
+    for (size_t i : visible.treadmillLevers) treadmillLevers[i].render(renderer, camera);
+    for (size_t i : visible.platformLevers) platformLevers[i].render(renderer, camera);
+    for (size_t i : visible.crusherLevers) crusherLevers[i].render(renderer, camera);
 }
 
-void Level::renderLeversDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const TreadmillLever &lever : treadmillLevers) lever.renderDebug(renderer, camera);
-    for (const PlatformLever &lever : platformLevers) lever.renderDebug(renderer, camera);
-    for (const CrusherLever &lever : crusherLevers) lever.renderDebug(renderer, camera);
+void Level::renderLeversDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const {
+    for (size_t i : visible.treadmillLevers) treadmillLevers[i].renderDebug(renderer, camera);
+    for (size_t i : visible.platformLevers) platformLevers[i].renderDebug(renderer, camera);
+    for (size_t i : visible.crusherLevers) crusherLevers[i].renderDebug(renderer, camera);
 }
 
-void Level::renderPlatforms(SDL_Renderer *renderer, Point camera) {
-    for (const MovingPlatform1D &platform: movingPlatforms1D) platform.render(renderer, camera);
-    for (const MovingPlatform2D &platform: movingPlatforms2D) platform.render(renderer, camera);
-    for (const SwitchingPlatform &platform: switchingPlatforms) platform.render(renderer, camera);
-    for (const WeightPlatform &platform: weightPlatforms) platform.render(renderer, camera);
-    for (Treadmill &treadmill: treadmills) treadmill.render(renderer, camera);
+void Level::renderPlatforms(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) {
+    for (size_t i : visible.movingPlatforms1D) movingPlatforms1D[i].render(renderer, camera, interpolation);
+    for (size_t i : visible.movingPlatforms2D) movingPlatforms2D[i].render(renderer, camera, interpolation);
+    for (size_t i : visible.switchingPlatforms) switchingPlatforms[i].render(renderer, camera, interpolation);
+    for (size_t i : visible.weightPlatforms) weightPlatforms[i].render(renderer, camera, interpolation);
+    for (size_t i : visible.treadmills) treadmills[i].render(renderer, camera);
 }
 
-void Level::renderPlatformsDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const MovingPlatform1D &platform: movingPlatforms1D) platform.renderDebug(renderer, camera);
-    for (const MovingPlatform2D &platform: movingPlatforms2D) platform.renderDebug(renderer, camera);
-    for (const SwitchingPlatform &platform: switchingPlatforms) platform.renderDebug(renderer, camera);
-    for (const WeightPlatform &platform: weightPlatforms) platform.renderDebug(renderer, camera);
-    for (const Treadmill &treadmill: treadmills) treadmill.renderDebug(renderer, camera);
+void Level::renderPlatformsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const {
+    for (size_t i : visible.movingPlatforms1D) movingPlatforms1D[i].renderDebug(renderer, camera, interpolation);
+    for (size_t i : visible.movingPlatforms2D) movingPlatforms2D[i].renderDebug(renderer, camera, interpolation);
+    for (size_t i : visible.switchingPlatforms) switchingPlatforms[i].renderDebug(renderer, camera, interpolation);
+    for (size_t i : visible.weightPlatforms) weightPlatforms[i].renderDebug(renderer, camera, interpolation);
+    for (size_t i : visible.treadmills) treadmills[i].renderDebug(renderer, camera);
 
 }
 
-void Level::renderTraps(SDL_Renderer *renderer, Point camera) const {
-    for (const Crusher &crusher: crushers) crusher.render(renderer, camera); // Draw the crushers
+void Level::renderTraps(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const {
+    for (size_t i : visible.crushers) crushers[i].render(renderer, camera, interpolation); // Draw the crushers
 }
 
-void Level::renderTrapsDebug(SDL_Renderer *renderer, Point camera) const {
-    for (const Crusher &crusher: crushers) crusher.renderDebug(renderer, camera); // Draw the crushers
+void Level::renderTrapsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible, float interpolation) const {
+    for (size_t i : visible.crushers) crushers[i].renderDebug(renderer, camera, interpolation); // Draw the crushers
 }
 
-void Level::renderItems(SDL_Renderer *renderer, Point camera) {
+void Level::renderItems(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) {
     SDL_SetRenderDrawColor(renderer, 0, 255, 120, 255);
-    for (const Item* item : items) {
-        item->renderDebug(renderer, camera);
+    for (size_t i : visible.items) {
+        items[i]->renderDebug(renderer, camera);
     }
 
-    for (Coin &item : coins) item.render(renderer, camera); // Draw the coins
+    for (size_t i : visible.coins) coins[i].render(renderer, camera); // Draw the coins
 }
 
-void Level::renderItemsDebug(SDL_Renderer *renderer, Point camera) const {
+void Level::renderItemsDebug(SDL_Renderer *renderer, Point camera, const VisibleSet &visible) const {
     SDL_SetRenderDrawColor(renderer, 0, 255, 120, 255);
-    for (const Item* item : items) {
-        item->renderDebug(renderer, camera);
+    for (size_t i : visible.items) {
+        items[i]->renderDebug(renderer, camera);
     }
 
     // Draw the coins
     SDL_SetRenderDrawColor(renderer, 255, 255, 64, 255);
-    for (const Coin &item : coins) item.renderDebug(renderer, camera);
+    for (size_t i : visible.coins) coins[i].renderDebug(renderer, camera);
 
 }
 
@@ -434,6 +656,7 @@ void Level::loadMapProperties(const std::string &map_file_name) {
     worldID = j["worldID"];
     mapID = j["levelID"];
     mapName = j["name"];
+    nextMapName = j.value("nextMap", "");
 
     // Load spawn points
     for (const auto &spawn_point : j["spawnPoints"]) {
@@ -806,4 +1029,218 @@ void Level::loadItemsFromMap(const std::string &mapFileName) {
 
     std::cout << "Level: Loaded " << items.size() << " items." << std::endl;
     std::cout << "Level: Loaded " << coins.size() << " coins." << std::endl;
-}
\ No newline at end of file
+}
+
+void Level::loadMapProperties(const CompiledLevel &compiled) {
+    musics.clear();
+    spawnPoints.clear();
+
+    const CompiledProperties &properties = compiled.getSection<CompiledProperties>(LevelSection::PROPERTIES)[0];
+    worldID = properties.worldID;
+    mapID = properties.mapID;
+    mapName = compiled.getString(properties.name);
+    nextMapName = compiled.getString(properties.nextMap);
+
+    // Load spawn points, 4 per checkpoint
+    std::span<const Point> points = compiled.getSection<Point>(LevelSection::SPAWN_POINTS);
+    spawnPoints.reserve(points.size() / 4);
+    for (size_t i = 0; i + 3 < points.size(); i += 4) {
+        spawnPoints.push_back({points[i], points[i + 1], points[i + 2], points[i + 3]});
+    }
+
+    // Load musics
+    for (const CompiledString &music : compiled.getSection<CompiledString>(LevelSection::MUSICS)) {
+        musics.emplace_back(std::string(compiled.getString(music)));
+    }
+
+    std::cout << "Level: Loaded compiled map properties." << std::endl;
+}
+
+void Level::loadEnvironmentFromMap(const CompiledLevel &compiled) {
+    backgrounds.clear();
+    foregrounds.clear();
+
+    const std::vector<SDL_Texture*>& background_textures = textureManagerPtr->getBackgrounds();
+    const std::vector<SDL_Texture*>& foreground_textures = textureManagerPtr->getForegrounds();
+
+    // Load background and foreground layers
+    for (const CompiledLayer &layer : compiled.getSection<CompiledLayer>(LevelSection::LAYERS)) {
+        if (layer.foreground) foregrounds.emplace_back(*foreground_textures[layer.textureID], layer.layerIndex);
+        else backgrounds.emplace_back(*background_textures[layer.textureID], layer.layerIndex);
+    }
+
+    // Load middle ground layer
+    middleground = Texture(*textureManagerPtr->getMiddleground());
+
+    std::cout << "Level: Loaded background, middleground and foreground layers." << std::endl;
+}
+
+void Level::loadObjectsFromMap(const CompiledLevel &compiled) {
+    using enum LevelSection;
+
+    // Zones, their geometry is already baked
+    std::span<const Point> vertices = compiled.getSection<Point>(VERTICES);
+    std::span<const Point> edge_normals = compiled.getSection<Point>(EDGE_NORMALS);
+    std::span<const Projection> projections = compiled.getSection<Projection>(PROJECTIONS);
+    for (const CompiledPolygon &zone : compiled.getSection<CompiledPolygon>(POLYGONS)) {
+        auto type = static_cast<PolygonType>(zone.type);
+        std::vector<Polygon> *zones = nullptr;
+        switch (type) {
+            using enum PolygonType;
+            case COLLISION: zones = &collisionZones; break;
+            case ICE: zones = &iceZones; break;
+            case SAND: zones = &sandZones; break;
+            case DEATH: zones = &deathZones; break;
+            case CINEMATIC: zones = &cinematicZones; break;
+            case BOSS: zones = &bossZones; break;
+            case EVENT: zones = &eventZones; break;
+            default: continue;
+        }
+        zones->emplace_back(vertices.subspan(zone.firstVertex, zone.vertexCount), type, zone.convex != 0, zone.boundingBox,
+                            edge_normals.subspan(zone.firstVertex, zone.vertexCount), projections.subspan(zone.firstVertex, zone.vertexCount));
+    }
+
+    for (const CompiledAABB &zone : compiled.getSection<CompiledAABB>(AABBS)) {
+        auto type = static_cast<AABBType>(zone.type);
+        std::vector<AABB> *zones = nullptr;
+        switch (type) {
+            using enum AABBType;
+            case SAVE: zones = &saveZones; break;
+            case RESCUE: zones = &rescueZones; break;
+            case TOGGLE_GRAVITY: zones = &toggleGravityZones; break;
+            case INCREASE_FALL_SPEED: zones = &increaseFallSpeedZones; break;
+            default: continue;
+        }
+        zones->emplace_back(zone.rect.x, zone.rect.y, zone.rect.w, zone.rect.h, static_cast<int>(zones->size()), type);
+    }
+
+    // Platforms
+    const std::vector<Texture> &platform_textures = textureManagerPtr->getPlatforms();
+    std::span<const Point> steps = compiled.getSection<Point>(STEPS);
+
+    auto moving_platforms_1D = compiled.getSection<CompiledMovingPlatform1D>(MOVING_PLATFORMS_1D);
+    movingPlatforms1D.reserve(moving_platforms_1D.size());
+    for (const CompiledMovingPlatform1D &platform : moving_platforms_1D) {
+        movingPlatforms1D.emplace_back(platform.x, platform.y, platform.size, platform.speed, platform.min, platform.max,
+                                       platform.start != 0, platform.axis != 0, platform_textures[platform.texture]);
+    }
+
+    auto moving_platforms_2D = compiled.getSection<CompiledMovingPlatform2D>(MOVING_PLATFORMS_2D);
+    movingPlatforms2D.reserve(moving_platforms_2D.size());
+    for (const CompiledMovingPlatform2D &platform : moving_platforms_2D) {
+        movingPlatforms2D.emplace_back(platform.x, platform.y, platform.size, platform.speed, platform.left, platform.right,
+                                       platform.start != 0, platform_textures[platform.texture]);
+    }
+
+    auto switching_platforms = compiled.getSection<CompiledSwitchingPlatform>(SWITCHING_PLATFORMS);
+    switchingPlatforms.reserve(switching_platforms.size());
+    for (const CompiledSwitchingPlatform &platform : switching_platforms) {
+        std::span<const Point> platform_steps = steps.subspan(platform.firstStep, platform.stepCount);
+        switchingPlatforms.emplace_back(platform.x, platform.y, platform.size, platform.bpm,
+                                        std::vector<Point>(platform_steps.begin(), platform_steps.end()), platform_textures[platform.texture]);
+    }
+
+    auto weight_platforms = compiled.getSection<CompiledWeightPlatform>(WEIGHT_PLATFORMS);
+    weightPlatforms.reserve(weight_platforms.size());
+    for (const CompiledWeightPlatform &platform : weight_platforms) {
+        weightPlatforms.emplace_back(platform.x, platform.y, platform.size, platform.stepDistance, platform_textures[platform.texture]);
+    }
+
+    auto compiled_treadmills = compiled.getSection<CompiledTreadmill>(TREADMILLS);
+    treadmills.reserve(compiled_treadmills.size());
+    for (const CompiledTreadmill &treadmill : compiled_treadmills) {
+        treadmills.emplace_back(treadmill.x, treadmill.y, treadmill.size, treadmill.speed, treadmill.direction, treadmill.spriteSpeed);
+    }
+
+    // Traps
+    const std::vector<Texture> &crusher_textures = textureManagerPtr->getCrushers();
+    auto compiled_crushers = compiled.getSection<CompiledCrusher>(CRUSHERS);
+    crushers.reserve(compiled_crushers.size());
+    for (const CompiledCrusher &crusher : compiled_crushers) {
+        crushers.emplace_back(crusher.x, crusher.y, crusher.size, crusher.min, crusher.max, crusher.moveUpTime,
+                              crusher.waitUpTime, crusher.waitDownTime, crusher_textures[crusher.texture]);
+    }
+
+    // Levers, the collections they point to are complete and no longer reallocated
+    std::span<const uint32_t> targets = compiled.getSection<uint32_t>(TARGETS);
+    auto pointers = [&targets]<typename T>(std::vector<T> &objects, uint32_t first, uint32_t count) {
+        std::vector<T*> result;
+        result.reserve(count);
+        for (uint32_t id : targets.subspan(first, count)) result.push_back(&objects[id]);
+        return result;
+    };
+
+    for (const CompiledLever &lever : compiled.getSection<CompiledLever>(TREADMILL_LEVERS)) {
+        treadmillLevers.emplace_back(lever.x, lever.y, lever.size, lever.isActivated != 0, lever.type, Texture(textureManagerPtr->getLever()),
+                                     pointers(treadmills, lever.firstTarget, lever.targetCount));
+    }
+    for (const CompiledLever &lever : compiled.getSection<CompiledLever>(PLATFORM_LEVERS)) {
+        platformLevers.emplace_back(lever.x, lever.y, lever.size, lever.isActivated != 0, Texture(textureManagerPtr->getLever()),
+                                    pointers(movingPlatforms1D, lever.firstTarget, lever.targetCount),
+                                    pointers(movingPlatforms2D, lever.firstSecondTarget, lever.secondTargetCount));
+    }
+    for (const CompiledLever &lever : compiled.getSection<CompiledLever>(CRUSHER_LEVERS)) {
+        crusherLevers.emplace_back(lever.x, lever.y, lever.size, lever.isActivated != 0, Texture(textureManagerPtr->getLever()),
+                                   pointers(crushers, lever.firstTarget, lever.targetCount));
+    }
+
+    // Items
+    for (const CompiledPowerUp &item : compiled.getSection<CompiledPowerUp>(SIZE_POWER_UPS)) {
+        sizePowerUp.emplace_back(item.rect.x, item.rect.y, item.rect.w, item.rect.h, item.effect != 0);
+        items.emplace_back(new SizePowerUp(item.rect.x, item.rect.y, item.rect.w, item.rect.h, item.effect != 0));
+    }
+    for (const CompiledPowerUp &item : compiled.getSection<CompiledPowerUp>(SPEED_POWER_UPS)) {
+        speedPowerUp.emplace_back(item.rect.x, item.rect.y, item.rect.w, item.rect.h, item.effect != 0);
+        items.emplace_back(new SpeedPowerUp(item.rect.x, item.rect.y, item.rect.w, item.rect.h, item.effect != 0));
+    }
+    auto compiled_coins = compiled.getSection<CompiledCoin>(COINS);
+    coins.reserve(compiled_coins.size());
+    for (const CompiledCoin &coin : compiled_coins) {
+        coins.emplace_back(coin.rect.x, coin.rect.y, coin.rect.w, coin.rect.h, coin.value);
+    }
+
+    std::cout << "Level: Loaded " << collisionZones.size() + deathZones.size() << " zones, " << movingPlatforms1D.size() + movingPlatforms2D.size() + switchingPlatforms.size() + weightPlatforms.size() + treadmills.size() << " platforms, " << crushers.size() << " crushers, " << treadmillLevers.size() + platformLevers.size() + crusherLevers.size() << " levers, " << items.size() << " items and " << coins.size() << " coins from the compiled level." << std::endl;
+}
+
+void Level::buildGrids() {
+    using enum GridType;
+
+    // Static zones
+    fillGrid(getGrid(COLLISION_ZONES), collisionZones);
+    fillGrid(getGrid(DEATH_ZONES), deathZones);
+    fillGrid(getGrid(SAVE_ZONES), saveZones);
+    fillGrid(getGrid(RESCUE_ZONES), rescueZones);
+    fillGrid(getGrid(TOGGLE_GRAVITY_ZONES), toggleGravityZones);
+    fillGrid(getGrid(INCREASE_FALL_SPEED_ZONES), increaseFallSpeedZones);
+
+    // Levers
+    fillGrid(getGrid(TREADMILL_LEVERS), treadmillLevers);
+    fillGrid(getGrid(PLATFORM_LEVERS), platformLevers);
+    fillGrid(getGrid(CRUSHER_LEVERS), crusherLevers);
+
+    // Platforms and traps are scanned through their streams, refreshed when they move
+    getBodies(MOVING_PLATFORMS_1D).assign(movingPlatforms1D);
+    getBodies(MOVING_PLATFORMS_2D).assign(movingPlatforms2D);
+    getBodies(SWITCHING_PLATFORMS).assign(switchingPlatforms);
+    getBodies(WEIGHT_PLATFORMS).assign(weightPlatforms);
+    getBodies(TREADMILLS).assign(treadmills);
+    getBodies(CRUSHERS).assign(crushers);
+
+    // Items
+    fillGrid(getGrid(SIZE_POWER_UP), sizePowerUp);
+    fillGrid(getGrid(SPEED_POWER_UP), speedPowerUp);
+    fillGrid(getGrid(COINS), coins);
+    fillGrid(getGrid(ITEMS), items);
+
+    // The broad phase only visits the objects around the camera, so every object starts hidden
+    for (MovingPlatform1D &platform: movingPlatforms1D) platform.setIsOnScreen(false);
+    for (MovingPlatform2D &platform: movingPlatforms2D) platform.setIsOnScreen(false);
+    for (SwitchingPlatform &platform: switchingPlatforms) platform.setIsOnScreen(false);
+    for (WeightPlatform &platform: weightPlatforms) platform.setIsOnScreen(false);
+    for (Treadmill &treadmill: treadmills) treadmill.setIsOnScreen(false);
+    for (Crusher &crusher: crushers) crusher.setIsOnScreen(false);
+    for (Coin &coin: coins) coin.setIsOnScreen(false);
+    for (Item *item: items) item->setIsOnScreen(false);
+
+    std::cout << "Level: Built spatial grids." << std::endl;
+}
@@ -81,12 +81,12 @@ bool Lever::operator==(const Lever &item) const {
            && h == item.getH();
 }
 
-void Lever::render(SDL_Renderer *renderer, Point camera) const {
+void Lever::render([[maybe_unused]] SDL_Renderer *renderer, Point camera) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
         SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,
                                    w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        RenderQueue::draw(RenderLayer::LEVERS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
@@ -19,9 +19,9 @@ std::vector<Button> aggregateButtons(const std::map<GameStateKey, std::vector<Bu
 
 /** CONSTRUCTOR **/
 
-Menu::Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_name, MessageQueue *messageQueue)
+Menu::Menu(SDL_Renderer *renderer, std::atomic<bool> *quit, const std::string& music_file_name, MessageQueue *messageQueue)
         : renderer(renderer), quitPtr(quit), music(music_file_name), messageQueue(messageQueue) {
-    std::vector<TTF_Font *> fonts = RenderManager::getFonts();
+    GlyphAtlas *textAtlas = RenderManager::getGlyphAtlases()[1].get();
 
     // Create menu buttons
     SDL_Color normal_color = {100, 125, 160, 255};
@@ -40,10 +40,10 @@ Menu::Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_nam
     ButtonPosition options_button_position = {200, 180, 400, 100};
     ButtonPosition credits_button_position = {200, 300, 400, 100};
     ButtonPosition quit_button_position = {200, 420, 400, 100};
-    auto play_button = Button(renderer, fonts[1], play_button_position, 0, "Jouer", ButtonAction::NAVIGATE_TO_MENU_PLAY, normal_color, hover_color, text_color, 10);
-    auto options_button = Button(renderer, fonts[1], options_button_position, 0, "Options", ButtonAction::NONE, normal_color, hover_color,text_color, 10);
-    auto credits_button = Button(renderer, fonts[1], credits_button_position, 0, "Credits", ButtonAction::NONE, normal_color, hover_color,text_color, 10);
-    auto quit_button = Button(renderer, fonts[1], quit_button_position, 0, "Quitter", ButtonAction::QUIT, quit_color, quit_hover_color,quit_text_color, 10);
+    auto play_button = Button(renderer, textAtlas, play_button_position, 0, "Jouer", ButtonAction::NAVIGATE_TO_MENU_PLAY, normal_color, hover_color, text_color, 10);
+    auto options_button = Button(renderer, textAtlas, options_button_position, 0, "Options", ButtonAction::NONE, normal_color, hover_color,text_color, 10);
+    auto credits_button = Button(renderer, textAtlas, credits_button_position, 0, "Credits", ButtonAction::NONE, normal_color, hover_color,text_color, 10);
+    auto quit_button = Button(renderer, textAtlas, quit_button_position, 0, "Quitter", ButtonAction::QUIT, quit_color, quit_hover_color,quit_text_color, 10);
     buttons[{GameState::STOPPED, MenuAction::MAIN}].push_back(play_button);
     buttons[{GameState::STOPPED, MenuAction::MAIN}].push_back(options_button);
     buttons[{GameState::STOPPED, MenuAction::MAIN}].push_back(credits_button);
@@ -55,10 +55,10 @@ Menu::Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_nam
     ButtonPosition join_game_button_position = {200, 220, 400, 80};
     ButtonPosition start_new_game_button_position = {200, 320, 400, 100};
     ButtonPosition main_menu_button_position = {200, 440, 400, 100};
-    auto host_game_button = Button(renderer, fonts[1], host_game_button_position, 1, "Host Game", ButtonAction::CREATE_OR_LOAD_GAME, normal_color,hover_color, text_color, 10);
-    auto join_game_button = Button(renderer, fonts[1], join_game_button_position, 0, "Join Hosted Game", ButtonAction::JOIN_HOSTED_GAME, normal_color,hover_color, text_color, 10);
-    auto start_new_game_button = Button(renderer, fonts[1], start_new_game_button_position, 0, "Start Local Game", ButtonAction::CREATE_OR_LOAD_GAME, normal_color, hover_color,text_color, 10);
-    auto main_menu_button = Button(renderer, fonts[1], main_menu_button_position, 0, "Main Menu",  ButtonAction::NAVIGATE_TO_MENU_MAIN, normal_color,hover_color, text_color, 10);
+    auto host_game_button = Button(renderer, textAtlas, host_game_button_position, 1, "Host Game", ButtonAction::CREATE_OR_LOAD_GAME, normal_color,hover_color, text_color, 10);
+    auto join_game_button = Button(renderer, textAtlas, join_game_button_position, 0, "Join Hosted Game", ButtonAction::JOIN_HOSTED_GAME, normal_color,hover_color, text_color, 10);
+    auto start_new_game_button = Button(renderer, textAtlas, start_new_game_button_position, 0, "Start Local Game", ButtonAction::CREATE_OR_LOAD_GAME, normal_color, hover_color,text_color, 10);
+    auto main_menu_button = Button(renderer, textAtlas, main_menu_button_position, 0, "Main Menu",  ButtonAction::NAVIGATE_TO_MENU_MAIN, normal_color,hover_color, text_color, 10);
     auto text_input = TextBox(renderer, {200, 170, 400, 40}, "Enter the IP address of the host (ip:port)", 80);
     buttons[{GameState::STOPPED, MenuAction::PLAY}].push_back(host_game_button);
     buttons[{GameState::STOPPED, MenuAction::PLAY}].push_back(join_game_button);
@@ -70,9 +70,9 @@ Menu::Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_nam
     ButtonPosition resume_button_position = {200, 100, 400, 100};
     ButtonPosition save_button_position = {200, 220, 400, 100};
     ButtonPosition stop_button_position = {200, 340, 400, 100};
-    auto resume_button = Button(renderer, fonts[1], resume_button_position, 0, "Resume", ButtonAction::RESUME, normal_color, hover_color,text_color, 10);
-    auto save_button = Button(renderer, fonts[1], save_button_position, 0, "Save the Game", ButtonAction::SAVE, normal_color, hover_color,text_color, 10);
-    auto stop_button = Button(renderer, fonts[1], stop_button_position, 0, "Stop the Game", ButtonAction::STOP, normal_color, hover_color,text_color, 10);
+    auto resume_button = Button(renderer, textAtlas, resume_button_position, 0, "Resume", ButtonAction::RESUME, normal_color, hover_color,text_color, 10);
+    auto save_button = Button(renderer, textAtlas, save_button_position, 0, "Save the Game", ButtonAction::SAVE, normal_color, hover_color,text_color, 10);
+    auto stop_button = Button(renderer, textAtlas, stop_button_position, 0, "Stop the Game", ButtonAction::STOP, normal_color, hover_color,text_color, 10);
     buttons[{GameState::PAUSED, MenuAction::MAIN}].push_back(resume_button);
     buttons[{GameState::PAUSED, MenuAction::MAIN}].push_back(save_button);
     buttons[{GameState::PAUSED, MenuAction::MAIN}].push_back(stop_button);
@@ -85,13 +85,13 @@ Menu::Menu(SDL_Renderer *renderer, bool *quit, const std::string& music_file_nam
     ButtonPosition save_slot3_button_position = {200, 280, 300, 80};
     ButtonPosition remove_slot3_button_position = {510, 280, 90, 80};
     ButtonPosition main_menu_button_position4 = {200, 400, 400, 100};
-    auto save_slot1_button = Button(renderer, fonts[1], save_slot1_button_position, 1, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
-    auto remove_slot1_button = Button(renderer, fonts[1], remove_slot1_button_position, 1, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
-    auto save_slot2_button = Button(renderer, fonts[1], save_slot2_button_position, 2, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
-    auto remove_slot2_button = Button(renderer, fonts[1], remove_slot2_button_position, 2, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
-    auto save_slot3_button = Button(renderer, fonts[1], save_slot3_button_position, 3, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
-    auto remove_slot3_button = Button(renderer, fonts[1], remove_slot3_button_position, 3, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
-    auto main_menu_button4 = Button(renderer, fonts[1], main_menu_button_position4, 0, "Main Menu", ButtonAction::NAVIGATE_TO_MENU_MAIN, normal_color,hover_color, text_color, 10);
+    auto save_slot1_button = Button(renderer, textAtlas, save_slot1_button_position, 1, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
+    auto remove_slot1_button = Button(renderer, textAtlas, remove_slot1_button_position, 1, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
+    auto save_slot2_button = Button(renderer, textAtlas, save_slot2_button_position, 2, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
+    auto remove_slot2_button = Button(renderer, textAtlas, remove_slot2_button_position, 2, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
+    auto save_slot3_button = Button(renderer, textAtlas, save_slot3_button_position, 3, "Empty Slot", ButtonAction::VIEW_GAME, normal_color, hover_color,text_color, 10);
+    auto remove_slot3_button = Button(renderer, textAtlas, remove_slot3_button_position, 3, "R", ButtonAction::DELETE_SAVE, disabled_color, disabled_hover_color,text_color, 10);
+    auto main_menu_button4 = Button(renderer, textAtlas, main_menu_button_position4, 0, "Main Menu", ButtonAction::NAVIGATE_TO_MENU_MAIN, normal_color,hover_color, text_color, 10);
     buttons[{GameState::STOPPED, MenuAction::CREATE_OR_LOAD_GAME}].push_back(save_slot1_button);
     buttons[{GameState::STOPPED, MenuAction::CREATE_OR_LOAD_GAME}].push_back(remove_slot1_button);
     buttons[{GameState::STOPPED, MenuAction::CREATE_OR_LOAD_GAME}].push_back(save_slot2_button);
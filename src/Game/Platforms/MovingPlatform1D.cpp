@@ -26,6 +26,8 @@ MovingPlatform1D::MovingPlatform1D(float x, float y, float size, float speed, fl
     }
 
     direction = start ? -1 : 1; // If the platform starts left/up, the direction is right/down
+    previousX = this->x;
+    previousY = this->y;
 }
 
 
@@ -67,15 +69,21 @@ SDL_FRect MovingPlatform1D::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+MovingPlatform1DState MovingPlatform1D::getState() const {
+    return {x, y, move, buffer, direction, isMoving};
+}
+
 
 /* MODIFIERS */
 
 void MovingPlatform1D::setX(float value) {
     x = value;
+    previousX = value; // Do not interpolate the jump to the new position
 }
 
 void MovingPlatform1D::setY(float value) {
     y = value;
+    previousY = value; // Do not interpolate the jump to the new position
 }
 
 void MovingPlatform1D::setMove(float value) {
@@ -98,6 +106,15 @@ void MovingPlatform1D::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void MovingPlatform1D::setState(const MovingPlatform1DState &state) {
+    x = state.x;
+    y = state.y;
+    move = state.move;
+    buffer = state.buffer;
+    direction = state.direction;
+    isMoving = state.isMoving;
+}
+
 
 /* METHODS */
 
@@ -167,23 +184,28 @@ void MovingPlatform1D::applyYaxisMovement(double delta_time) {
 }
 
 void MovingPlatform1D::applyMovement(double delta_time) {
+    previousX = x;
+    previousY = y;
+
     if (isMoving && isOnScreen) {
         axis ? applyYaxisMovement(delta_time) : applyXaxisMovement(delta_time);
     } else move = 0;
 }
 
-void MovingPlatform1D::render(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform1D::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        float x_rect = std::lerp(previousX, x, interpolation) - camera.x - textureOffsets.x;
+        float y_rect = std::lerp(previousY, y, interpolation) - camera.y - textureOffsets.y;
+        SDL_FRect platform_rect = {x_rect, y_rect,w + textureOffsets.w, h + textureOffsets.h};
+        RenderQueue::draw(RenderLayer::PLATFORMS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void MovingPlatform1D::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform1D::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
+        SDL_FRect platform_rect = {std::lerp(previousX, x, interpolation) - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
         SDL_RenderFillRectF(renderer, &platform_rect);
     }
 }
\ No newline at end of file
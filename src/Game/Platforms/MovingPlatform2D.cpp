@@ -32,6 +32,8 @@ MovingPlatform2D::MovingPlatform2D(float x, float y, float size, float speed, Po
         directionX = -1;
         directionY =  left.y - right.y > 0 ? 1 : -1;
     }
+    previousX = this->x;
+    previousY = this->y;
 }
 
 
@@ -77,15 +79,21 @@ SDL_FRect MovingPlatform2D::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+MovingPlatform2DState MovingPlatform2D::getState() const {
+    return {x, y, moveX, moveY, buffer, directionX, directionY, isMoving};
+}
+
 
 /* MODIFIERS */
 
 void MovingPlatform2D::setX(float value) {
     x = value;
+    previousX = value; // Do not interpolate the jump to the new position
 }
 
 void MovingPlatform2D::setY(float value) {
     y = value;
+    previousY = value; // Do not interpolate the jump to the new position
 }
 
 void MovingPlatform2D::setMoveX(float value) {
@@ -116,10 +124,24 @@ void MovingPlatform2D::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void MovingPlatform2D::setState(const MovingPlatform2DState &state) {
+    x = state.x;
+    y = state.y;
+    moveX = state.moveX;
+    moveY = state.moveY;
+    buffer = state.buffer;
+    directionX = state.directionX;
+    directionY = state.directionY;
+    isMoving = state.isMoving;
+}
+
 
 /* METHODS */
 
 void MovingPlatform2D::applyMovement(double delta_time) {
+    previousX = x;
+    previousY = y;
+
     if (isMoving && isOnScreen) {
         // Add basic movement
         moveX = 150;
@@ -181,18 +203,20 @@ void MovingPlatform2D::applyMovement(double delta_time) {
     }
 }
 
-void MovingPlatform2D::render(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform2D::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        float x_rect = std::lerp(previousX, x, interpolation) - camera.x - textureOffsets.x;
+        float y_rect = std::lerp(previousY, y, interpolation) - camera.y - textureOffsets.y;
+        SDL_FRect platform_rect = {x_rect, y_rect,w + textureOffsets.w, h + textureOffsets.h};
+        RenderQueue::draw(RenderLayer::PLATFORMS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void MovingPlatform2D::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void MovingPlatform2D::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
+        SDL_FRect platform_rect = {std::lerp(previousX, x, interpolation) - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
         SDL_RenderFillRectF(renderer, &platform_rect);
     }
 }
\ No newline at end of file
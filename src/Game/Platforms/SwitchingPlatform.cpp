@@ -44,6 +44,10 @@ SDL_FRect SwitchingPlatform::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+SwitchingPlatformState SwitchingPlatform::getState() const {
+    return {x, y, startTime, actualPoint, isMoving};
+}
+
 
 /* MODIFIERS */
 
@@ -55,12 +59,20 @@ void SwitchingPlatform::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void SwitchingPlatform::setState(const SwitchingPlatformState &state) {
+    x = state.x;
+    y = state.y;
+    startTime = state.startTime;
+    actualPoint = state.actualPoint;
+    isMoving = state.isMoving;
+}
+
 
 /* METHODS */
 
 void SwitchingPlatform::applyMovement([[maybe_unused]] double delta_time) {
     if (isMoving) {
-        Uint32 currentTime = SDL_GetTicks(); // Get the current time
+        Uint32 currentTime = SimulationClock::getTime(); // Get the current time
 
         // Check if a beat has passed
         if (currentTime - startTime > (60000 / bpm)) {
@@ -75,15 +87,15 @@ void SwitchingPlatform::applyMovement([[maybe_unused]] double delta_time) {
     }
 }
 
-void SwitchingPlatform::render(SDL_Renderer *renderer, Point camera) const {
+void SwitchingPlatform::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, [[maybe_unused]] float interpolation) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
         SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        RenderQueue::draw(RenderLayer::PLATFORMS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void SwitchingPlatform::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void SwitchingPlatform::renderDebug(SDL_Renderer *renderer, Point camera, [[maybe_unused]] float interpolation) const {
     if (isOnScreen) {
         SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
         SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
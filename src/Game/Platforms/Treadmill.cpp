@@ -60,6 +60,10 @@ SDL_FRect Treadmill::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+TreadmillState Treadmill::getState() const {
+    return {direction, move, isMoving};
+}
+
 
 /* MODIFIERS */
 
@@ -80,6 +84,12 @@ void Treadmill::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void Treadmill::setState(const TreadmillState &state) {
+    direction = state.direction;
+    move = state.move;
+    isMoving = state.isMoving;
+}
+
 void Treadmill::setTexture(SDL_Texture *texturePtr) {
     spriteTexturePtr = texturePtr;
 
@@ -104,12 +114,12 @@ void Treadmill::calculateMovement(double delta_time) {
 
 }
 
-void Treadmill::render(SDL_Renderer *renderer, Point camera) {
+void Treadmill::render([[maybe_unused]] SDL_Renderer *renderer, Point camera) {
     if (isOnScreen) {
         if (isMoving) sprite.updateAnimation();
         SDL_Rect srcRect = sprite.getSrcRect();
         SDL_FRect treadmill_rect = {x - camera.x, y - camera.y, w, h};
-        SDL_RenderCopyExF(renderer, sprite.getTexture(), &srcRect, &treadmill_rect, 0.0, nullptr, sprite.getFlip());
+        RenderQueue::draw(RenderLayer::PLATFORMS, sprite.getTexture(), srcRect, treadmill_rect, 0.0, sprite.getFlip());
     }
 }
 
@@ -48,6 +48,10 @@ SDL_FRect WeightPlatform::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+WeightPlatformState WeightPlatform::getState() const {
+    return {y, move, weight, isMoving};
+}
+
 
 /* MODIFIERS */
 
@@ -59,6 +63,13 @@ void WeightPlatform::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void WeightPlatform::setState(const WeightPlatformState &state) {
+    y = state.y;
+    move = state.move;
+    weight = state.weight;
+    isMoving = state.isMoving;
+}
+
 void WeightPlatform::increaseWeight() {
     weight++;
 }
@@ -71,6 +82,8 @@ void WeightPlatform::decreaseWeight() {
 /* METHODS */
 
 void WeightPlatform::applyMovement(double delta_time) {
+    previousY = y;
+
     if (isMoving && isOnScreen) {
         auto blend = static_cast<float>(1.0f - std::pow(0.5F, delta_time * lerpSmoothingFactor));
         float targetY = startY + weight * stepDistance;
@@ -80,18 +93,19 @@ void WeightPlatform::applyMovement(double delta_time) {
     }
 }
 
-void WeightPlatform::render(SDL_Renderer *renderer, Point camera) const {
+void WeightPlatform::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        float y_rect = std::lerp(previousY, y, interpolation) - camera.y - textureOffsets.y;
+        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y_rect,w + textureOffsets.w, h + textureOffsets.h};
+        RenderQueue::draw(RenderLayer::PLATFORMS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void WeightPlatform::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void WeightPlatform::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_SetRenderDrawColor(renderer, 145, 0, 145, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
+        SDL_FRect platform_rect = {x - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
         SDL_RenderFillRectF(renderer, &platform_rect);
     }
 }
\ No newline at end of file
@@ -22,7 +22,7 @@ SDL_Texture *Player::spriteTexture4MedalPtr = nullptr;
 /* CONSTRUCTORS */
 
 Player::Player(int playerID, Point spawnPoint, float size)
-        : playerID(playerID), x(spawnPoint.x), y(spawnPoint.y), size(size) {
+        : playerID(playerID), x(spawnPoint.x), y(spawnPoint.y), previousX(spawnPoint.x), previousY(spawnPoint.y), size(size) {
 
     sprite = Sprite(*baseSpriteTexturePtr, Player::idle, BASE_SPRITE_WIDTH, BASE_SPRITE_HEIGHT);
     setSpriteTextureByID(playerID);
@@ -84,6 +84,10 @@ float Player::getMoveY() const {
     return moveY;
 }
 
+Buffer Player::getBuffer() const {
+    return buffer;
+}
+
 int Player::getDirectionX() const {
     return (int)directionX;
 }
@@ -252,6 +256,15 @@ SDL_FRect Player::getBoundingBoxNextFrame() const {
     return {x + moveX, y + moveY, width, height};
 }
 
+PlayerSimulationState Player::getState() const {
+    return {playerID, x, y, previousX, previousY, width, height, size, isAlive, buffer, score, deathCount, sprite.getState(),
+            moveX, wantToMoveRight, wantToMoveLeft, directionX, previousDirectionX, canMove, speed, speedCurveX,
+            sprintMultiplier, moveY, mavity, wantToJump, jumpLock, directionY, isGrounded, isJumping, lastTimeOnPlatform,
+            jumpMaxHeight, maxFallSpeed, jumpStartHeight, jumpVelocity, currentZoneID, isOnPlatform, wasOnPlatform,
+            isHitting, hitLock, hitTimer, lastHitTimeUpdate, hitZone, leftCollider, rightCollider, groundCollider,
+            roofCollider, eggLock, lastAnimationIsRunType, textureOffsets};
+}
+
 
 /* MODIFIERS */
 
@@ -265,6 +278,11 @@ void Player::setY(float val) {
 
 void Player::setSize(float val) {
     size = val;
+    applySize();
+    updateCollisionBox();
+}
+
+void Player::applySize() {
     baseHitZone = {BASE_HIT_ZONE.x * size, BASE_HIT_ZONE.y * size, BASE_HIT_ZONE.w * size, BASE_HIT_ZONE.h * size};
     hitZone = baseHitZone;
     normalOffsets = {baseNormalOffsets.x * size, baseNormalOffsets.y * size, baseNormalOffsets.w * size, baseNormalOffsets.h * size};
@@ -272,8 +290,6 @@ void Player::setSize(float val) {
     eggOffsets = {baseEggOffsets.x * size, baseEggOffsets.y * size, baseEggOffsets.w * size, baseEggOffsets.h * size};
     spriteWidth = BASE_SPRITE_WIDTH * size;
     spriteHeight = BASE_SPRITE_HEIGHT * size;
-
-    updateCollisionBox();
 }
 
 void Player::setIsAlive(bool state) {
@@ -330,7 +346,7 @@ void Player::setSprint(bool state) {
 void Player::setIsGrounded(bool state) {
     isGrounded = state;
     if (state) {
-        lastTimeOnPlatform = SDL_GetTicks();
+        lastTimeOnPlatform = SimulationClock::getTime();
     }
 }
 
@@ -406,29 +422,85 @@ void Player::setMedalTexture(SDL_Texture* newTexture) {
     medalTexture = newTexture;
 }
 
+void Player::setState(const PlayerSimulationState &state) {
+    // The offsets derived from the size are only scaled again when a power-up changed it
+    if (size != state.size) {
+        size = state.size;
+        applySize();
+    }
+
+    x = state.x;
+    y = state.y;
+    previousX = state.previousX;
+    previousY = state.previousY;
+    width = state.width;
+    height = state.height;
+    isAlive = state.isAlive;
+    buffer = state.buffer;
+    score = state.score;
+    deathCount = state.deathCount;
+    sprite.setState(state.sprite);
+    moveX = state.moveX;
+    wantToMoveRight = state.wantToMoveRight;
+    wantToMoveLeft = state.wantToMoveLeft;
+    directionX = state.directionX;
+    previousDirectionX = state.previousDirectionX;
+    canMove = state.canMove;
+    speed = state.speed;
+    speedCurveX = state.speedCurveX;
+    sprintMultiplier = state.sprintMultiplier;
+    moveY = state.moveY;
+    mavity = state.mavity;
+    wantToJump = state.wantToJump;
+    jumpLock = state.jumpLock;
+    directionY = state.directionY;
+    isGrounded = state.isGrounded;
+    isJumping = state.isJumping;
+    lastTimeOnPlatform = state.lastTimeOnPlatform;
+    jumpMaxHeight = state.jumpMaxHeight;
+    maxFallSpeed = state.maxFallSpeed;
+    jumpStartHeight = state.jumpStartHeight;
+    jumpVelocity = state.jumpVelocity;
+    currentZoneID = state.currentZoneID;
+    isOnPlatform = state.isOnPlatform;
+    wasOnPlatform = state.wasOnPlatform;
+    isHitting = state.isHitting;
+    hitLock = state.hitLock;
+    hitTimer = state.hitTimer;
+    lastHitTimeUpdate = state.lastHitTimeUpdate;
+    hitZone = state.hitZone;
+    leftCollider = state.leftCollider;
+    rightCollider = state.rightCollider;
+    groundCollider = state.groundCollider;
+    roofCollider = state.roofCollider;
+    eggLock = state.eggLock;
+    lastAnimationIsRunType = state.lastAnimationIsRunType;
+    textureOffsets = state.textureOffsets;
+}
+
 
 
 /* METHODS */
 
-bool Player::loadTextures(SDL_Renderer &renderer) {
+bool Player::loadTextures(SDL_Renderer &renderer, TextureAtlas &atlas) {
     // Load players' sprite texture
-    baseSpriteTexturePtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player.png");
+    baseSpriteTexturePtr = atlas.loadTexture(renderer, "assets/sprites/players/player.png");
 
     // Player 1
-    spriteTexture1Ptr = IMG_LoadTexture(&renderer, "assets/sprites/players/player1.png");
-    spriteTexture1MedalPtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player1Medal.png");
+    spriteTexture1Ptr = atlas.loadTexture(renderer, "assets/sprites/players/player1.png");
+    spriteTexture1MedalPtr = atlas.loadTexture(renderer, "assets/sprites/players/player1Medal.png");
 
     //Player 2
-    spriteTexture2Ptr = IMG_LoadTexture(&renderer, "assets/sprites/players/player2.png");
-    spriteTexture2MedalPtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player2Medal.png");
+    spriteTexture2Ptr = atlas.loadTexture(renderer, "assets/sprites/players/player2.png");
+    spriteTexture2MedalPtr = atlas.loadTexture(renderer, "assets/sprites/players/player2Medal.png");
 
     //Player 3
-    spriteTexture3Ptr = IMG_LoadTexture(&renderer, "assets/sprites/players/player3.png");
-    spriteTexture3MedalPtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player3Medal.png");
+    spriteTexture3Ptr = atlas.loadTexture(renderer, "assets/sprites/players/player3.png");
+    spriteTexture3MedalPtr = atlas.loadTexture(renderer, "assets/sprites/players/player3Medal.png");
 
     //Player 4
-    spriteTexture4Ptr = IMG_LoadTexture(&renderer, "assets/sprites/players/player4.png");
-    spriteTexture4MedalPtr = IMG_LoadTexture(&renderer, "assets/sprites/players/player4Medal.png");
+    spriteTexture4Ptr = atlas.loadTexture(renderer, "assets/sprites/players/player4.png");
+    spriteTexture4MedalPtr = atlas.loadTexture(renderer, "assets/sprites/players/player4Medal.png");
 
     // Check errors
     if (baseSpriteTexturePtr == nullptr || spriteTexture1Ptr == nullptr || spriteTexture2Ptr == nullptr || spriteTexture3Ptr == nullptr || spriteTexture4Ptr == nullptr || spriteTexture1MedalPtr == nullptr || spriteTexture2MedalPtr == nullptr || spriteTexture3MedalPtr == nullptr || spriteTexture4MedalPtr == nullptr) {
@@ -487,6 +559,10 @@ void Player::setSpriteTextureByID(int id) {
 void Player::teleport(float newX, float newY) {
     x = newX;
     y = newY;
+
+    // Do not interpolate the jump between the two positions
+    previousX = newX;
+    previousY = newY;
 }
 
 void Player::addToScore(int val) {
@@ -505,12 +581,12 @@ void Player::hitAction(bool state) {
         sprite.setAnimation(hit);
         hitLock = true;
         hitTimer = HIT_TIME;
-        lastHitTimeUpdate = SDL_GetTicks();
+        lastHitTimeUpdate = SimulationClock::getTime();
     }
 }
 
 bool Player::canJump() const {
-    return isGrounded || ((static_cast<float>(SDL_GetTicks()) - static_cast<float>(lastTimeOnPlatform)) / 1000.0f <= coyoteTime);
+    return isGrounded || ((static_cast<float>(SimulationClock::getTime()) - static_cast<float>(lastTimeOnPlatform)) / 1000.0f <= coyoteTime);
 }
 
 void Player::calculateXaxisMovement(double delta_time) {
@@ -602,8 +678,8 @@ void Player::calculateMovement(double delta_time) {
 
 void Player::updateHitZone() {
     if (hitTimer > 0) {
-        hitTimer -= static_cast<int>(SDL_GetTicks() - lastHitTimeUpdate);
-        lastHitTimeUpdate = SDL_GetTicks();
+        hitTimer -= static_cast<int>(SimulationClock::getTime() - lastHitTimeUpdate);
+        lastHitTimeUpdate = SimulationClock::getTime();
 
         // Check horizontal orientation
         if (sprite.getFlipHorizontal() == SDL_FLIP_NONE) {
@@ -689,6 +765,8 @@ bool Player::hasMoved() const {
 }
 
 void Player::applyMovement(double delta_time) {
+    previousX = x;
+    previousY = y;
 
     // If the buffer is too big, move the player and decrease the buffer by the full amount
     if (buffer.deltaX > 40 || buffer.deltaX < -40 || buffer.deltaY > 40 || buffer.deltaY < -40) {
@@ -766,21 +844,21 @@ void Player::updateSpriteOrientation() {
 }
 
 
-void Player::render(SDL_Renderer *renderer, Point camera) {
+void Player::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) {
     SDL_Rect srcRect = sprite.getSrcRect();
 
-    float x_rect = x - camera.x - textureOffsets.x;
-    float y_rect = y - camera.y - textureOffsets.y;
+    float x_rect = std::lerp(previousX, x, interpolation) - camera.x - textureOffsets.x;
+    float y_rect = std::lerp(previousY, y, interpolation) - camera.y - textureOffsets.y;
     float w_rect = width + textureOffsets.x + textureOffsets.w;
     float h_rect = height + textureOffsets.y + textureOffsets.h;
 
     SDL_FRect player_rect = {x_rect, y_rect, w_rect, h_rect};
-    SDL_RenderCopyExF(renderer, sprite.getTexture(), &srcRect, &player_rect, 0.0, nullptr, sprite.getFlip());
+    RenderQueue::draw(RenderLayer::PLAYERS, sprite.getTexture(), srcRect, player_rect, 0.0, sprite.getFlip());
 }
 
-void Player::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Player::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-    SDL_FRect playerRect = {x - camera.x, y - camera.y, width, height};
+    SDL_FRect playerRect = {std::lerp(previousX, x, interpolation) - camera.x, std::lerp(previousY, y, interpolation) - camera.y, width, height};
     SDL_RenderFillRectF(renderer, &playerRect);
 }
 
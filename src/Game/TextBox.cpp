@@ -5,8 +5,7 @@
 
 TextBox::TextBox(SDL_Renderer *renderer, SDL_Rect rect, std::string placeholder, size_t maxLength)
         : renderer(renderer), rect(rect), maxLength(maxLength), placeholder(std::move(placeholder)) {
-    fonts = RenderManager::getFonts();
-    font = fonts[0];
+    textAtlas = RenderManager::getGlyphAtlases()[0].get();
 
     // Set the initial cursor position to the left edge of the textbox
     cursorPosition.x = rect.x;
@@ -31,9 +30,7 @@ void TextBox::emptyText() {
 }
 
 int TextBox::getTextWidth(const std::string& val) const {
-    int width = 0;
-    TTF_SizeUTF8(font, val.c_str(), &width, nullptr);
-    return width;
+    return textAtlas->getTextSize(val).x;
 }
 
 void TextBox::handleEvent(const SDL_Event &e) {
@@ -203,29 +200,23 @@ void TextBox::render() {
     int textX = rect.x + margin - scrollOffset; // Adjust this value to add some padding from the left edge
     int textY = rect.y + rect.h / 2; // Center vertically within the textbox
 
-    // Create a surface and texture for the text
-    SDL_Surface *text_surface = TTF_RenderUTF8_Blended(font, display_text.c_str(), text_color_final);
-    SDL_Texture *text_texture = SDL_CreateTextureFromSurface(renderer, text_surface);
-
     // Update the text rendering rectangle
+    SDL_Point text_size = textAtlas->getTextSize(display_text);
     SDL_Rect text_rect = {
             textX,
-            textY - text_surface->h / 2, // Center vertically within the textbox
-            text_surface->w,
-            text_surface->h
+            textY - text_size.y / 2, // Center vertically within the textbox
+            text_size.x,
+            text_size.y
     };
 
     // Clip the text rendering rectangle with SDL_RenderSetClipRect
     SDL_RenderSetClipRect(renderer, &rect);
-    SDL_RenderCopy(renderer, text_texture, nullptr, &text_rect);
+    textAtlas->render(renderer, display_text, text_rect.x, text_rect.y, text_color_final);
     renderCursor();
     SDL_SetTextInputRect(&text_rect);
 
     // Reset the clip rectangle
     SDL_RenderSetClipRect(renderer, nullptr);
-
-    SDL_FreeSurface(text_surface);
-    SDL_DestroyTexture(text_texture);
 }
 
 void TextBox::renderCursor() {
@@ -3,7 +3,7 @@
 /* CONSTRUCTORS */
 
 Crusher::Crusher(float x, float y, float size, float min, float max, Uint32 moveUpTime, Uint32 waitUpTime, Uint32 waitDownTime, const Texture& texture)
-        : x(x), y(y), size(size), min(min), max(max), pixelToMove(std::abs(max - min) / static_cast<float>(moveUpTime)),
+        : x(x), y(y), previousY(y), size(size), min(min), max(max), pixelToMove(std::abs(max - min) / static_cast<float>(moveUpTime)),
         moveUpTime(moveUpTime), waitUpTime(waitUpTime), waitDownTime(waitDownTime), texture(texture) {
 
     // Set the size
@@ -51,6 +51,10 @@ SDL_FRect Crusher::getBoundingBox() const {
     return {x, y, w, h};
 }
 
+CrusherState Crusher::getState() const {
+    return {x, y, direction, isCrushing, isMoving, buffer, timer, lastUpdate};
+}
+
 SDL_FRect Crusher::getCrushingZoneBoundingBox() const {
     return  {x + 1, y + h, w - 2, 1};
 }
@@ -64,6 +68,7 @@ void Crusher::setX(float value) {
 
 void Crusher::setY(float value) {
     y = value;
+    previousY = value; // Do not interpolate the jump to the new position
 }
 
 void Crusher::setDirection(float value) {
@@ -85,6 +90,17 @@ void Crusher::setIsOnScreen(bool state) {
     isOnScreen = state;
 }
 
+void Crusher::setState(const CrusherState &state) {
+    x = state.x;
+    y = state.y;
+    direction = state.direction;
+    isCrushing = state.isCrushing;
+    isMoving = state.isMoving;
+    buffer = state.buffer;
+    timer = state.timer;
+    lastUpdate = state.lastUpdate;
+}
+
 
 /* METHODS */
 
@@ -104,7 +120,7 @@ void Crusher::applyUpMovement(double delta_time) {
         y = min;
         direction = 1;
         timer = static_cast<int>(waitUpTime);
-        lastUpdate = SDL_GetTicks();
+        lastUpdate = SimulationClock::getTime();
     }
 }
 
@@ -127,7 +143,7 @@ bool Crusher::applyDownMovement(double delta_time) {
         isCrushing = false;
         crushingSound.play(0, -1);
         timer = static_cast<int>(waitDownTime);
-        lastUpdate = SDL_GetTicks();
+        lastUpdate = SimulationClock::getTime();
         return true;
     }
 
@@ -135,13 +151,14 @@ bool Crusher::applyDownMovement(double delta_time) {
 }
 
 bool Crusher::applyMovement(double delta_time) {
+    previousY = y;
     bool check = false;
 
     if (isMoving && isOnScreen) {
         // The crusher is in a waiting state
         if (timer > 0) {
-            timer -= static_cast<int>(SDL_GetTicks() - lastUpdate);
-            lastUpdate = SDL_GetTicks();
+            timer -= static_cast<int>(SimulationClock::getTime() - lastUpdate);
+            lastUpdate = SimulationClock::getTime();
         }
         // The crusher is moving
         else {
@@ -156,18 +173,19 @@ bool Crusher::applyMovement(double delta_time) {
     return check;
 }
 
-void Crusher::render(SDL_Renderer *renderer, Point camera) const {
+void Crusher::render([[maybe_unused]] SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_Rect src_rect = texture.getSize();
-        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y - camera.y - textureOffsets.y,w + textureOffsets.w, h + textureOffsets.h};
-        SDL_RenderCopyExF(renderer, texture.getTexture(), &src_rect, &platform_rect, 0.0, nullptr, texture.getFlip());
+        float y_rect = std::lerp(previousY, y, interpolation) - camera.y - textureOffsets.y;
+        SDL_FRect platform_rect = {x - camera.x - textureOffsets.x, y_rect,w + textureOffsets.w, h + textureOffsets.h};
+        RenderQueue::draw(RenderLayer::TRAPS, texture.getTexture(), src_rect, platform_rect, 0.0, texture.getFlip());
     }
 }
 
-void Crusher::renderDebug(SDL_Renderer *renderer, Point camera) const {
+void Crusher::renderDebug(SDL_Renderer *renderer, Point camera, float interpolation) const {
     if (isOnScreen) {
         SDL_SetRenderDrawColor(renderer, 249, 190, 152, 255);
-        SDL_FRect platform_rect = {x - camera.x, y - camera.y, w, h};
+        SDL_FRect platform_rect = {x - camera.x, std::lerp(previousY, y, interpolation) - camera.y, w, h};
         SDL_RenderFillRectF(renderer, &platform_rect);
     }
 }
\ No newline at end of file
@@ -4,15 +4,15 @@
  * @brief Implements the Button class for rendering and handling events for buttons in the game.
  */
 
-Button::Button(SDL_Renderer *renderer, TTF_Font *font, ButtonPosition position, int value, std::string buttonText,
+Button::Button(SDL_Renderer *renderer, GlyphAtlas *textAtlas, ButtonPosition position, int value, std::string buttonText,
                ButtonAction buttonAction, SDL_Color normalColor, SDL_Color hoverColor, SDL_Color textColor) :
-        renderer(renderer), font(font), buttonText(std::move(buttonText)), position(position), value(value),
+        renderer(renderer), textAtlas(textAtlas), buttonText(std::move(buttonText)), position(position), value(value),
         buttonAction(buttonAction), normalColor(normalColor), hoverColor(hoverColor), textColor(textColor) {
 }
 
-Button::Button(SDL_Renderer *renderer, TTF_Font *font, ButtonPosition position, int value, std::string buttonText,
+Button::Button(SDL_Renderer *renderer, GlyphAtlas *textAtlas, ButtonPosition position, int value, std::string buttonText,
                ButtonAction buttonAction, SDL_Color normalColor, SDL_Color hoverColor, SDL_Color textColor, short borderRadius) :
-        renderer(renderer), font(font), buttonText(std::move(buttonText)), position(position), value(value), borderRadius(borderRadius),
+        renderer(renderer), textAtlas(textAtlas), buttonText(std::move(buttonText)), position(position), value(value), borderRadius(borderRadius),
         buttonAction(buttonAction), normalColor(normalColor), hoverColor(hoverColor), textColor(textColor) {
 }
 
@@ -103,18 +103,9 @@ void Button::render() {
             color.r, color.g, color.b, color.a
     );
 
-    // Render the text on the button
-    SDL_Surface *text_surface = TTF_RenderUTF8_Blended(font, buttonText.c_str(), textColor);
-    SDL_Texture *text_texture = SDL_CreateTextureFromSurface(renderer, text_surface);
-    SDL_Rect text_rect = {
-            position.x + position.w / 2 - text_surface->w / 2,
-            position.y + position.h / 2 - text_surface->h / 2,
-            text_surface->w, text_surface->h
-    };
-
-    SDL_RenderCopy(renderer, text_texture, nullptr, &text_rect);
-    SDL_FreeSurface(text_surface);
-    SDL_DestroyTexture(text_texture);
+    // Render the text centered on the button
+    SDL_Point text_size = textAtlas->getTextSize(buttonText);
+    textAtlas->render(renderer, buttonText, position.x + position.w / 2 - text_size.x / 2, position.y + position.h / 2 - text_size.y / 2, textColor);
 }
 
 void Button::handleEvent(SDL_Event const &event) {
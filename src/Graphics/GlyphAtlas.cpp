@@ -0,0 +1,157 @@
+#include "../../include/Graphics/GlyphAtlas.h"
+
+/**
+ * @file GlyphAtlas.cpp
+ * @brief Implements the GlyphAtlas class drawing text from glyphs rasterized once into a texture.
+ */
+
+
+/* CONSTRUCTORS */
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font) : font(font) {
+    fontHeight = TTF_FontHeight(font);
+    SDL_Color white = {255, 255, 255, 255};
+
+    // Rasterize every glyph and place them in rows
+    std::vector<SDL_Surface *> surfaces(glyphs.size(), nullptr);
+    int x = 0;
+    int y = 0;
+    for (Uint32 codepoint = firstCodepoint; codepoint <= lastCodepoint; codepoint++) {
+        if (!TTF_GlyphIsProvided32(font, codepoint)) continue;
+
+        AtlasGlyph &glyph = glyphs[codepoint - firstCodepoint];
+        SDL_Surface *surface = TTF_RenderGlyph32_Blended(font, codepoint, white);
+        if (surface == nullptr) continue;
+        TTF_GlyphMetrics32(font, codepoint, nullptr, nullptr, nullptr, nullptr, &glyph.advance);
+
+        if (x + surface->w > atlasWidth) {
+            x = 0;
+            y += fontHeight;
+        }
+        glyph.source = {x, y, surface->w, surface->h};
+        surfaces[codepoint - firstCodepoint] = surface;
+        x += surface->w;
+    }
+    atlasHeight = y + fontHeight;
+
+    // Copy the glyphs into the atlas, keeping their transparency
+    SDL_Surface *atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    for (size_t index = 0; index < surfaces.size(); index++) {
+        if (surfaces[index] == nullptr) continue;
+        if (atlas != nullptr) {
+            SDL_SetSurfaceBlendMode(surfaces[index], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[index], nullptr, atlas, &glyphs[index].source);
+        }
+        SDL_FreeSurface(surfaces[index]);
+    }
+
+    if (atlas != nullptr) {
+        texture = SDL_CreateTextureFromSurface(renderer, atlas);
+        SDL_FreeSurface(atlas);
+    }
+    if (texture == nullptr) {
+        std::cerr << "GlyphAtlas: " << SDL_GetError() << std::endl;
+        return;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    if (texture != nullptr) SDL_DestroyTexture(texture);
+}
+
+
+/* ACCESSORS */
+
+TTF_Font *GlyphAtlas::getFont() const {
+    return font;
+}
+
+SDL_Point GlyphAtlas::getTextSize(const std::string &text) {
+    const TextRun &run = shape(text);
+    return {run.width, run.height};
+}
+
+
+/* METHODS */
+
+void GlyphAtlas::render(SDL_Renderer *renderer, const std::string &text, int x, int y, SDL_Color color) {
+    if (texture == nullptr) return;
+
+    const TextRun &run = shape(text);
+    auto width = static_cast<float>(atlasWidth);
+    auto height = static_cast<float>(atlasHeight);
+
+    // Two triangles per glyph, the white glyphs are tinted by the vertex color
+    vertices.clear();
+    indices.clear();
+    for (const GlyphQuad &quad : run.quads) {
+        auto left = static_cast<float>(x + quad.destination.x);
+        auto top = static_cast<float>(y + quad.destination.y);
+        auto right = left + static_cast<float>(quad.destination.w);
+        auto bottom = top + static_cast<float>(quad.destination.h);
+        float sourceLeft = static_cast<float>(quad.source.x) / width;
+        float sourceTop = static_cast<float>(quad.source.y) / height;
+        float sourceRight = static_cast<float>(quad.source.x + quad.source.w) / width;
+        float sourceBottom = static_cast<float>(quad.source.y + quad.source.h) / height;
+
+        auto first = static_cast<int>(vertices.size());
+        vertices.push_back({{left, top}, color, {sourceLeft, sourceTop}});
+        vertices.push_back({{right, top}, color, {sourceRight, sourceTop}});
+        vertices.push_back({{left, bottom}, color, {sourceLeft, sourceBottom}});
+        vertices.push_back({{right, bottom}, color, {sourceRight, sourceBottom}});
+        indices.insert(indices.end(), {first, first + 1, first + 2, first + 2, first + 1, first + 3});
+    }
+
+    if (!indices.empty()) {
+        SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()));
+    }
+}
+
+const TextRun &GlyphAtlas::shape(const std::string &text) {
+    if (auto run = runs.find(text); run != runs.end()) return run->second;
+
+    // The typed texts would fill the cache forever, it is emptied once full
+    if (runs.size() >= maxCachedRuns) runs.clear();
+
+    TextRun &run = runs[text];
+    run.height = fontHeight;
+
+    int penX = 0;
+    Uint32 previous = 0;
+    size_t index = 0;
+    while (index < text.size()) {
+        Uint32 codepoint = decodeUtf8(text, index);
+        if (codepoint < firstCodepoint || codepoint > lastCodepoint || glyphs[codepoint - firstCodepoint].advance == 0) {
+            if (codepoint == '\n' || codepoint == '\t') codepoint = ' ';
+            else if (codepoint != ' ') codepoint = fallbackCodepoint;
+        }
+        const AtlasGlyph &glyph = glyphs[codepoint - firstCodepoint];
+
+        if (previous != 0) penX += TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+        if (glyph.source.w > 0) {
+            run.quads.push_back({glyph.source, {penX, 0, glyph.source.w, glyph.source.h}});
+            run.width = std::max(run.width, penX + glyph.source.w);
+        }
+        penX += glyph.advance;
+        previous = codepoint;
+    }
+    run.width = std::max(run.width, penX);
+    return run;
+}
+
+Uint32 GlyphAtlas::decodeUtf8(const std::string &text, size_t &index) {
+    auto byte = static_cast<unsigned char>(text[index++]);
+    if (byte < 0x80) return byte;
+
+    // Number of continuation bytes announced by the leading byte
+    int length = byte >= 0xF0 ? 3 : byte >= 0xE0 ? 2 : byte >= 0xC0 ? 1 : -1;
+    if (length < 0) return fallbackCodepoint;
+
+    Uint32 codepoint = byte & (0x3F >> length);
+    for (int i = 0; i < length; i++) {
+        if (index >= text.size() || (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80) return fallbackCodepoint;
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[index++]) & 0x3F);
+    }
+    return codepoint;
+}
@@ -0,0 +1,104 @@
+#include "../../include/Graphics/RenderQueue.h"
+
+/**
+ * @file RenderQueue.cpp
+ * @brief Implements the RenderQueue class responsible for drawing the sprites of a frame in batches.
+ */
+
+// Static member initialization
+std::unordered_map<SDL_Texture*, AtlasRegion> RenderQueue::regions;
+std::vector<DrawCommand> RenderQueue::commands;
+std::vector<SDL_Vertex> RenderQueue::vertices;
+std::vector<int> RenderQueue::indices;
+
+
+/* MODIFIERS */
+
+void RenderQueue::setRegion(SDL_Texture *texture, AtlasRegion region) {
+    regions[texture] = region;
+}
+
+void RenderQueue::removeRegion(SDL_Texture *texture) {
+    regions.erase(texture);
+}
+
+
+/* METHODS */
+
+void RenderQueue::draw(RenderLayer layer, SDL_Texture *texture, const SDL_Rect &source, const SDL_FRect &destination,
+                       double angle, SDL_RendererFlip flip) {
+    if (texture == nullptr) return;
+
+    DrawCommand command = {layer, texture, source, destination, angle, flip};
+    if (auto region = regions.find(texture); region != regions.end()) {
+        command.texture = region->second.page;
+        command.source.x += region->second.area.x;
+        command.source.y += region->second.area.y;
+    }
+    commands.push_back(command);
+}
+
+void RenderQueue::flush(SDL_Renderer *renderer) {
+    ProfileZone zone("RenderQueue::flush");
+    // Sort by texture inside each layer, the order of the sprites sharing both is kept
+    std::ranges::stable_sort(commands, [](const DrawCommand &a, const DrawCommand &b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        return std::less<SDL_Texture*>()(a.texture, b.texture);
+    });
+
+    // Draw each run of sprites sharing a texture in one call, even across layers
+    size_t start = 0;
+    while (start < commands.size()) {
+        SDL_Texture *texture = commands[start].texture;
+        int width = 0;
+        int height = 0;
+        SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+
+        vertices.clear();
+        indices.clear();
+        size_t end = start;
+        while (end < commands.size() && commands[end].texture == texture) {
+            appendQuad(commands[end], static_cast<float>(width), static_cast<float>(height));
+            end++;
+        }
+
+        SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()), indices.data(), static_cast<int>(indices.size()));
+        start = end;
+    }
+
+    commands.clear();
+}
+
+void RenderQueue::appendQuad(const DrawCommand &command, float width, float height) {
+    const SDL_Rect &source = command.source;
+    const SDL_FRect &destination = command.destination;
+
+    // Texture coordinates of the corners, swapped to flip the sprite
+    float left = static_cast<float>(source.x) / width;
+    float right = static_cast<float>(source.x + source.w) / width;
+    float top = static_cast<float>(source.y) / height;
+    float bottom = static_cast<float>(source.y + source.h) / height;
+    if (command.flip & SDL_FLIP_HORIZONTAL) std::swap(left, right);
+    if (command.flip & SDL_FLIP_VERTICAL) std::swap(top, bottom);
+
+    // Rotate the corners clockwise around the center of the destination, like SDL_RenderCopyExF()
+    float centerX = destination.x + destination.w / 2.0f;
+    float centerY = destination.y + destination.h / 2.0f;
+    float halfW = destination.w / 2.0f;
+    float halfH = destination.h / 2.0f;
+    float radians = static_cast<float>(command.angle * M_PI / 180.0);
+    float cosine = command.angle == 0.0 ? 1.0f : std::cos(radians);
+    float sine = command.angle == 0.0 ? 0.0f : std::sin(radians);
+
+    auto corner = [&](float dx, float dy, float u, float v) {
+        SDL_FPoint position = {centerX + dx * cosine - dy * sine, centerY + dx * sine + dy * cosine};
+        vertices.push_back({position, {255, 255, 255, 255}, {u, v}});
+    };
+
+    auto first = static_cast<int>(vertices.size());
+    corner(-halfW, -halfH, left, top);
+    corner(halfW, -halfH, right, top);
+    corner(-halfW, halfH, left, bottom);
+    corner(halfW, halfH, right, bottom);
+    indices.insert(indices.end(), {first, first + 1, first + 2, first + 2, first + 1, first + 3});
+}
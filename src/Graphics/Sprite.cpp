@@ -22,6 +22,11 @@ SDL_Rect Sprite::getSrcRect() const {
     return srcRect;
 }
 
+SpriteState Sprite::getState() const {
+    return {animation, animationIndexX, lastAnimationUpdate, srcRect, nextAnimation, nbFrameDisplayed,
+            uniqueAnimationIsDisplayed, getFlipHorizontal(), getFlipVertical()};
+}
+
 
 /* MODIFIERS */
 
@@ -41,7 +46,7 @@ void Sprite::setAnimation(const Animation& newAnimation) {
             animation = newAnimation;
             animationIndexX = 0;
             nbFrameDisplayed = 0;
-            lastAnimationUpdate = SDL_GetTicks();
+            lastAnimationUpdate = SimulationClock::getTime();
 
         }
         // Else, the current animation is unique, store the new animation to display it after the unique animation ends
@@ -55,6 +60,18 @@ void Sprite::setAnimationIndexX(int index) {
     animationIndexX = index;
 }
 
+void Sprite::setState(const SpriteState &state) {
+    animation = state.animation;
+    animationIndexX = state.animationIndexX;
+    lastAnimationUpdate = state.lastAnimationUpdate;
+    srcRect = state.srcRect;
+    nextAnimation = state.nextAnimation;
+    nbFrameDisplayed = state.nbFrameDisplayed;
+    uniqueAnimationIsDisplayed = state.uniqueAnimationIsDisplayed;
+    setFlipHorizontal(state.flipHorizontal);
+    setFlipVertical(state.flipVertical);
+}
+
 
 /* METHODS */
 
@@ -68,9 +85,10 @@ bool Sprite::updateAnimation() {
         check = true;
     }
 
-    // Update x position animation
-    if (SDL_GetTicks() - lastAnimationUpdate > animation.speed) {
-        lastAnimationUpdate = SDL_GetTicks() ;
+    // Update x position animation, on the simulated time since the end of an animation moves the players between lists
+    Uint32 time = SimulationClock::getTime();
+    if (time > lastAnimationUpdate && time - lastAnimationUpdate > animation.speed) {
+        lastAnimationUpdate = time;
         animationIndexX = (animationIndexX + 1) % animation.frames;
         nbFrameDisplayed++;
     }
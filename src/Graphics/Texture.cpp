@@ -31,6 +31,10 @@ SDL_RendererFlip Texture::getFlipHorizontal() const {
     return flipHorizontal;
 }
 
+SDL_RendererFlip Texture::getFlipVertical() const {
+    return flipVertical;
+}
+
 SDL_RendererFlip Texture::getFlip() const {
     return static_cast<SDL_RendererFlip>(flipVertical + flipHorizontal);
 }
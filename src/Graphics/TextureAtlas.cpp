@@ -0,0 +1,120 @@
+#include "../../include/Graphics/TextureAtlas.h"
+
+/**
+ * @file TextureAtlas.cpp
+ * @brief Implements the TextureAtlas class responsible for packing sprites into a few large textures.
+ */
+
+
+/* ACCESSORS */
+
+size_t TextureAtlas::getPageCount() const {
+    return pages.size();
+}
+
+
+/* METHODS */
+
+SDL_Texture *TextureAtlas::loadTexture(SDL_Renderer &renderer, const std::string &file_path) {
+    SDL_Surface *surface = IMG_Load(file_path.c_str());
+    if (surface == nullptr) return nullptr;
+
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(&renderer, surface);
+    if (texture == nullptr) {
+        SDL_FreeSurface(surface);
+        return nullptr;
+    }
+    return addTexture(texture, surface);
+}
+
+SDL_Texture *TextureAtlas::addTexture(SDL_Texture *texture, SDL_Surface *surface) {
+    textures.push_back(texture);
+
+    // The dedicated server never draws, the pixels are not needed
+#ifdef HEADLESS
+    SDL_FreeSurface(surface);
+#else
+    pending.emplace_back(texture, surface);
+#endif
+    return texture;
+}
+
+void TextureAtlas::build(SDL_Renderer &renderer) {
+    SDL_RendererInfo info;
+    int pageSize = maxPageSize;
+    if (SDL_GetRendererInfo(&renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0) {
+        pageSize = std::min({pageSize, info.max_texture_width, info.max_texture_height});
+    }
+
+    // Place the tallest sprites first, in rows
+    std::ranges::sort(pending, [](const auto &a, const auto &b) { return a.second->h > b.second->h; });
+
+    std::vector<std::pair<SDL_Texture*, SDL_Rect>> placed;
+    int x = 0;
+    int y = 0;
+    int rowHeight = 0;
+    auto buildPage = [&]() {
+        if (placed.empty()) return;
+
+        // The sprites of a page that could not be created stay drawn from their own texture
+        SDL_Texture *pageTexture = nullptr;
+        SDL_Surface *page = SDL_CreateRGBSurfaceWithFormat(0, pageSize, y + rowHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (page != nullptr) {
+            for (const auto &[texture, area] : placed) {
+                auto sprite = std::ranges::find(pending, texture, &std::pair<SDL_Texture*, SDL_Surface*>::first);
+                SDL_Rect destination = area;
+                SDL_SetSurfaceBlendMode(sprite->second, SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(sprite->second, nullptr, page, &destination);
+            }
+            pageTexture = SDL_CreateTextureFromSurface(&renderer, page);
+            SDL_FreeSurface(page);
+        }
+
+        if (pageTexture == nullptr) {
+            std::cerr << "TextureAtlas: " << SDL_GetError() << std::endl;
+        } else {
+            SDL_SetTextureBlendMode(pageTexture, SDL_BLENDMODE_BLEND);
+            pages.push_back(pageTexture);
+            for (const auto &[texture, area] : placed) RenderQueue::setRegion(texture, {pageTexture, area});
+        }
+
+        placed.clear();
+        x = 0;
+        y = 0;
+        rowHeight = 0;
+    };
+
+    for (const auto &[texture, surface] : pending) {
+        // A sprite larger than a page stays drawn from its own texture
+        if (surface->w > pageSize || surface->h > pageSize) continue;
+
+        if (x + surface->w > pageSize) {
+            x = 0;
+            y += rowHeight + padding;
+            rowHeight = 0;
+        }
+        if (y + surface->h > pageSize) buildPage();
+
+        placed.emplace_back(texture, SDL_Rect{x, y, surface->w, surface->h});
+        x += surface->w + padding;
+        rowHeight = std::max(rowHeight, surface->h);
+    }
+    buildPage();
+
+    for (const auto &[texture, surface] : pending) SDL_FreeSurface(surface);
+    pending.clear();
+    std::cout << "TextureAtlas: " << textures.size() << " sprites drawn from " << pages.size() << " pages." << std::endl;
+}
+
+void TextureAtlas::clear() {
+    for (SDL_Texture *texture : textures) {
+        RenderQueue::removeRegion(texture);
+        SDL_DestroyTexture(texture);
+    }
+    for (SDL_Texture *page : pages) SDL_DestroyTexture(page);
+    for (const auto &[texture, surface] : pending) SDL_FreeSurface(surface);
+
+    textures.clear();
+    pages.clear();
+    pending.clear();
+}
@@ -0,0 +1,42 @@
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+#include "../include/Game/CompiledLevel.h"
+
+/**
+ * @file LevelCompiler.cpp
+ * @brief Entry point of the level compiler, converting the JSON maps into compiled levels.
+ *
+ * Usage: play-together-level-compiler [map directories...]
+ *
+ * Without arguments, every map of the maps directory is compiled. The compiled level is written next to the JSON files.
+ */
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> map_directories;
+    for (int i = 1; i < argc; i++) {
+        std::string directory = argv[i];
+        if (!directory.ends_with('/')) directory += '/';
+        map_directories.push_back(directory);
+    }
+
+    // Compile every map by default
+    if (map_directories.empty()) {
+        std::error_code error;
+        for (const auto &entry : std::filesystem::directory_iterator(MAPS_DIRECTORY, error)) {
+            if (entry.is_directory()) map_directories.push_back(entry.path().generic_string() + "/");
+        }
+        std::ranges::sort(map_directories);
+        if (error) std::cerr << "LevelCompiler: Unable to list " << MAPS_DIRECTORY << ": " << error.message() << std::endl;
+    }
+
+    int failures = 0;
+    for (const std::string &directory : map_directories) {
+        if (!CompiledLevel::compile(directory)) failures++;
+    }
+
+    std::cout << "LevelCompiler: Compiled " << map_directories.size() - failures << " of " << map_directories.size() << " maps." << std::endl;
+    return failures == 0 ? 0 : 1;
+}
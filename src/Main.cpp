@@ -83,7 +83,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char *args[]) {
     }
 
     // Initialize game objects
-    bool quit = false;
+    std::atomic<bool> quit = false;
 
     MessageQueue messageQueue;
     Game game(window, renderer, maxFrameRate, &quit, &messageQueue);
@@ -131,22 +131,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char *args[]) {
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         SDL_RenderClear(renderer);
 
-        if (!messageQueue.empty()) {
-            auto [mainMessage, parameters] = messageQueue.pop();
-
-            if (mainMessage == "InitializeClientGame") {
-                nlohmann::json message = nlohmann::json::parse(parameters[0]);
-                game.loadLevel(
-                        message["mapName"],
-                        message["lastCheckpoint"],
-                        message["players"],
-                        message["camera"],
-                        message["platforms1D"],
-                        message["platforms2D"],
-                        message["crushers"]
-                );
-            }
-        }
+        // Apply the messages received while in the menu (e.g. the game properties sent by the server)
+        game.handleMessages();
 
         // If the game should start
         if (!menu.isDisplayingMenu()) {
@@ -162,12 +148,14 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char *args[]) {
     /* Clean up resources */
     networkManager.stopServers();
     networkManager.stopClients();
+    RenderManager::getGlyphAtlases().clear();
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     for (TTF_Font* font : RenderManager::getFonts()) {
         TTF_CloseFont(font);
     }
     TTF_Quit();
+    SoundBank::clear();
     Mix_CloseAudio();
     Mix_Quit();
     SDL_Quit();
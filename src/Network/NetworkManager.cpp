@@ -29,21 +29,25 @@ bool NetworkManager::isClientRunning() const {
 
 /** METHODS **/
 
-void NetworkManager::startServers() {
+void NetworkManager::startServers(uint16_t port) {
+    clientSnapshots.clear();
+
     try {
-        tcpServer.initialize(8080);
-        std::cout << "TCPServer: Server initialized and listening on port 8080" << std::endl;
+        tcpServer.initialize(port);
+        std::cout << "TCPServer: Server initialized and listening on port " << port << std::endl;
 
         // Start the server in a separate thread
         serverTCPThreadPtr = std::make_unique<std::jthread>([this](TCPServer *serverPtr) {
+            Profiler::setThreadName("TCP server");
             serverPtr->start(clientAddresses, clientAddressesMutex);
         }, &tcpServer);
 
-        udpServer.initialize(8080);
-        std::cout << "UDPServer: Server initialized and listening on port 8080" << std::endl;
+        udpServer.initialize(port);
+        std::cout << "UDPServer: Server initialized and listening on port " << port << std::endl;
 
         // Start the server in a separate thread
         serverUDPThreadPtr = std::make_unique<std::jthread>([this](UDPServer *serverPtr) {
+            Profiler::setThreadName("UDP server");
             serverPtr->start(clientAddresses, clientAddressesMutex);
         }, &udpServer);
     } catch (const NetworkError &) {
@@ -53,15 +57,25 @@ void NetworkManager::startServers() {
 }
 
 void NetworkManager::startClients(const std::string& ip, short port) {
+    // The snapshot numbers of a previous server are meaningless
+    receivedSnapshots.clear();
+    lastReceivedSequence = 0;
+
     unsigned short clientPort;
     try {
         tcpClient.connect(ip, port, clientPort);
         std::cout << "TCPClient: Connected to server" << std::endl;
-        clientTCPThreadPtr = std::make_unique<std::jthread>(&TCPClient::start, &tcpClient);
+        clientTCPThreadPtr = std::make_unique<std::jthread>([this] {
+            Profiler::setThreadName("TCP client");
+            tcpClient.start();
+        });
 
         udpClient.initialize(ip, port, clientPort);
         std::cout << "UDPClient: Client initialized and running on port " << clientPort << std::endl;
-        clientUDPThreadPtr = std::make_unique<std::jthread>(&UDPClient::start, &udpClient);
+        clientUDPThreadPtr = std::make_unique<std::jthread>([this] {
+            Profiler::setThreadName("UDP client");
+            udpClient.start();
+        });
     } catch (const NetworkError &) {
         stopClients();
         throw;
@@ -127,49 +141,90 @@ void NetworkManager::broadcastMessage(int protocol, const std::string &message,
     }
 }
 
-void NetworkManager::sendPlayerUpdate(uint16_t keyboardStateMask) const {
+void NetworkManager::welcomeClient(int clientSocket) {
+    // The socket may be reused from a disconnected client, the first snapshot is full
+    clientSnapshots.erase(clientSocket);
 
-    // Create a message with the player update
-    using json = nlohmann::json;
-    json message;
+    tcpServer.sendGameProperties(clientSocket);
+    tcpServer.relayClientConnection(clientSocket);
+}
 
-    message["messageType"] = "playerUpdate";
-    message["keyboardStateMask"] = keyboardStateMask;
+void NetworkManager::sendPlayerUpdate(uint16_t keyboardStateMask) const {
+    std::string packet = encodePlayerUpdate(keyboardStateMask, static_cast<uint32_t>(SimulationClock::getTick()));
 
     // If the application is a server, broadcast the message to all clients
     if (isServerRunning()) {
-        udpServer.broadcast(message.dump(), 0);
+        udpServer.broadcast(packet, 0);
     }
 
     // If the application is a client, send the message to the server
     else if (isClientRunning()) {
-        udpClient.send(message.dump());
+        udpClient.send(packet);
     }
 
     // Otherwise, the game is local only (development mode)
 }
 
-void NetworkManager::sendSyncCorrection(nlohmann::json &message) {
+void NetworkManager::sendSyncCorrection(const SyncCorrectionPacket &body) {
+    WorldSnapshot snapshot = quantizeSnapshot(body, ++snapshotSequence);
+
     // Send the correction message to all clients
     std::scoped_lock<std::mutex> lock(clientAddressesMutex);
+    std::erase_if(clientSnapshots, [this](const auto &client) { return !clientAddresses.contains(client.first); });
 
     for (const auto& [clientId, clientAddress] : clientAddresses) {
-        udpServer.sendSyncCorrection(static_cast<int>(clientId), clientAddress, message);
+        // Without an acknowledged snapshot still in the history, the base is missing and the full snapshot is sent
+        ClientSnapshots &client = clientSnapshots[static_cast<int>(clientId)];
+        const WorldSnapshot *base = client.sent.find(client.acknowledgedSequence);
+
+        // A fragmented datagram is lost whenever one of its fragments is, fewer objects are sent until the packet fits in one
+        WorldSnapshot sent = snapshot;
+        std::string packet = encodeSnapshot(sent, base, static_cast<int>(clientId), client.lastInputTick);
+        size_t max_objects = std::max({snapshot.platforms1D.size(), snapshot.platforms2D.size(), snapshot.crushers.size()});
+        while (packet.size() > MAX_SNAPSHOT_SIZE && max_objects > 0) {
+            max_objects /= 2;
+            sent = limitSnapshot(snapshot, base, max_objects);
+            packet = encodeSnapshot(sent, base, static_cast<int>(clientId), client.lastInputTick);
+        }
+
+        udpServer.send(clientAddress, packet);
+        client.sent.store(sent);
     }
 }
 
+void NetworkManager::acknowledgeSnapshot(int clientSocket, uint32_t sequence) {
+    auto client = clientSnapshots.find(clientSocket);
+    if (client == clientSnapshots.end()) return;
+
+    // Acknowledgements can arrive out of order, only a newer one moves the base
+    if (sequence > client->second.acknowledgedSequence && client->second.sent.find(sequence) != nullptr) {
+        client->second.acknowledgedSequence = sequence;
+    }
+}
+
+void NetworkManager::acknowledgeInput(int clientSocket, uint32_t tick) {
+    ClientSnapshots &client = clientSnapshots[clientSocket];
+    client.lastInputTick = std::max(client.lastInputTick, tick);
+}
+
+bool NetworkManager::receiveSnapshot(const std::string &packet, Message &message) {
+    WorldSnapshot snapshot;
+    uint32_t inputTick;
+    if (!decodeSnapshot(packet, receivedSnapshots, snapshot, inputTick)) return false;
+
+    // A late snapshot would move the objects back
+    if (snapshot.sequence <= lastReceivedSequence) return false;
+    lastReceivedSequence = snapshot.sequence;
+    receivedSnapshots.store(snapshot);
+
+    udpClient.send(encodeSnapshotAck(snapshot.sequence));
+    snapshotToMessage(snapshot, message);
+    message.inputTick = inputTick;
+    return true;
+}
+
 void NetworkManager::sendAsteroidCreation(Asteroid const &asteroid) const {
     // Create a message with the asteroid properties
-    using json = nlohmann::json;
-    json message;
-
-    message["messageType"] = "asteroidCreation";
-    message["x"] = asteroid.getX();
-    message["y"] = asteroid.getY();
-    message["speed"] = asteroid.getSpeed();
-    message["h"] = asteroid.getH();
-    message["w"] = asteroid.getW();
-    message["angle"] = asteroid.getAngle();
-
-    udpServer.broadcast(message.dump(), 0);
-}
\ No newline at end of file
+    AsteroidProperties properties = {asteroid.getX(), asteroid.getY(), asteroid.getSpeed(), asteroid.getH(), asteroid.getW(), asteroid.getAngle()};
+    udpServer.broadcast(encodeAsteroidCreation(properties), 0);
+}
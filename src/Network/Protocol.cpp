@@ -0,0 +1,392 @@
+#include "../../include/Network/Protocol.h"
+
+/**
+ * @file Protocol.cpp
+ * @brief Implements the binary wire format of the messages exchanged at high frequency (UDP).
+ */
+
+
+/* ENCODING HELPERS */
+
+/**
+ * @brief Append an unsigned integer to a packet in little-endian order.
+ * @param packet The packet to write to.
+ * @param value The value to append.
+ * @param size The number of bytes to append.
+ */
+static void appendUnsigned(std::string &packet, uint32_t value, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        packet.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+/**
+ * @brief Append a float to a packet as its IEEE 754 representation.
+ * @param packet The packet to write to.
+ * @param value The value to append.
+ */
+static void appendFloat(std::string &packet, float value) {
+    appendUnsigned(packet, std::bit_cast<uint32_t>(value), 4);
+}
+
+/**
+ * @brief Append a header to an empty packet, the player ID is left to 0.
+ * @param packet The packet to write to.
+ * @param type The type of the packet.
+ */
+static void appendHeader(std::string &packet, PacketType type) {
+    packet.push_back(static_cast<char>(PROTOCOL_VERSION));
+    packet.push_back(static_cast<char>(type));
+    appendUnsigned(packet, 0, 4);
+}
+
+/**
+ * @brief Append the difference between two quantized values as a zigzag variable-length integer.
+ * @param packet The packet to write to.
+ * @param value The new value.
+ * @param base The value known by the receiver.
+ */
+static void appendDelta(std::string &packet, int32_t value, int32_t base) {
+    // Zigzag encoding keeps small negative differences small
+    auto delta = static_cast<uint32_t>(value) - static_cast<uint32_t>(base);
+    uint32_t encoded = (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+
+    // 7 bits per byte, the high bit is set when another byte follows
+    while (encoded >= 0x80) {
+        packet.push_back(static_cast<char>((encoded & 0x7F) | 0x80));
+        encoded >>= 7;
+    }
+    packet.push_back(static_cast<char>(encoded));
+}
+
+/**
+ * @brief Write a 2-byte count at a position reserved earlier in the packet.
+ * @param packet The packet to write to.
+ * @param offset The position of the count.
+ * @param count The count to write.
+ */
+static void patchCount(std::string &packet, size_t offset, uint32_t count) {
+    packet[offset] = static_cast<char>(count & 0xFF);
+    packet[offset + 1] = static_cast<char>((count >> 8) & 0xFF);
+}
+
+constexpr uint8_t CHANGED_X = 1 << 0; /**< Flag of a snapshot entry, the x-coordinate changed. */
+constexpr uint8_t CHANGED_Y = 1 << 1; /**< Flag of a snapshot entry, the y-coordinate changed. */
+constexpr uint8_t REMOVED = 1 << 7; /**< Flag of a snapshot entry, the player is not in the snapshot anymore. */
+
+/**
+ * @brief Append the objects that changed since the base snapshot, preceded by the object count and the entry count.
+ * @param packet The packet to write to.
+ * @param objects The objects of the snapshot.
+ * @param baseObjects The objects of the base snapshot, empty for a full snapshot.
+ */
+static void appendObjectDeltas(std::string &packet, const std::vector<ObjectSnapshot> &objects, const std::vector<ObjectSnapshot> &baseObjects) {
+    appendUnsigned(packet, static_cast<uint32_t>(objects.size()), 2);
+    size_t countOffset = packet.size();
+    appendUnsigned(packet, 0, 2);
+
+    // An object missing from the base starts at (0, 0) on both sides
+    uint32_t entryCount = 0;
+    for (size_t index = 0; index < objects.size(); index++) {
+        const ObjectSnapshot base = index < baseObjects.size() ? baseObjects[index] : ObjectSnapshot();
+        const ObjectSnapshot &object = objects[index];
+
+        uint8_t flags = (object.x != base.x ? CHANGED_X : 0) | (object.y != base.y ? CHANGED_Y : 0);
+        if (flags == 0) continue;
+
+        appendUnsigned(packet, static_cast<uint32_t>(index), 2);
+        packet.push_back(static_cast<char>(flags));
+        if (flags & CHANGED_X) appendDelta(packet, object.x, base.x);
+        if (flags & CHANGED_Y) appendDelta(packet, object.y, base.y);
+        entryCount++;
+    }
+
+    patchCount(packet, countOffset, entryCount);
+}
+
+
+/* DECODING HELPERS */
+
+/**
+ * @class PacketReader
+ * @brief Reads the fields of a packet in order, remembering if the packet was too short.
+ */
+class PacketReader {
+private:
+    const std::string &packet; /**< The packet to read. */
+    size_t offset = 0; /**< The position of the next field. */
+    bool valid = true; /**< Flag indicating if every field read so far was inside the packet. */
+
+public:
+    explicit PacketReader(const std::string &packet) : packet(packet) {}
+
+    [[nodiscard]] bool isValid() const {
+        return valid;
+    }
+
+    [[nodiscard]] bool isAtEnd() const {
+        return offset == packet.size();
+    }
+
+    /**
+     * @brief Read an unsigned integer written in little-endian order.
+     * @param size The number of bytes to read.
+     * @return The value read, 0 if the packet is too short.
+     */
+    uint32_t readUnsigned(size_t size) {
+        if (offset + size > packet.size()) {
+            valid = false;
+            return 0;
+        }
+
+        uint32_t value = 0;
+        for (size_t i = 0; i < size; i++) {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(packet[offset + i])) << (8 * i);
+        }
+        offset += size;
+        return value;
+    }
+
+    /**
+     * @brief Read a float written as its IEEE 754 representation.
+     * @return The value read.
+     */
+    float readFloat() {
+        return std::bit_cast<float>(readUnsigned(4));
+    }
+
+    /**
+     * @brief Read a zigzag variable-length integer and add it to a quantized value.
+     * @param base The value known before the packet.
+     * @return The new value, base if the packet is too short.
+     */
+    int32_t readDelta(int32_t base) {
+        uint32_t encoded = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint32_t byte = readUnsigned(1);
+            if (!valid) return base;
+
+            encoded |= (byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                uint32_t delta = (encoded >> 1) ^ (0 - (encoded & 1));
+                return static_cast<int32_t>(static_cast<uint32_t>(base) + delta);
+            }
+        }
+
+        // More than 5 bytes, the integer is malformed
+        valid = false;
+        return base;
+    }
+
+    /**
+     * @brief Read the object entries written by appendObjectDeltas() and apply them.
+     * @param[in,out] objects The objects of the base snapshot, replaced by the objects of the new snapshot.
+     */
+    void readObjectDeltas(std::vector<ObjectSnapshot> &objects) {
+        objects.resize(readUnsigned(2));
+        uint32_t entryCount = readUnsigned(2);
+        for (uint32_t i = 0; i < entryCount && valid; i++) {
+            uint32_t index = readUnsigned(2);
+            auto flags = static_cast<uint8_t>(readUnsigned(1));
+            if (index >= objects.size()) {
+                valid = false;
+                return;
+            }
+
+            if (flags & CHANGED_X) objects[index].x = readDelta(objects[index].x);
+            if (flags & CHANGED_Y) objects[index].y = readDelta(objects[index].y);
+        }
+    }
+};
+
+
+/* FUNCTIONS */
+
+bool isBinaryPacket(const std::string &packet) {
+    return packet.size() >= PACKET_HEADER_SIZE && packet[0] != '{';
+}
+
+PacketType getPacketType(const std::string &packet) {
+    if (packet.size() < PACKET_HEADER_SIZE || static_cast<uint8_t>(packet[0]) != PROTOCOL_VERSION) return PacketType{0};
+    return static_cast<PacketType>(packet[1]);
+}
+
+void setPacketPlayerID(std::string &packet, int playerID) {
+    if (packet.size() < PACKET_HEADER_SIZE) return;
+
+    auto value = static_cast<uint32_t>(playerID);
+    for (size_t i = 0; i < 4; i++) {
+        packet[2 + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+std::string encodePlayerUpdate(uint16_t keyboardStateMask, uint32_t tick) {
+    std::string packet;
+    packet.reserve(PACKET_HEADER_SIZE + 6);
+
+    appendHeader(packet, PacketType::PLAYER_UPDATE);
+    appendUnsigned(packet, keyboardStateMask, 2);
+    appendUnsigned(packet, tick, 4);
+    return packet;
+}
+
+std::string encodeSnapshot(const WorldSnapshot &snapshot, const WorldSnapshot *base, int clientID, uint32_t inputTick) {
+    static const WorldSnapshot emptySnapshot;
+    const WorldSnapshot &baseSnapshot = base != nullptr ? *base : emptySnapshot;
+
+    std::string packet;
+    packet.reserve(PACKET_HEADER_SIZE + 20 + snapshot.players.size() * 9);
+
+    appendHeader(packet, PacketType::SNAPSHOT);
+    appendUnsigned(packet, snapshot.sequence, 4);
+    appendUnsigned(packet, baseSnapshot.sequence, 4);
+    appendUnsigned(packet, inputTick, 4);
+
+    // The client itself has ID -1
+    auto clientPlayerID = [clientID](int32_t playerID) {
+        return static_cast<uint32_t>(playerID == clientID ? -1 : playerID);
+    };
+
+    // Players that are new or changed, a new player starts with every value at 0 on both sides
+    size_t countOffset = packet.size();
+    appendUnsigned(packet, 0, 2);
+    uint32_t entryCount = 0;
+    for (const PlayerSnapshot &player : snapshot.players) {
+        auto basePlayer = std::ranges::find(baseSnapshot.players, player.playerID, &PlayerSnapshot::playerID);
+        bool isNew = basePlayer == baseSnapshot.players.end();
+        const PlayerSnapshot previous = isNew ? PlayerSnapshot{player.playerID} : *basePlayer;
+
+        uint8_t flags = (player.x != previous.x ? CHANGED_X : 0)
+                        | (player.y != previous.y ? CHANGED_Y : 0);
+        if (flags == 0 && !isNew) continue;
+
+        appendUnsigned(packet, clientPlayerID(player.playerID), 4);
+        packet.push_back(static_cast<char>(flags));
+        if (flags & CHANGED_X) appendDelta(packet, player.x, previous.x);
+        if (flags & CHANGED_Y) appendDelta(packet, player.y, previous.y);
+        entryCount++;
+    }
+
+    // Players of the base that are not alive anymore
+    for (const PlayerSnapshot &basePlayer : baseSnapshot.players) {
+        if (std::ranges::find(snapshot.players, basePlayer.playerID, &PlayerSnapshot::playerID) != snapshot.players.end()) continue;
+
+        appendUnsigned(packet, clientPlayerID(basePlayer.playerID), 4);
+        packet.push_back(static_cast<char>(REMOVED));
+        entryCount++;
+    }
+    patchCount(packet, countOffset, entryCount);
+
+    appendObjectDeltas(packet, snapshot.platforms1D, baseSnapshot.platforms1D);
+    appendObjectDeltas(packet, snapshot.platforms2D, baseSnapshot.platforms2D);
+    appendObjectDeltas(packet, snapshot.crushers, baseSnapshot.crushers);
+    return packet;
+}
+
+bool decodeSnapshot(const std::string &packet, const SnapshotHistory &history, WorldSnapshot &snapshot, uint32_t &inputTick) {
+    PacketReader reader(packet);
+
+    if (reader.readUnsigned(1) != PROTOCOL_VERSION) return false;
+    if (static_cast<PacketType>(reader.readUnsigned(1)) != PacketType::SNAPSHOT) return false;
+    reader.readUnsigned(4); // The sender is always the server
+
+    uint32_t sequence = reader.readUnsigned(4);
+    uint32_t baseSequence = reader.readUnsigned(4);
+    inputTick = reader.readUnsigned(4);
+    if (!reader.isValid() || sequence == 0) return false;
+
+    // Start from the base snapshot, the client must still have it
+    if (baseSequence != 0) {
+        const WorldSnapshot *base = history.find(baseSequence);
+        if (base == nullptr) return false;
+        snapshot = *base;
+    } else {
+        snapshot = WorldSnapshot();
+    }
+    snapshot.sequence = sequence;
+
+    uint32_t entryCount = reader.readUnsigned(2);
+    for (uint32_t i = 0; i < entryCount && reader.isValid(); i++) {
+        auto playerID = static_cast<int32_t>(reader.readUnsigned(4));
+        auto flags = static_cast<uint8_t>(reader.readUnsigned(1));
+
+        if (flags & REMOVED) {
+            std::erase_if(snapshot.players, [playerID](const PlayerSnapshot &player) { return player.playerID == playerID; });
+            continue;
+        }
+
+        auto player = std::ranges::find(snapshot.players, playerID, &PlayerSnapshot::playerID);
+        if (player == snapshot.players.end()) {
+            snapshot.players.push_back({playerID});
+            player = std::prev(snapshot.players.end());
+        }
+
+        if (flags & CHANGED_X) player->x = reader.readDelta(player->x);
+        if (flags & CHANGED_Y) player->y = reader.readDelta(player->y);
+    }
+
+    reader.readObjectDeltas(snapshot.platforms1D);
+    reader.readObjectDeltas(snapshot.platforms2D);
+    reader.readObjectDeltas(snapshot.crushers);
+
+    return reader.isValid() && reader.isAtEnd();
+}
+
+std::string encodeSnapshotAck(uint32_t sequence) {
+    std::string packet;
+    packet.reserve(PACKET_HEADER_SIZE + 4);
+
+    appendHeader(packet, PacketType::SNAPSHOT_ACK);
+    appendUnsigned(packet, sequence, 4);
+    return packet;
+}
+
+std::string encodeAsteroidCreation(const AsteroidProperties &asteroid) {
+    std::string packet;
+    packet.reserve(PACKET_HEADER_SIZE + 24);
+
+    appendHeader(packet, PacketType::ASTEROID_CREATION);
+    appendFloat(packet, asteroid.x);
+    appendFloat(packet, asteroid.y);
+    appendFloat(packet, asteroid.speed);
+    appendFloat(packet, asteroid.h);
+    appendFloat(packet, asteroid.w);
+    appendFloat(packet, asteroid.angle);
+    return packet;
+}
+
+bool decodePacket(const std::string &packet, Message &message) {
+    PacketReader reader(packet);
+
+    if (reader.readUnsigned(1) != PROTOCOL_VERSION) return false;
+    auto type = static_cast<PacketType>(reader.readUnsigned(1));
+    message.playerID = static_cast<int32_t>(reader.readUnsigned(4));
+
+    switch (type) {
+        case PacketType::PLAYER_UPDATE:
+            message.type = MessageType::PLAYER_UPDATE;
+            message.keyboardStateMask = static_cast<uint16_t>(reader.readUnsigned(2));
+            message.inputTick = reader.readUnsigned(4);
+            break;
+
+        case PacketType::SNAPSHOT_ACK:
+            message.type = MessageType::SNAPSHOT_ACK;
+            message.sequence = reader.readUnsigned(4);
+            break;
+
+        case PacketType::ASTEROID_CREATION:
+            message.type = MessageType::ASTEROID_CREATION;
+            message.asteroid.x = reader.readFloat();
+            message.asteroid.y = reader.readFloat();
+            message.asteroid.speed = reader.readFloat();
+            message.asteroid.h = reader.readFloat();
+            message.asteroid.w = reader.readFloat();
+            message.asteroid.angle = reader.readFloat();
+            break;
+
+        default:
+            return false;
+    }
+
+    return reader.isValid() && reader.isAtEnd();
+}
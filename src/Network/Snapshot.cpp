@@ -0,0 +1,132 @@
+#include "../../include/Network/Snapshot.h"
+
+/**
+ * @file Snapshot.cpp
+ * @brief Implements the quantized world snapshots replicated from the server to the clients.
+ */
+
+
+/* SNAPSHOT HISTORY */
+
+void SnapshotHistory::store(const WorldSnapshot &snapshot) {
+    snapshots[snapshot.sequence % SNAPSHOT_HISTORY_SIZE] = snapshot;
+}
+
+const WorldSnapshot *SnapshotHistory::find(uint32_t sequence) const {
+    if (sequence == 0) return nullptr;
+
+    // The slot may hold a newer or an older snapshot
+    const WorldSnapshot &snapshot = snapshots[sequence % SNAPSHOT_HISTORY_SIZE];
+    return snapshot.sequence == sequence ? &snapshot : nullptr;
+}
+
+void SnapshotHistory::clear() {
+    for (WorldSnapshot &snapshot : snapshots) {
+        snapshot = WorldSnapshot();
+    }
+}
+
+
+/* FUNCTIONS */
+
+/**
+ * @brief Convert quantized object positions into position corrections identified by their index.
+ * @param objects The quantized positions.
+ * @param[out] corrections The dequantized positions.
+ */
+static void objectsToCorrections(const std::vector<ObjectSnapshot> &objects, std::vector<PositionCorrection> &corrections) {
+    corrections.clear();
+    for (size_t index = 0; index < objects.size(); index++) {
+        corrections.push_back({
+            static_cast<int>(index),
+            static_cast<float>(objects[index].x) / SNAPSHOT_POSITION_SCALE,
+            static_cast<float>(objects[index].y) / SNAPSHOT_POSITION_SCALE
+        });
+    }
+}
+
+/**
+ * @brief Quantize object positions.
+ * @param objects The positions in pixels.
+ * @param[out] snapshots The quantized positions.
+ */
+static void quantizeObjects(const std::vector<ObjectPosition> &objects, std::vector<ObjectSnapshot> &snapshots) {
+    snapshots.reserve(objects.size());
+    for (const ObjectPosition &object : objects) {
+        snapshots.push_back({quantizePosition(object.x), quantizePosition(object.y)});
+    }
+}
+
+/**
+ * @brief Limit the objects of a list that differ from the base list.
+ * @param[in,out] objects The objects of the snapshot.
+ * @param baseObjects The objects of the base snapshot, empty for a full snapshot.
+ * @param maxObjects The number of objects that may differ from the base.
+ */
+static void limitObjects(std::vector<ObjectSnapshot> &objects, const std::vector<ObjectSnapshot> &baseObjects, size_t maxObjects) {
+    size_t changed = 0;
+    for (size_t index = 0; index < objects.size(); index++) {
+        // An object missing from the base starts at (0, 0) on both sides
+        const ObjectSnapshot base = index < baseObjects.size() ? baseObjects[index] : ObjectSnapshot();
+        if (objects[index].x == base.x && objects[index].y == base.y) continue;
+        if (changed < maxObjects) {
+            changed++;
+            continue;
+        }
+
+        // The objects are identified by their index, so a new object can only be left out with the ones after it
+        if (index >= baseObjects.size()) {
+            objects.resize(index);
+            return;
+        }
+        objects[index] = base;
+    }
+}
+
+WorldSnapshot quantizeSnapshot(const SyncCorrectionPacket &body, uint32_t sequence) {
+    WorldSnapshot snapshot;
+    snapshot.sequence = sequence;
+
+    snapshot.players.reserve(body.players.size());
+    for (const PlayerState &player : body.players) {
+        snapshot.players.push_back({
+            player.playerID,
+            quantizePosition(player.x),
+            quantizePosition(player.y)
+        });
+    }
+
+    quantizeObjects(body.platforms1D, snapshot.platforms1D);
+    quantizeObjects(body.platforms2D, snapshot.platforms2D);
+    quantizeObjects(body.crushers, snapshot.crushers);
+    return snapshot;
+}
+
+WorldSnapshot limitSnapshot(const WorldSnapshot &snapshot, const WorldSnapshot *base, size_t maxObjects) {
+    static const WorldSnapshot emptySnapshot;
+    const WorldSnapshot &baseSnapshot = base != nullptr ? *base : emptySnapshot;
+
+    WorldSnapshot limited = snapshot;
+    limitObjects(limited.platforms1D, baseSnapshot.platforms1D, maxObjects);
+    limitObjects(limited.platforms2D, baseSnapshot.platforms2D, maxObjects);
+    limitObjects(limited.crushers, baseSnapshot.crushers, maxObjects);
+    return limited;
+}
+
+void snapshotToMessage(const WorldSnapshot &snapshot, Message &message) {
+    message.type = MessageType::SYNC_CORRECTION;
+    message.sequence = snapshot.sequence;
+
+    message.players.clear();
+    for (const PlayerSnapshot &player : snapshot.players) {
+        message.players.push_back({
+            player.playerID,
+            static_cast<float>(player.x) / SNAPSHOT_POSITION_SCALE,
+            static_cast<float>(player.y) / SNAPSHOT_POSITION_SCALE
+        });
+    }
+
+    objectsToCorrections(snapshot.platforms1D, message.platforms1D);
+    objectsToCorrections(snapshot.platforms2D, message.platforms2D);
+    objectsToCorrections(snapshot.crushers, message.crushers);
+}
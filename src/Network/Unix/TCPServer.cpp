@@ -3,23 +3,29 @@
 #include "../../../include/Network/Unix/TCPServer.h"
 
 /*
-    The TCP server listens on a specified port and accepts incoming connections from clients. For each
-    connected client, a new thread is created to handle incoming and outgoing messages.
+    The TCP server listens on a specified port and accepts incoming connections from clients. All the
+    connections are handled by a single thread running an edge-triggered epoll reactor.
 
     The server can receive variable-sized messages from clients. Each message starts with the message size
-    (an integer) followed by the message content. This structure allows for reliable message handling and
-    determining the length of the received message.
+    (an integer) followed by the message content. The sockets are non-blocking, so the bytes received from
+    a client are appended to its read buffer and every complete frame is extracted from it, a frame may
+    arrive in several reads and a read may contain several frames.
+
+    Outgoing messages are framed the same way and appended to the write queue of the client. The queue is
+    written immediately as far as the socket accepts it, the remaining bytes are written by the reactor once
+    epoll reports the socket as writable again. Sends can come from the game loop thread, the connections
+    are therefore protected by a mutex. A client that stops reading would make its queue grow without limit,
+    once the queue holds more than maxQueuedBytes the socket is shut down and the connection is closed by the
+    reactor like any other hang-up.
 
     When a client disconnects, the server closes the associated connection and removes the client from its
     list of connected clients.
 
-    The server uses exceptions to handle errors during socket creation, binding, and read/write operations.
+    The server uses exceptions to handle errors during socket creation, binding and listening.
 
     Thread Operation:
-    - The server creates a dedicated thread for each connected client to handle incoming and outgoing
-    messages asynchronously.
-    - Each client thread constantly monitors incoming messages and processes the received data according
-    to the application's needs.
+    - The reactor thread waits on epoll for new connections, readable and writable client sockets.
+    - epoll_wait uses a timeout so that the reactor notices a stop request even when no event occurs.
  */
 
 /** CONSTRUCTORS **/
@@ -38,9 +44,9 @@ int TCPServer::getSocketFileDescriptor() const {
 /** METHODS **/
 
 // Initialize the server with a specified port
-void TCPServer::initialize(short port) {
-    // Create socket
-    socketFileDescriptor = socket(AF_INET, SOCK_STREAM, 0);
+void TCPServer::initialize(uint16_t port) {
+    // Create a non-blocking socket, accept is called until it would block
+    socketFileDescriptor = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (socketFileDescriptor == -1) {
         throw TCPSocketCreationError("TCPServer: Error during socket creation");
     }
@@ -55,9 +61,22 @@ void TCPServer::initialize(short port) {
     }
 
     // Listen for incoming connections
-    if (listen(socketFileDescriptor, 5) == -1) {
+    if (listen(socketFileDescriptor, SOMAXCONN) == -1) {
         throw TCPSocketListenError("TCPServer: Error during listen");
     }
+
+    // Create the epoll instance and watch the listening socket
+    epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFileDescriptor == -1) {
+        throw TCPSocketCreationError("TCPServer: Error during epoll creation");
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLET;
+    event.data.fd = socketFileDescriptor;
+    if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, socketFileDescriptor, &event) == -1) {
+        throw TCPSocketCreationError("TCPServer: Error registering the server socket to epoll");
+    }
 }
 
 // Start the server
@@ -66,103 +85,260 @@ void TCPServer::start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &c
     clientAddressesMutexPtr = &clientAddressesMutex;
 
     stopRequested = false;
-    acceptConnections();
+    runEventLoop();
     clearResources();
     std::cout << "TCPServer: Server shutdown" << std::endl;
 }
 
-// Accept incoming client connections
-void TCPServer::acceptConnections() {
+// Dispatch the epoll events until a stop is requested
+void TCPServer::runEventLoop() {
     std::cout << "TCPServer: Handling incoming connections..." << std::endl;
 
+    // The listening socket is closed by stop(), keep its descriptor to recognize its events
+    const int listeningSocket = socketFileDescriptor;
+    std::array<epoll_event, maxEvents> events = {};
+
     while (!stopRequested.load()) {
-        int clientSocket = waitForConnection();
-        if (clientSocket != -1) {
-            // Create a new thread to handle messages from the client
-            std::jthread clientThread(&TCPServer::handleMessage, this, clientSocket);
-            clientThreads.push_back(std::move(clientThread));
+        int eventCount = epoll_wait(epollFileDescriptor, events.data(), maxEvents, eventTimeout);
+        if (eventCount == -1) {
+            if (errno == EINTR) continue;
+            perror("TCPServer: Error waiting for events");
+            break;
+        }
+
+        for (int i = 0; i < eventCount && !stopRequested.load(); i++) {
+            const int fileDescriptor = events[i].data.fd;
+            const uint32_t flags = events[i].events;
+
+            if (fileDescriptor == listeningSocket) {
+                acceptConnections();
+                continue;
+            }
+
+            // The socket is writable again, write the remaining queued frames
+            if (flags & EPOLLOUT) {
+                std::scoped_lock lock(connectionsMutex);
+                if (auto it = connections.find(fileDescriptor); it != connections.end()) {
+                    flushConnection(fileDescriptor, it->second);
+                }
+            }
+
+            // Read before handling a hang-up, the last frames sent by the client are still in the socket
+            if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                readFromConnection(fileDescriptor);
+            }
         }
     }
 
     std::cout << "TCPServer: Stopping connection handling" << std::endl;
 }
 
-// Wait for a connection from a client
-int TCPServer::waitForConnection() {
-    struct sockaddr_in clientAddr = {};
-    socklen_t clientLen = sizeof(clientAddr);
+// Accept every pending client connection
+void TCPServer::acceptConnections() {
+    while (!stopRequested.load()) {
+        struct sockaddr_in clientAddr = {};
+        socklen_t clientLen = sizeof(clientAddr);
+
+        int clientSocket = accept4(socketFileDescriptor, (struct sockaddr *) &clientAddr, &clientLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (clientSocket == -1) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) perror("TCPServer: Error accepting connection");
+            return;
+        }
 
-    std::cout << "TCPServer: Waiting for new client connection" << std::endl;
-    int clientSocket = accept(socketFileDescriptor, (struct sockaddr *) &clientAddr, &clientLen);
-    if (clientSocket == -1) return -1;
+        registerConnection(clientSocket, clientAddr);
+    }
+}
 
+// Register an accepted client, or reject it if the server is full
+void TCPServer::registerConnection(int clientSocket, const sockaddr_in &clientAddr) {
     // Check if the maximum number of clients has been reached, if so, close the connection
     clientAddressesMutexPtr->lock();
     if (clientAddressesPtr->size() >= maxClients) {
         clientAddressesMutexPtr->unlock();
 
-        send(clientSocket, "DISCONNECT");
+        // The socket is new and its send buffer empty, the frame is written at once
+        std::string frame = makeFrame("DISCONNECT");
+        ::send(clientSocket, frame.data(), frame.size(), MSG_NOSIGNAL);
         close(clientSocket);
         std::cout << "TCPServer: Maximum number of clients reached" << std::endl;
-        return -1;
+        return;
     }
     clientAddressesMutexPtr->unlock();
 
     std::string clientIp = inet_ntoa(clientAddr.sin_addr);
     std::cout << "TCPServer: New client connected from " << clientIp << ":" << ntohs(clientAddr.sin_port) << std::endl;
 
+    // Watch the client for reads, writes and hang-ups
+    connectionsMutex.lock();
+    connections.try_emplace(clientSocket);
+    connectionsMutex.unlock();
+
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.fd = clientSocket;
+    if (epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, clientSocket, &event) == -1) {
+        perror("TCPServer: Error registering client socket to epoll");
+        connectionsMutex.lock();
+        connections.erase(clientSocket);
+        connectionsMutex.unlock();
+        close(clientSocket);
+        return;
+    }
+
     // Add the client to the list of connected clients
     clientAddressesMutexPtr->lock();
     clientAddressesPtr->insert({clientSocket, clientAddr});
     clientAddressesMutexPtr->unlock();
     std::cout << "TCPServer: New client connected with ID: " << clientSocket << std::endl;
 
-    // Notify the mediator of the new client connection
+    // Notify the mediator of the new client connection, the game loop will send it the game properties
     Mediator::handleClientConnect(clientSocket);
-    sendGameProperties(clientSocket);
-    relayClientConnection(clientSocket);
-
-    return clientSocket;
 }
 
-// Handle messages from a client
-void TCPServer::handleMessage(int clientSocket) {
+// Read the available bytes of a client and handle its complete frames
+void TCPServer::readFromConnection(int clientSocket) {
+    std::vector<std::string> messages;
     bool clientConnected = true;
-    while (clientConnected) {
-        try {
-            // Check if the client is still connected (if the clientFileDescriptor is still in the list of connected clients)
-            clientAddressesMutexPtr->lock();
-            clientConnected = clientAddressesPtr->contains(clientSocket);
-            clientAddressesMutexPtr->unlock();
 
-            if (clientConnected) {
-                std::cout << "TCPServer: Waiting for message from client " << clientSocket << std::endl;
-                std::string message = receive(clientSocket);
-
-                if (message == "DISCONNECT") {
-                    std::cout << "TCPServer: Client " << clientSocket << " asked to disconnect" << std::endl;
-                    clientConnected = false;
-                } else if (!message.empty()) {
-                    // Handle received message
-                    Mediator::handleMessages(0, message, clientSocket);
-                } else {
-                    std::cout << "TCPServer: Client " << clientSocket << " disconnected" << std::endl;
-                    clientConnected = false;
-                }
-            }
-        } catch (const TCPSocketReceiveError& e) {
-            std::cerr << e.what() << std::endl;
-            // Exit the loop on error
+    connectionsMutex.lock();
+    auto it = connections.find(clientSocket);
+    if (it == connections.end()) {
+        connectionsMutex.unlock();
+        return;
+    }
+
+    // Edge-triggered, read until the socket would block or the next event may never come
+    std::string &buffer = it->second.readBuffer;
+    std::array<char, 4096> chunk = {};
+    while (true) {
+        ssize_t bytesRead = recv(clientSocket, chunk.data(), chunk.size(), 0);
+        if (bytesRead > 0) {
+            buffer.append(chunk.data(), bytesRead);
+            continue;
+        }
+        if (bytesRead == -1 && errno == EINTR) continue;
+        if (bytesRead == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+
+        // Connection closed by the client or error
+        if (bytesRead == -1) perror("TCPServer: Error receiving message");
+        clientConnected = false;
+        break;
+    }
+
+    if (!extractFrames(buffer, messages)) {
+        std::cerr << "TCPServer: Invalid frame size received from client " << clientSocket << std::endl;
+        clientConnected = false;
+    }
+    connectionsMutex.unlock();
+
+    // Handle the messages without holding the lock, the mediator may send messages back
+    for (const std::string &message: messages) {
+        if (message == "DISCONNECT") {
+            std::cout << "TCPServer: Client " << clientSocket << " asked to disconnect" << std::endl;
             clientConnected = false;
+            break;
+        }
+        if (!message.empty()) Mediator::handleMessages(0, message, clientSocket);
+    }
+
+    if (!clientConnected) closeConnection(clientSocket);
+}
+
+// Write the queued frames of a client until the socket would block
+bool TCPServer::flushConnection(int clientSocket, Connection &connection) const {
+    while (!connection.writeQueue.empty()) {
+        const std::string &frame = connection.writeQueue.front();
+        ssize_t bytesSent = ::send(clientSocket, frame.data() + connection.writeOffset, frame.size() - connection.writeOffset, MSG_NOSIGNAL);
+        if (bytesSent == -1) {
+            if (errno == EINTR) continue;
+            // The rest is written when epoll reports the socket as writable
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+            perror("TCPServer: Error sending message");
+            return false;
+        }
+
+        connection.writeOffset += bytesSent;
+        connection.queuedBytes -= bytesSent;
+        if (connection.writeOffset == frame.size()) {
+            connection.writeQueue.pop_front();
+            connection.writeOffset = 0;
+        }
+    }
+
+    return true;
+}
+
+// Queue a frame for a client, or shut down its connection if the client does not read its frames anymore
+bool TCPServer::queueFrame(int clientSocket, Connection &connection, const std::string &frame) const {
+    if (connection.isOverflowed) return false;
+
+    if (connection.queuedBytes + frame.size() > maxQueuedBytes) {
+        std::cerr << "TCPServer: Write queue of client " << clientSocket << " exceeds " << maxQueuedBytes << " bytes, disconnecting it" << std::endl;
+        connection.isOverflowed = true;
+        connection.writeQueue.clear();
+        connection.writeOffset = 0;
+        connection.queuedBytes = 0;
+
+        // The game loop cannot close the connection under the lock, epoll reports the hang-up to the reactor which closes it
+        shutdown(clientSocket, SHUT_RDWR);
+        return false;
+    }
+
+    connection.writeQueue.push_back(frame);
+    connection.queuedBytes += frame.size();
+    return flushConnection(clientSocket, connection);
+}
+
+// Extract the complete frames of a read buffer
+bool TCPServer::extractFrames(std::string &buffer, std::vector<std::string> &messages) {
+    size_t offset = 0;
+    bool valid = true;
+
+    while (buffer.size() - offset >= sizeof(int)) {
+        int messageSize;
+        memcpy(&messageSize, buffer.data() + offset, sizeof(int));
+        if (messageSize < 0 || static_cast<size_t>(messageSize) > maxFrameSize) {
+            valid = false;
+            break;
         }
+
+        // The frame is not complete yet
+        if (buffer.size() - offset - sizeof(int) < static_cast<size_t>(messageSize)) break;
+
+        messages.emplace_back(buffer, offset + sizeof(int), messageSize);
+        offset += sizeof(int) + messageSize;
     }
 
+    buffer.erase(0, offset);
+    return valid;
+}
+
+// Build a frame made of the message size followed by the message content
+std::string TCPServer::makeFrame(const std::string &message) {
+    auto messageSize = static_cast<int>(message.length());
+
+    std::string frame(sizeof(int) + message.length(), '\0');
+    memcpy(frame.data(), &messageSize, sizeof(int));
+    memcpy(frame.data() + sizeof(int), message.data(), message.length());
+
+    return frame;
+}
+
+// Close a client connection
+void TCPServer::closeConnection(int clientSocket) {
+    connectionsMutex.lock();
+    bool registered = connections.erase(clientSocket) > 0;
+    connectionsMutex.unlock();
+    if (!registered) return;
+
     std::cout << "TCPServer: Client " << clientSocket << " disconnected" << std::endl;
 
     // Notify the mediator of the client disconnection
     Mediator::handleClientDisconnect(clientSocket);
     relayClientDisconnection(clientSocket);
 
+    // Closing the socket also removes it from the epoll instance
     close(clientSocket);
 
     // Remove the client from the list of connected clients
@@ -177,83 +353,29 @@ bool TCPServer::send(int clientSocket, const std::string &message) const {
     std::cout << "TCPServer: Sending message: " << message << " (" << message.length() << " bytes) to client " << clientSocket << std::endl;
 #endif
 
-    // First, send the size of the message
-    auto messageSize = static_cast<int>(message.length()); // Message size including null terminator
-    if (::send(clientSocket, &messageSize, sizeof(int), 0) == -1) {
-        perror("TCPServer: Error sending message size");
-        return false;
-    }
+    std::scoped_lock lock(connectionsMutex);
+    auto it = connections.find(clientSocket);
+    if (it == connections.end()) return false;
 
-    // Then, send the message itself
-    const char *messagePtr = message.c_str();
-    ssize_t totalBytesSent = 0;
-    while (totalBytesSent < messageSize) {
-        ssize_t bytesSent = ::send(clientSocket, messagePtr + totalBytesSent, messageSize - totalBytesSent, 0);
-        if (bytesSent == -1) {
-            perror("TCPServer: Error sending message");
-            return false;
-        }
-        totalBytesSent += bytesSent;
-    }
-
-    return true;
+    return queueFrame(clientSocket, it->second, makeFrame(message));
 }
 
 // Broadcast a message to all connected clients
 bool TCPServer::broadcast(const std::string &message, int socketIgnored) const {
-    clientAddressesMutexPtr->lock();
+    std::scoped_lock lock(connectionsMutex);
 #ifdef DEVELOPMENT_MODE
-    std::cout << "TCPServer: Broadcasting message: " << message << " (" << message.length() << " bytes) to " << clientAddressesPtr->size() << " clients" << std::endl;
+    std::cout << "TCPServer: Broadcasting message: " << message << " (" << message.length() << " bytes) to " << connections.size() << " clients" << std::endl;
 #endif
 
-    auto send_successful = std::ranges::all_of(*clientAddressesPtr, [&](const auto& client) {
-        if (client.first == socketIgnored) return true;
-        return send(client.first, message);
-    });
-
-    clientAddressesMutexPtr->unlock();
-    return send_successful;
-}
-
-// Receive a message from a client
-std::string TCPServer::receive(int clientSocket) const {
-    char sizeBuffer[sizeof(int)];
-    ssize_t bytesRead;
-
-    // Receive the size of the message
-    bytesRead = recv(clientSocket, sizeBuffer, sizeof(sizeBuffer), MSG_WAITALL);
-    if (bytesRead <= 0) {
-        if (bytesRead == 0) {
-            // No data available, return empty string
-            return "";
-        } else {
-            // Error or connection closed by client
-            throw TCPSocketReceiveError("TCPServer: Error receiving message size, client disconnected");
-        }
-    }
-
-    int messageSize;
-    memcpy(&messageSize, sizeBuffer, sizeof(int));
-
-    std::string receivedData;
-    receivedData.resize(messageSize);
-
-    size_t totalBytesReceived = 0;
-    while (totalBytesReceived < static_cast<size_t>(messageSize)) {
-        bytesRead = recv(clientSocket, &receivedData[totalBytesReceived], messageSize - totalBytesReceived, 0);
-        if (bytesRead <= 0) {
-            if (bytesRead == 0) {
-                // No data available, return empty string
-                return "";
-            } else {
-                // Error or connection closed by client
-                throw TCPSocketReceiveError("TCPServer: Error receiving message data, client disconnected");
-            }
-        }
-        totalBytesReceived += bytesRead;
+    // The frame is built once and shared by all the write queues
+    const std::string frame = makeFrame(message);
+    bool send_successful = true;
+    for (auto &[clientSocket, connection]: connections) {
+        if (clientSocket == socketIgnored) continue;
+        send_successful = queueFrame(clientSocket, connection, frame) && send_successful;
     }
 
-    return receivedData;
+    return send_successful;
 }
 
 bool TCPServer::sendGameProperties(int clientSocket) const {
@@ -318,7 +440,7 @@ void TCPServer::stop() {
         }
     }
 
-    // Stop message handling
+    // Stop the event loop, it notices the request at the latest after the epoll timeout
     stopRequested = true;
     if (socketFileDescriptor != -1) {
         ::shutdown(socketFileDescriptor, SHUT_RDWR);
@@ -330,25 +452,26 @@ void TCPServer::stop() {
 }
 
 void TCPServer::clearResources() {
-    // Close all client connections (clientAddressPtr)
-    clientAddressesMutexPtr->lock();
-    for (const auto& [clientSocket, _]: *clientAddressesPtr) {
+    std::cout << "TCPServer: Closing all client connections..." << std::endl;
+
+    // Close all client connections
+    connectionsMutex.lock();
+    for (const auto &[clientSocket, _]: connections) {
         ::shutdown(clientSocket, SHUT_RDWR);
         close(clientSocket);
     }
+    std::cout << "TCPServer: " << connections.size() << " client connections closed" << std::endl;
+    connections.clear();
+    connectionsMutex.unlock();
+
+    clientAddressesMutexPtr->lock();
     clientAddressesPtr->clear();
     clientAddressesMutexPtr->unlock();
 
-    std::cout << "TCPServer: Closing all client connections..." << std::endl;
-    for (std::jthread& clientThread: clientThreads) {
-        if (clientThread.joinable()) {
-            clientThread.request_stop();
-            clientThread.join();
-        }
+    if (epollFileDescriptor != -1) {
+        close(epollFileDescriptor);
+        epollFileDescriptor = -1;
     }
-    std::cout << "TCPServer: " << clientThreads.size() << " client threads stopped" << std::endl;
-
-    clientThreads.clear();
 }
 
-#endif // !_WIN32
\ No newline at end of file
+#endif // !_WIN32
@@ -80,7 +80,7 @@ bool UDPClient::send(const std::string &message) const {
 }
 
 std::string UDPClient::receive(int timeoutMilliseconds) const {
-    char buffer[1024];
+    char buffer[MAX_DATAGRAM_SIZE];
     socklen_t serverLen = sizeof(sockaddr_in);
 
     fd_set readSet;
@@ -108,8 +108,7 @@ std::string UDPClient::receive(int timeoutMilliseconds) const {
             return "";
         }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+        return {buffer, static_cast<size_t>(bytesRead)}; // Binary packets may contain null bytes
     }
 }
 
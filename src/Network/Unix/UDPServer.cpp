@@ -16,7 +16,7 @@ int UDPServer::getSocketFileDescriptor() const {
 
 /** METHODS **/
 
-void UDPServer::initialize(short port) {
+void UDPServer::initialize(uint16_t port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_DGRAM, 0);
     if (socketFileDescriptor == -1) {
@@ -31,11 +31,22 @@ void UDPServer::initialize(short port) {
     if (bind(socketFileDescriptor, (struct sockaddr *) &serverAddr, sizeof(serverAddr)) == -1) {
         throw UDPSocketBindError("UDPServer: Error during bind");
     }
+
+    // Point each receive header to its own datagram buffer and sender address
+    receiveBuffer.assign(batchSize * MAX_DATAGRAM_SIZE, 0);
+    for (unsigned int i = 0; i < batchSize; i++) {
+        receiveVectors[i] = {receiveBuffer.data() + i * MAX_DATAGRAM_SIZE, MAX_DATAGRAM_SIZE};
+        receiveHeaders[i].msg_hdr.msg_name = &receiveAddresses[i];
+        receiveHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        receiveHeaders[i].msg_hdr.msg_iov = &receiveVectors[i];
+        receiveHeaders[i].msg_hdr.msg_iovlen = 1;
+    }
 }
 
 void UDPServer::start(std::map<int, sockaddr_in> &clientAddresses, std::mutex &clientAddressesMutex) {
     clientAddressesPtr = &clientAddresses;
     clientAddressesMutexPtr = &clientAddressesMutex;
+    clientIDs.clear();
 
     stopRequested = false;
     handleMessage();
@@ -60,24 +71,41 @@ bool UDPServer::broadcast(const std::string &message, int socketIgnored) const {
     std::cout << "UDPServer: Broadcasting message: " << message << " (" << message.length() << " bytes)" << std::endl;
 #endif
 
+    // Copy the destinations so that the lock is not held during the system call
+    std::vector<sockaddr_in> destinations;
     clientAddressesMutexPtr->lock();
+    destinations.reserve(clientAddressesPtr->size());
     for (const auto& [id, address] : *clientAddressesPtr) {
-        if (id == socketIgnored) continue;
-        if (!send(address, message)) {
-            clientAddressesMutexPtr->unlock();
+        if (id != socketIgnored) destinations.push_back(address);
+    }
+    clientAddressesMutexPtr->unlock();
 
+    // Every header points to the same payload, only the destination changes
+    iovec payload = {const_cast<char *>(message.data()), message.length()};
+    std::vector<mmsghdr> headers(destinations.size());
+    for (size_t i = 0; i < destinations.size(); i++) {
+        headers[i].msg_hdr.msg_name = &destinations[i];
+        headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        headers[i].msg_hdr.msg_iov = &payload;
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // sendmmsg may send only a part of the datagrams, send the rest
+    size_t sentCount = 0;
+    while (sentCount < headers.size()) {
+        int sent = sendmmsg(socketFileDescriptor, headers.data() + sentCount, headers.size() - sentCount, 0);
+        if (sent == -1) {
+            if (errno == EINTR) continue;
+            perror("UDPServer: Error broadcasting message");
             return false;
         }
+        sentCount += sent;
     }
-    clientAddressesMutexPtr->unlock();
 
-    return true; // Placeholder
+    return true;
 }
 
-std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMilliseconds) const {
-    char buffer[1024];
-    socklen_t clientLen = sizeof(clientAddress);
-
+unsigned int UDPServer::receiveBatch(int timeoutMilliseconds) {
     fd_set readSet;
     FD_ZERO(&readSet);
     FD_SET(socketFileDescriptor, &readSet);
@@ -91,82 +119,93 @@ std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMillisecon
     int ready = select(socketFileDescriptor + 1, &readSet, nullptr, nullptr, &timeout);
     if (ready == -1) {
         perror("UDPServer: Error in select()");
-        return "";
+        return 0;
     } else if (ready == 0) {
-        // No data available within the specified timeout, return an empty string
-        return "";
-    } else {
-        // Data is available for reading, receive the data
-        ssize_t bytesRead = recvfrom(socketFileDescriptor, buffer, sizeof(buffer), 0, (sockaddr*)&clientAddress, &clientLen);
-        if (bytesRead == -1) {
-            if(!stopRequested) perror("UDPServer: Error receiving message");
-            return "";
+        // No data available within the specified timeout
+        return 0;
+    }
+
+    // The headers are modified by the kernel, reset the lengths before each call
+    for (unsigned int i = 0; i < batchSize; i++) {
+        receiveHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        receiveHeaders[i].msg_len = 0;
+    }
+
+    // Data is available for reading, receive every pending datagram without blocking
+    int received = recvmmsg(socketFileDescriptor, receiveHeaders.data(), batchSize, MSG_DONTWAIT, nullptr);
+    if (received == -1) {
+        if (!stopRequested && errno != EAGAIN && errno != EWOULDBLOCK) perror("UDPServer: Error receiving messages");
+        return 0;
+    }
+
+    return static_cast<unsigned int>(received);
+}
+
+int UDPServer::findClientID(const sockaddr_in &clientAddress) {
+    auto sameAddress = [&clientAddress](const sockaddr_in &address) {
+        return address.sin_addr.s_addr == clientAddress.sin_addr.s_addr && address.sin_port == clientAddress.sin_port;
+    };
+
+    // The index can be stale since the TCP server adds and removes clients, check it against the map
+    const uint64_t key = addressKey(clientAddress);
+    if (auto it = clientIDs.find(key); it != clientIDs.end()) {
+        if (auto client = clientAddressesPtr->find(it->second); client != clientAddressesPtr->end() && sameAddress(client->second)) {
+            return it->second;
         }
+        clientIDs.erase(it);
+    }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+    // Unknown address, search it once and index it
+    for (const auto& [id, address] : *clientAddressesPtr) {
+        if (sameAddress(address)) {
+            clientIDs[key] = id;
+            return id;
+        }
     }
+
+    return -1;
+}
+
+uint64_t UDPServer::addressKey(const sockaddr_in &address) {
+    return (static_cast<uint64_t>(address.sin_addr.s_addr) << 16) | address.sin_port;
 }
 
 void UDPServer::handleMessage() {
     std::cout << "UDPServer: Handling incoming messages..." << std::endl;
 
+    std::array<int, batchSize> senders = {};
     while (!stopRequested && socketFileDescriptor != -1) {
-        // Receive message with timeout
-        struct sockaddr_in clientAddress;
-        std::string message = receive(clientAddress, 200); // 1 second timeout
-
-        // Handle the received message
-        if (!message.empty()) {
-            // Identify the client with the address (find)
+        // Wait for messages with timeout, then drain the socket while full batches are received
+        unsigned int received = receiveBatch(200);
+        while (received > 0) {
+            // Identify the clients with their addresses under a single lock
             clientAddressesMutexPtr->lock();
-            int clientID = -1;
-            for (const auto& [id, address] : *clientAddressesPtr) {
-                if (address.sin_addr.s_addr == clientAddress.sin_addr.s_addr && address.sin_port == clientAddress.sin_port) {
-                    clientID = id;
-                    break;
-                }
+            for (unsigned int i = 0; i < received; i++) {
+                senders[i] = findClientID(receiveAddresses[i]);
             }
             clientAddressesMutexPtr->unlock();
 
-            if (clientID != -1) {
-                // Handle received message
-                Mediator::handleMessages(1, message, clientID);
-            } else {
-            #ifdef DEVELOPMENT_MODE
-                std::cout << "UDPServer: Received message: " << message << " from unknown client" << std::endl;
-            #endif
+            for (unsigned int i = 0; i < received; i++) {
+                std::string message(receiveBuffer.data() + i * MAX_DATAGRAM_SIZE, receiveHeaders[i].msg_len); // Binary packets may contain null bytes
+                if (message.empty()) continue;
+
+                if (senders[i] != -1) {
+                    // Handle received message
+                    Mediator::handleMessages(1, message, senders[i]);
+                } else {
+                #ifdef DEVELOPMENT_MODE
+                    std::cout << "UDPServer: Received message: " << message << " from unknown client" << std::endl;
+                #endif
+                }
             }
+
+            received = (received == batchSize && !stopRequested) ? receiveBatch(0) : 0;
         }
     }
 
     std::cout << "UDPServer: Stopping message handling" << std::endl;
 }
 
-bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const {
-    using json = nlohmann::json;
-
-    // Add each player's position and movement to the message
-    message["players"] = json::array();
-
-    for (const Player &player : Mediator::getAlivePlayers()) {
-        json playerData;
-
-        int playerID = player.getPlayerID();
-        if (playerID == -1) playerID = 0; // The server player has ID 0
-        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
-
-        playerData["playerID"] = playerID;
-        playerData["x"] = player.getX();
-        playerData["y"] = player.getY();
-        playerData["moveX"] = player.getMoveX();
-        playerData["moveY"] = player.getMoveY();
-        message["players"].push_back(playerData);
-    }
-
-    return send(address, message.dump());
-}
-
 // Stop the server
 void UDPServer::stop() {
     stopRequested = true;
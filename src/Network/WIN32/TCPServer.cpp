@@ -38,7 +38,7 @@ SOCKET TCPServer::getSocketFileDescriptor() const {
 /** METHODS **/
 
 // Initialize the server with a specified port
-void TCPServer::initialize(short port) {
+void TCPServer::initialize(uint16_t port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_STREAM, 0);
     if (socketFileDescriptor == INVALID_SOCKET) {
@@ -118,10 +118,8 @@ SOCKET TCPServer::waitForConnection() {
     clientAddressesMutexPtr->unlock();
     std::cout << "TCPServer: New client connected with ID: " << clientSocket << std::endl;
 
-    // Notify the mediator of the new client connection
+    // Notify the mediator of the new client connection, the game loop will send it the game properties
     Mediator::handleClientConnect(static_cast<int>(clientSocket));
-    sendGameProperties(clientSocket);
-    relayClientConnection(clientSocket);
 
     return clientSocket;
 }
@@ -16,7 +16,7 @@ SOCKET UDPServer::getSocketFileDescriptor() const {
 
 /** METHODS **/
 
-void UDPServer::initialize(short port) {
+void UDPServer::initialize(uint16_t port) {
     // Create socket
     socketFileDescriptor = socket(AF_INET, SOCK_DGRAM, 0);
     if (socketFileDescriptor == INVALID_SOCKET) {
@@ -75,7 +75,7 @@ bool UDPServer::broadcast(const std::string &message, SOCKET socketIgnored) cons
 }
 
 std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMilliseconds) const {
-    char buffer[1024];
+    char buffer[MAX_DATAGRAM_SIZE];
     socklen_t clientLen = sizeof(clientAddress);
 
     fd_set readSet;
@@ -103,8 +103,7 @@ std::string UDPServer::receive(sockaddr_in& clientAddress, int timeoutMillisecon
             return "";
         }
 
-        buffer[bytesRead] = '\0'; // Null-terminate the received data
-        return buffer;
+        return {buffer, static_cast<size_t>(bytesRead)}; // Binary packets may contain null bytes
     }
 }
 
@@ -143,31 +142,6 @@ void UDPServer::handleMessage() {
     std::cout << "UDPServer: Stopping message handling" << std::endl;
 }
 
-bool UDPServer::sendSyncCorrection(int clientSocket, sockaddr_in address, nlohmann::json &message) const {
-    using json = nlohmann::json;
-
-    // Add each player's position and movement to the message
-    message["players"] = json::array();
-
-    for (const Player &player : Mediator::getAlivePlayers()) {
-        json playerData;
-
-        int playerID = player.getPlayerID();
-        if (playerID == -1) playerID = 0; // The server player has ID 0
-        if (playerID == clientSocket) playerID = -1; // The client itself has ID -1
-
-        playerData["playerID"] = playerID;
-        playerData["x"] = player.getX();
-        playerData["y"] = player.getY();
-        playerData["moveX"] = player.getMoveX();
-        playerData["moveY"] = player.getMoveY();
-        message["players"].push_back(playerData);
-    }
-
-    std::cout << message.dump() << std::endl;
-    return send(address, message.dump());
-}
-
 // Stop the server
 void UDPServer::stop() {
     stopRequested = true;
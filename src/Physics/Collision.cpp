@@ -1,5 +1,13 @@
 #include "../../include/Physics/Collision.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PLAY_TOGETHER_SSE2
+#endif
+#include <bit>
+
 /**
  * @file CollisionManager.cpp
  * @brief Implements functions for collision detection and correction.
@@ -13,34 +21,94 @@ bool checkAABBCollision(const SDL_FRect &a, const SDL_FRect &b) {
             a.y + a.h > b.y);
 }
 
+/**
+ * @brief Append the index of each bit set in a lane mask.
+ * @param mask The lanes of a block colliding with the query.
+ * @param first The index of the first lane of the block.
+ * @param[out] result The indices of the colliding rectangles.
+ */
+[[maybe_unused]] static void appendLanes(unsigned int mask, size_t first, std::vector<size_t> &result) {
+    while (mask != 0) {
+        result.push_back(first + static_cast<size_t>(std::countr_zero(mask)));
+        mask &= mask - 1;
+    }
+}
+
+void checkAABBCollisions(const SDL_FRect &query, const float *x, const float *y, const float *w, const float *h, size_t count, std::vector<size_t> &result) {
+    result.clear();
+    size_t i = 0;
+
+    // Same comparisons as checkAABBCollision(), the sums are rounded the same way in every lane
+#if defined(__AVX2__)
+    const __m256 query_min_x = _mm256_set1_ps(query.x);
+    const __m256 query_max_x = _mm256_set1_ps(query.x + query.w);
+    const __m256 query_min_y = _mm256_set1_ps(query.y);
+    const __m256 query_max_y = _mm256_set1_ps(query.y + query.h);
+    for (; i + 8 <= count; i += 8) {
+        __m256 box_x = _mm256_loadu_ps(x + i);
+        __m256 box_y = _mm256_loadu_ps(y + i);
+        __m256 overlap_x = _mm256_and_ps(_mm256_cmp_ps(query_min_x, _mm256_add_ps(box_x, _mm256_loadu_ps(w + i)), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(query_max_x, box_x, _CMP_GT_OQ));
+        __m256 overlap_y = _mm256_and_ps(_mm256_cmp_ps(query_min_y, _mm256_add_ps(box_y, _mm256_loadu_ps(h + i)), _CMP_LT_OQ),
+                                         _mm256_cmp_ps(query_max_y, box_y, _CMP_GT_OQ));
+        appendLanes(static_cast<unsigned int>(_mm256_movemask_ps(_mm256_and_ps(overlap_x, overlap_y))), i, result);
+    }
+#elif defined(PLAY_TOGETHER_SSE2)
+    const __m128 query_min_x = _mm_set1_ps(query.x);
+    const __m128 query_max_x = _mm_set1_ps(query.x + query.w);
+    const __m128 query_min_y = _mm_set1_ps(query.y);
+    const __m128 query_max_y = _mm_set1_ps(query.y + query.h);
+    for (; i + 4 <= count; i += 4) {
+        __m128 box_x = _mm_loadu_ps(x + i);
+        __m128 box_y = _mm_loadu_ps(y + i);
+        __m128 overlap_x = _mm_and_ps(_mm_cmplt_ps(query_min_x, _mm_add_ps(box_x, _mm_loadu_ps(w + i))),
+                                      _mm_cmpgt_ps(query_max_x, box_x));
+        __m128 overlap_y = _mm_and_ps(_mm_cmplt_ps(query_min_y, _mm_add_ps(box_y, _mm_loadu_ps(h + i))),
+                                      _mm_cmpgt_ps(query_max_y, box_y));
+        appendLanes(static_cast<unsigned int>(_mm_movemask_ps(_mm_and_ps(overlap_x, overlap_y))), i, result);
+    }
+#endif
+
+    // Remaining rectangles, or all of them without SIMD support
+    for (; i < count; i++) {
+        if (checkAABBCollision(query, {x[i], y[i], w[i], h[i]})) result.push_back(i);
+    }
+}
+
 bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &obstacle) {
     // Check for convexity of the obstacle
-    if (!obstacle.isConvex()) {
-        printf("The obstacle is not convex\n");
+    if (!obstacle.isConvex() || playerVertices.empty()) {
         return false;
     }
 
-    // Potential separation axes (normals to the sides of the rectangle)
-    std::vector<Point> axes = {
-            {1, 0},
-            {0, 1}
-    };
-
-    // Add axes perpendicular to the sides of the polygon
-    for (size_t i = 0; i < obstacle.getVertices().size(); ++i) {
-        std::vector<Point> vertices = obstacle.getVertices();
-        const Point &vertex1 = vertices[i];
-        const Point &vertex2 = vertices[(i + 1) % vertices.size()];
-
-        Point edge = {vertex2.x - vertex1.x, vertex2.y - vertex1.y};
-        Point axis = {-edge.y, edge.x};
-        axes.push_back(axis);
+    // Potential separation axes (normals to the sides of the rectangle), their projections are the bounding box
+    float playerMinX = playerVertices[0].x;
+    float playerMaxX = playerVertices[0].x;
+    float playerMinY = playerVertices[0].y;
+    float playerMaxY = playerVertices[0].y;
+    for (const Point &vertex: playerVertices) {
+        playerMinX = std::min(playerMinX, vertex.x);
+        playerMaxX = std::max(playerMaxX, vertex.x);
+        playerMinY = std::min(playerMinY, vertex.y);
+        playerMaxY = std::max(playerMaxY, vertex.y);
+    }
+
+    const SDL_FRect &boundingBox = obstacle.getBoundingBox();
+    if (playerMaxX < boundingBox.x || boundingBox.x + boundingBox.w < playerMinX
+        || playerMaxY < boundingBox.y || boundingBox.y + boundingBox.h < playerMinY) {
+        return false; // No collision detected
     }
 
-    for (Point axis: axes) {
-        // Project the rectangle and the polygon onto the axis
-        auto playerProjectionMin = static_cast<float>(std::numeric_limits<int>::max());
-        auto playerProjectionMax = static_cast<float>(std::numeric_limits<int>::min());
+    // Axes perpendicular to the sides of the polygon, the projections of the polygon are baked
+    const std::vector<Point> &axes = obstacle.getEdgeNormals();
+    const std::vector<Projection> &projections = obstacle.getProjections();
+
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const Point &axis = axes[i];
+
+        // Project the player onto the axis
+        float playerProjectionMin = playerVertices[0].x * axis.x + playerVertices[0].y * axis.y;
+        float playerProjectionMax = playerProjectionMin;
 
         for (const Point &vertex: playerVertices) {
             float projection = vertex.x * axis.x + vertex.y * axis.y;
@@ -48,17 +116,8 @@ bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &
             playerProjectionMax = std::max(playerProjectionMax, projection);
         }
 
-        auto obstacleProjectionMin = static_cast<float>(std::numeric_limits<int>::max());
-        auto obstacleProjectionMax = static_cast<float>(std::numeric_limits<int>::min());
-
-        for (const Point &vertex: obstacle.getVertices()) {
-            float projection = vertex.x * axis.x + vertex.y * axis.y;
-            obstacleProjectionMin = std::min(obstacleProjectionMin, projection);
-            obstacleProjectionMax = std::max(obstacleProjectionMax, projection);
-        }
-
         // Check for separation on the axis
-        if (playerProjectionMax < obstacleProjectionMin || obstacleProjectionMax < playerProjectionMin) {
+        if (playerProjectionMax < projections[i].min || projections[i].max < playerProjectionMin) {
             return false; // No collision detected
         }
     }
@@ -66,346 +125,156 @@ bool checkSATCollision(const std::vector<Point> &playerVertices, const Polygon &
     return true; // Collision detected
 }
 
-static bool checkAABBCollisionTunnelingOnXAxis(Player *player, const SDL_FRect &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveX();
-    bool direction = player->getDirectionX() == 1;
-
-    SDL_FRect playerBoundingBox = {x + move, y, w, h};
-
-    // Direction on x-axis is right
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move -= w;
-            playerBoundingBox = {x + move, y, w, h};
-        }
-    }
-    // Direction on x-axis is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move += w;
-            playerBoundingBox = {x + move, y, w, h};
-        }
+bool checkSATCollision(const SDL_FRect &rect, const Polygon &obstacle) {
+    // Check for convexity of the obstacle
+    if (!obstacle.isConvex()) {
+        return false;
     }
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveX(move); // Set moveX inside the collision
-        return true;
-    } else {
-        return false;
+    // Separation on the axes of the rectangle is an AABB test against the bounding box of the polygon
+    const SDL_FRect &boundingBox = obstacle.getBoundingBox();
+    if (rect.x + rect.w < boundingBox.x || boundingBox.x + boundingBox.w < rect.x
+        || rect.y + rect.h < boundingBox.y || boundingBox.y + boundingBox.h < rect.y) {
+        return false; // No collision detected
     }
-}
 
-static bool checkAABBCollisionTunnelingOnYAxis(Player *player, const SDL_FRect &obstacle) {
+    // Axes perpendicular to the sides of the polygon, the projections of the polygon are baked
+    const std::vector<Point> &axes = obstacle.getEdgeNormals();
+    const std::vector<Projection> &projections = obstacle.getProjections();
 
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveY();
-    bool direction = player->getDirectionY() == 1;
+    for (size_t i = 0; i < axes.size(); ++i) {
+        const Point &axis = axes[i];
 
-    SDL_FRect playerBoundingBox = {x, y + move, w, h};
+        // The extreme corners of the rectangle are reached on each coordinate separately
+        float left = rect.x * axis.x;
+        float right = (rect.x + rect.w) * axis.x;
+        float top = rect.y * axis.y;
+        float bottom = (rect.y + rect.h) * axis.y;
+        float rectProjectionMin = std::min(left, right) + std::min(top, bottom);
+        float rectProjectionMax = std::max(left, right) + std::max(top, bottom);
 
-    // Direction on y-axis is down
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move -= h;
-            playerBoundingBox = {x, y + move, w, h};
-        }
-    }
-    // Direction on y-axis is up
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            move += h;
-            playerBoundingBox = {x, y + move, w, h};
+        // Check for separation on the axis
+        if (rectProjectionMax < projections[i].min || projections[i].max < rectProjectionMin) {
+            return false; // No collision detected
         }
     }
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveY(move); // Set moveY inside the collision
-        return true;
-    } else {
-        return false;
-    }
+    return true; // Collision detected
 }
 
-static bool checkAABBCollisionTunnelingOnBothAxis(Player *player, const SDL_FRect &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float moveX = player->getMoveX();
-    float moveY = player->getMoveY();
-    bool directionX = player->getDirectionX() == 1; // True for right, false for left
+/**
+ * @brief Intersect the time interval during which a moving interval overlaps a fixed one with the current sweep.
+ * @param movingMin The smallest projection of the moving shape at the start of the move.
+ * @param movingMax The largest projection of the moving shape at the start of the move.
+ * @param velocity The projection of the move.
+ * @param fixedMin The smallest projection of the fixed shape.
+ * @param fixedMax The largest projection of the fixed shape.
+ * @param axis The axis of the projections, kept as the normal if it delays the contact the most.
+ * @param[out] sweep The sweep narrowed to the overlapping interval.
+ */
+static void sweepOnAxis(float movingMin, float movingMax, float velocity, float fixedMin, float fixedMax, const Point &axis, SweepResult &sweep) {
+    // Without relative motion, the shapes overlap on this axis during the whole move or never
+    if (velocity == 0) {
+        if (movingMax <= fixedMin || fixedMax <= movingMin) sweep.hit = false;
+        return;
+    }
 
-    float addX; // Value that will be added to moveX at each iteration
-    float addY; // Value that will be added to moveY at each iteration
-    float add = w < h ? w : h; // Select the player's shortest side
+    float entry = (velocity > 0 ? fixedMin - movingMax : fixedMax - movingMin) / velocity;
+    float exit = (velocity > 0 ? fixedMax - movingMin : fixedMin - movingMax) / velocity;
 
-    // Create a ratio between moveX and moveY so they increment proportionally
-    float ratio = std::abs(moveX / moveY);
-    if (ratio > 1) {
-        addX = add;
-        addY = add / ratio;
+    // The latest entry gives the contact normal, pointing against the move
+    if (entry > sweep.entryTime) {
+        sweep.entryTime = entry;
+        sweep.normal = velocity > 0 ? Point{-axis.x, -axis.y} : axis;
     }
-    else {
-        addX = add * ratio;
-        addY = add;
+    sweep.exitTime = std::min(sweep.exitTime, exit);
+}
+
+/**
+ * @brief Finish a sweep, check the overlapping interval lies within the move and normalize the normal.
+ * @param[out] sweep The sweep to finish.
+ */
+static void finishSweep(SweepResult &sweep) {
+    if (!sweep.hit || sweep.entryTime >= sweep.exitTime || sweep.entryTime > 1 || sweep.exitTime <= 0) {
+        sweep.hit = false;
+        return;
     }
 
-    // Choose whether to add or subtract the value according to direction
-    if (directionX == 1) addX *= -1;
-    if (player->getDirectionY() == 1) addY *= -1;
+    float length = std::hypot(sweep.normal.x, sweep.normal.y);
+    if (length > 0) sweep.normal = {sweep.normal.x / length, sweep.normal.y / length};
+}
 
-    SDL_FRect playerBoundingBox = {x + moveX, y + moveY, w, h};
+SweepResult sweepAABB(const SDL_FRect &box, Point move, const SDL_FRect &obstacle) {
+    SweepResult sweep = {true, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), {0, 0}};
 
-    // The x-axis direction is right
-    if (directionX) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX > 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerBoundingBox = {x + moveX, y + moveY, w, h};
-        }
-    }
-    // The x-axis direction is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX < 0 && !checkAABBCollision(playerBoundingBox, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerBoundingBox = {x + moveX, y + moveY, w, h};
-        }
-    }
+    sweepOnAxis(box.x, box.x + box.w, move.x, obstacle.x, obstacle.x + obstacle.w, {1, 0}, sweep);
+    sweepOnAxis(box.y, box.y + box.h, move.y, obstacle.y, obstacle.y + obstacle.h, {0, 1}, sweep);
 
-    // Check if a collision has been detected in the loop
-    if ((directionX && moveX > 0) || (!directionX && moveX < 0)) {
-        // Set the move positions inside the collision
-        player->setMoveX(moveX);
-        player->setMoveY(moveY);
-        return true;
-    } else {
-        return false;
-    }
+    finishSweep(sweep);
+    return sweep;
 }
 
-bool checkAABBCollisionTunneling(Player *player, const SDL_FRect &obstacle) {
-    // The player has moved only on y-axis
-    if (player->getMoveX() == 0 && player->getMoveY() != 0) {
-        return checkAABBCollisionTunnelingOnYAxis(player, obstacle);
-    }
-    // The player has moved on both axis
-    else if (player->getMoveX() != 0 && player->getMoveY() != 0) {
-        return checkAABBCollisionTunnelingOnBothAxis(player, obstacle);
-    }
-    // The player has moved only on x-axis
-    else if (player->getMoveX() != 0 && player->getMoveY() == 0) {
-        return checkAABBCollisionTunnelingOnXAxis(player, obstacle);
-    }
-    // The player hasn't moved (supposed to be checked before calling this function)
-    else {
-        return false;
-    }
-}
+SweepResult sweepSAT(const SDL_FRect &box, Point move, const Polygon &obstacle) {
+    SweepResult sweep = {obstacle.isConvex(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), {0, 0}};
+    if (!sweep.hit) return sweep;
 
-static bool checkSATCollisionTunnelingOnXAxis(Player *player, const Polygon &obstacle) {
+    // Axes of the rectangle, the projections of the polygon are its bounding box
+    const SDL_FRect &boundingBox = obstacle.getBoundingBox();
+    sweepOnAxis(box.x, box.x + box.w, move.x, boundingBox.x, boundingBox.x + boundingBox.w, {1, 0}, sweep);
+    sweepOnAxis(box.y, box.y + box.h, move.y, boundingBox.y, boundingBox.y + boundingBox.h, {0, 1}, sweep);
 
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveX();
-    bool direction = player->getDirectionX() == 1;
-
-    std::vector<Point> playerVertices = {{x + move,     y},
-                                         {x + move + w, y},
-                                         {x + move + w, y + h},
-                                         {x + move,     y + h}};
-
-    // Direction on x-axis is right
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move -= w;
-            playerVertices = {{x + move,     y},
-                              {x + move + w, y},
-                              {x + move + w, y + h},
-                              {x + move,     y + h}};
-        }
-    }
-    // Direction on x-axis is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move += w;
-            playerVertices = {{x + move,     y},
-                              {x + move + w, y},
-                              {x + move + w, y + h},
-                              {x + move,     y + h}};
-        }
-    }
+    // Axes perpendicular to the sides of the polygon
+    const std::vector<Point> &axes = obstacle.getEdgeNormals();
+    const std::vector<Projection> &projections = obstacle.getProjections();
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveX(move); // Set moveX inside the collision
-        return true;
-    } else {
-        return false;
-    }
-}
+    for (size_t i = 0; i < axes.size() && sweep.hit; ++i) {
+        const Point &axis = axes[i];
 
-static bool checkSATCollisionTunnelingOnYAxis(Player *player, const Polygon &obstacle) {
+        float left = box.x * axis.x;
+        float right = (box.x + box.w) * axis.x;
+        float top = box.y * axis.y;
+        float bottom = (box.y + box.h) * axis.y;
+        float boxProjectionMin = std::min(left, right) + std::min(top, bottom);
+        float boxProjectionMax = std::max(left, right) + std::max(top, bottom);
 
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float move = player->getMoveY();
-    bool direction = player->getDirectionY() == 1;
-
-    std::vector<Point> playerVertices = {{x,     y + move},
-                                         {x + w, y + move},
-                                         {x + w, y + move + h},
-                                         {x,     y + move + h}};
-
-    // Direction on y-axis is down
-    if (direction) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move -= h;
-            playerVertices = {{x,     y + move},
-                              {x + w, y + move},
-                              {x + w, y + move + h},
-                              {x,     y + move + h}};
-        }
-    }
-    // Direction on y-axis is up
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (move < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            move += h;
-            playerVertices = {{x,     y + move},
-                              {x + w, y + move},
-                              {x + w, y + move + h},
-                              {x,     y + move + h}};
-        }
+        sweepOnAxis(boxProjectionMin, boxProjectionMax, move.x * axis.x + move.y * axis.y, projections[i].min, projections[i].max, axis, sweep);
     }
 
-    // Check if a collision has been detected in the loop
-    if ((direction && move > 0) || (!direction && move < 0)) {
-        player->setMoveY(move); // Set moveY inside the collision
-        return true;
-    } else {
-        return false;
-    }
+    finishSweep(sweep);
+    return sweep;
 }
 
+/**
+ * @brief Move the player inside the obstacle found by a sweep, as expected by the correction functions.
+ * @param player The player whose move is shortened.
+ * @param sweep The sweep of the player's move against the obstacle.
+ * @return True if the obstacle is on the player's route, false otherwise.
+ */
+static bool applySweepToPlayer(Player *player, const SweepResult &sweep) {
+    if (!sweep.hit) return false;
 
-static bool checkSATCollisionTunnelingOnBothAxis(Player *player, const Polygon &obstacle) {
-
-    // Initialization
-    float x = player->getX();
-    float y = player->getY();
-    float w = player->getW();
-    float h = player->getH();
-    float moveX = player->getMoveX();
-    float moveY = player->getMoveY();
-    bool directionX = player->getDirectionX() == 1; // True for right, false for left
-
-    float addX; // Value that will be added to moveX at each iteration
-    float addY; // Value that will be added to moveY at each iteration
-    float add = w < h ? w : h; // Select the player's shortest side
+    // Keep the whole move if it ends inside the obstacle, otherwise stop in the middle of the crossing
+    float time = sweep.exitTime > 1 ? 1 : std::midpoint(std::max(sweep.entryTime, 0.0F), sweep.exitTime);
 
-    // Create a ratio between moveX and moveY so they increment proportionally
-    float ratio = std::abs(moveX / moveY);
-    if (ratio > 1) {
-        addX = add;
-        addY = add / ratio;
-    }
-    else {
-        addX = add * ratio;
-        addY = add;
-    }
+    player->setMoveX(player->getMoveX() * time);
+    player->setMoveY(player->getMoveY() * time);
+    return true;
+}
 
-    // Choose whether to add or subtract the value according to direction
-    if (directionX == 1) addX *= -1;
-    if (player->getDirectionY() == 1) addY *= -1;
-
-    std::vector<Point> playerVertices = {{x + moveX,     y + moveY},
-                                         {x + moveX + w, y + moveY},
-                                         {x + moveX + w, y + moveY + h},
-                                         {x + moveX,     y + moveY + h}};
-
-    // The x-axis direction is right
-    if (directionX) {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX > 0 && !checkSATCollision(playerVertices, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerVertices = {{x + moveX,     y + moveY},
-                              {x + moveX + w, y + moveY},
-                              {x + moveX + w, y + moveY + h},
-                              {x + moveX,     y + moveY + h}};
-        }
-    }
-    // The x-axis direction is left
-    else {
-        // Check for collisions along the player's entire route to avoid tunneling effect
-        while (moveX < 0 && !checkSATCollision(playerVertices, obstacle)) {
-            moveX += addX;
-            moveY += addY;
-            playerVertices = {{x + moveX,     y + moveY},
-                              {x + moveX + w, y + moveY},
-                              {x + moveX + w, y + moveY + h},
-                              {x + moveX,     y + moveY + h}};
-        }
-    }
+bool checkAABBCollisionTunneling(Player *player, const SDL_FRect &obstacle) {
+    // The player hasn't moved (supposed to be checked before calling this function)
+    if (player->getMoveX() == 0 && player->getMoveY() == 0) return false;
 
-    // Check if a collision has been detected in the loop
-    if ((directionX && moveX > 0) || (!directionX && moveX < 0)) {
-        // Set the move positions inside the collision
-        player->setMoveX(moveX);
-        player->setMoveY(moveY);
-        return true;
-    } else {
-        return false;
-    }
+    SDL_FRect playerBoundingBox = {player->getX(), player->getY(), player->getW(), player->getH()};
+    return applySweepToPlayer(player, sweepAABB(playerBoundingBox, {player->getMoveX(), player->getMoveY()}, obstacle));
 }
 
 bool checkSATCollisionTunneling(Player *player, const Polygon &obstacle) {
-    // The player has moved only on y-axis
-    if (player->getMoveX() == 0 && player->getMoveY() != 0) {
-        return checkSATCollisionTunnelingOnYAxis(player, obstacle);
-    }
-    // The player has moved on both axes
-    else if (player->getMoveX() != 0 && player->getMoveY() != 0) {
-        return checkSATCollisionTunnelingOnBothAxis(player, obstacle);
-    }
-    // The player has moved only on x-axis
-    else if (player->getMoveX() != 0 && player->getMoveY() == 0) {
-        return checkSATCollisionTunnelingOnXAxis(player, obstacle);
-    }
     // The player hasn't moved (supposed to be checked before calling this function)
-    else {
-        return false;
-    }
+    if (player->getMoveX() == 0 && player->getMoveY() == 0) return false;
+
+    SDL_FRect playerBoundingBox = {player->getX(), player->getY(), player->getW(), player->getH()};
+    return applySweepToPlayer(player, sweepSAT(playerBoundingBox, {player->getMoveX(), player->getMoveY()}, obstacle));
 }
 
 void correctAABBCollision(Player *player, const SDL_FRect &obstacle) {
@@ -470,7 +339,7 @@ static float correctSATCollisionOnXAxis(const Player *player, const Polygon &obs
     float min = x - player->getMoveX();
     float max = x;
 
-    std::vector<Point> playerVertices;
+    SDL_FRect playerBoundingBox;
 
     int i = 0;
 
@@ -479,13 +348,10 @@ static float correctSATCollisionOnXAxis(const Player *player, const Polygon &obs
 
         move = std::midpoint(max, min);
 
-        playerVertices = {{move, y},
-                          {move + w, y},
-                          {move + w, y + h},
-                          {move, y + h}};
+        playerBoundingBox = {move, y, w, h};
 
         // The point is inside the collision
-        if (checkSATCollision(playerVertices, obstacle)) {
+        if (checkSATCollision(playerBoundingBox, obstacle)) {
             max = move;
         }
         // The point is outside the collision
@@ -512,7 +378,7 @@ static float correctSATCollisionOnYAxis(const Player *player, const Polygon &obs
     float min = y - player->getMoveY();
     float max = y;
 
-    std::vector<Point> playerVertices;
+    SDL_FRect playerBoundingBox;
 
     int i = 0;
 
@@ -521,13 +387,10 @@ static float correctSATCollisionOnYAxis(const Player *player, const Polygon &obs
 
         move = std::midpoint(max, min);
 
-        playerVertices = {{x, move},
-                          {x + w, move},
-                          {x + w, move + h},
-                          {x, move + h}};
+        playerBoundingBox = {x, move, w, h};
 
         // The point is inside the collision
-        if (checkSATCollision(playerVertices, obstacle)) {
+        if (checkSATCollision(playerBoundingBox, obstacle)) {
             max = move;
         }
         // The point is outside the collision
@@ -570,7 +433,7 @@ static void correctSATCollisionOnBothAxis(Player *player, const Polygon &obstacl
         divideY = 2;
     }
 
-    std::vector<Point> playerVertices;
+    SDL_FRect playerBoundingBox;
 
     int i = 0;
 
@@ -580,13 +443,10 @@ static void correctSATCollisionOnBothAxis(Player *player, const Polygon &obstacl
         moveX = std::lerp(minX, maxX, divideX);
         moveY = std::lerp(minY, maxY, divideY);
 
-        playerVertices = {{moveX, moveY},
-                          {moveX + w, moveY},
-                          {moveX + w, moveY + h},
-                          {moveX, moveY + h}};
+        playerBoundingBox = {moveX, moveY, w, h};
 
         // The point is inside the collision
-        if (checkSATCollision(playerVertices, obstacle)) {
+        if (checkSATCollision(playerBoundingBox, obstacle)) {
             maxX = moveX;
             maxY = moveY;
         }
@@ -619,22 +479,16 @@ void correctSATCollision(Player *player, const Polygon &obstacle) {
     // COLLISION ANALYSIS
 
     // Check if the collision concerns the x-axis movement
-    std::vector<Point> playerVertices = {{x, y - moveY},
-                                         {x + w, y - moveY},
-                                         {x + w, y - moveY + h},
-                                         {x, y - moveY + h }};
+    SDL_FRect playerBoundingBox = {x, y - moveY, w, h};
 
-    if (moveX != 0 && checkSATCollision(playerVertices, obstacle)) {
+    if (moveX != 0 && checkSATCollision(playerBoundingBox, obstacle)) {
         xaxis = true;
     }
 
     // Check if the collision concerns the y-axis movement
-    playerVertices = {{x - moveX, y},
-                      {x - moveX + w, y},
-                      {x - moveX + w, y + h},
-                      {x - moveX, y + h}};
+    playerBoundingBox = {x - moveX, y, w, h};
 
-    if (moveY != 0 && checkSATCollision(playerVertices, obstacle)) {
+    if (moveY != 0 && checkSATCollision(playerBoundingBox, obstacle)) {
         yaxis = true;
     }
 
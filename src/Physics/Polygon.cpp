@@ -8,12 +8,19 @@
 
 /* CONSTRUCTOR */
 
-Polygon::Polygon(const std::vector<Point> &vertices, PolygonType type) : vertices(vertices), type(type) {}
+Polygon::Polygon(const std::vector<Point> &vertices, PolygonType type) : vertices(vertices), type(type) {
+    bake();
+}
+
+Polygon::Polygon(std::span<const Point> vertices, PolygonType type, bool convex, const SDL_FRect &bounding_box,
+                 std::span<const Point> edge_normals, std::span<const Projection> projections) :
+        vertices(vertices.begin(), vertices.end()), type(type), convex(convex), boundingBox(bounding_box),
+        edgeNormals(edge_normals.begin(), edge_normals.end()), projections(projections.begin(), projections.end()) {}
 
 
 /* ACCESSORS */
 
-std::vector<Point> Polygon::getVertices() const {
+const std::vector<Point> &Polygon::getVertices() const {
     return vertices;
 }
 
@@ -21,6 +28,18 @@ PolygonType Polygon::getType() const {
     return type;
 }
 
+const SDL_FRect &Polygon::getBoundingBox() const {
+    return boundingBox;
+}
+
+const std::vector<Point> &Polygon::getEdgeNormals() const {
+    return edgeNormals;
+}
+
+const std::vector<Projection> &Polygon::getProjections() const {
+    return projections;
+}
+
 
 /* METHODS */
 
@@ -66,14 +85,52 @@ double Polygon::totalAngles() const {
     return sumAngles;
 }
 
-bool Polygon::isConvex() const{
+bool Polygon::isConvex() const {
+    return convex;
+}
+
+void Polygon::bake() {
     size_t n = vertices.size();
-    if (n < 3) {
-        return false;
-    }
 
     // Check if the sum of interior angles equals (n - 2) * 180 degrees (convex polygon property) with a tolerance
     const double tolerance = 1e-3;
-    return std::abs(totalAngles() - static_cast<double>(n - 2) * 180) < tolerance;
+    convex = n >= 3 && std::abs(totalAngles() - static_cast<double>(n - 2) * 180) < tolerance;
+    if (n >= 3 && !convex) printf("The obstacle is not convex\n");
+
+    if (n == 0) return;
+
+    // Compute the bounding box
+    float min_x = vertices[0].x;
+    float min_y = vertices[0].y;
+    float max_x = vertices[0].x;
+    float max_y = vertices[0].y;
+    for (const Point &vertex : vertices) {
+        min_x = std::min(min_x, vertex.x);
+        min_y = std::min(min_y, vertex.y);
+        max_x = std::max(max_x, vertex.x);
+        max_y = std::max(max_y, vertex.y);
+    }
+    boundingBox = {min_x, min_y, max_x - min_x, max_y - min_y};
+
+    // Compute the normal of each edge and the projection of the polygon onto it
+    edgeNormals.clear();
+    projections.clear();
+    edgeNormals.reserve(n);
+    projections.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        const Point &vertex1 = vertices[i];
+        const Point &vertex2 = vertices[(i + 1) % n];
+        Point axis = {-(vertex2.y - vertex1.y), vertex2.x - vertex1.x};
+
+        Projection projection = {vertices[0].x * axis.x + vertices[0].y * axis.y, vertices[0].x * axis.x + vertices[0].y * axis.y};
+        for (const Point &vertex : vertices) {
+            float value = vertex.x * axis.x + vertex.y * axis.y;
+            projection.min = std::min(projection.min, value);
+            projection.max = std::max(projection.max, value);
+        }
+
+        edgeNormals.push_back(axis);
+        projections.push_back(projection);
+    }
 }
 
@@ -0,0 +1,121 @@
+#include "../../include/Physics/SpatialGrid.h"
+
+/**
+ * @file SpatialGrid.cpp
+ * @brief Implements the SpatialGrid class responsible for indexing objects of a level by their position.
+ */
+
+
+/* CONSTRUCTORS */
+
+SpatialGrid::SpatialGrid(float cell_size) : cellSize(cell_size) {}
+
+
+/* ACCESSORS */
+
+size_t SpatialGrid::size() const {
+    return ranges.size();
+}
+
+
+/* METHODS */
+
+void SpatialGrid::clear() {
+    cells.clear();
+    ranges.clear();
+    queryMarks.clear();
+    queryStamp = 0;
+}
+
+size_t SpatialGrid::insert(const SDL_FRect &bounding_box) {
+    size_t index = ranges.size();
+    CellRange range = computeRange(bounding_box);
+
+    ranges.push_back(range);
+    queryMarks.push_back(0);
+    addToCells(index, range);
+
+    return index;
+}
+
+void SpatialGrid::update(size_t index, const SDL_FRect &bounding_box) {
+    CellRange range = computeRange(bounding_box);
+
+    // Most moves stay inside the same cells
+    if (range == ranges[index]) return;
+
+    removeFromCells(index, ranges[index]);
+    addToCells(index, range);
+    ranges[index] = range;
+}
+
+void SpatialGrid::query(const SDL_FRect &area, std::vector<size_t> &result) {
+    result.clear();
+
+    // Reset the marks when the stamp wraps around
+    if (++queryStamp == 0) {
+        std::ranges::fill(queryMarks, 0);
+        queryStamp = 1;
+    }
+
+    CellRange range = computeRange(area);
+    for (int x = range.minX; x <= range.maxX; x++) {
+        for (int y = range.minY; y <= range.maxY; y++) {
+            auto it = cells.find(cellKey(x, y));
+            if (it == cells.end()) continue;
+
+            for (size_t index : it->second) {
+                // Objects spanning several cells are collected once
+                if (queryMarks[index] != queryStamp) {
+                    queryMarks[index] = queryStamp;
+                    result.push_back(index);
+                }
+            }
+        }
+    }
+
+    // Keep the order of the source container
+    std::ranges::sort(result);
+}
+
+
+/* PRIVATE METHODS */
+
+SpatialGrid::CellRange SpatialGrid::computeRange(const SDL_FRect &bounding_box) const {
+    return {
+        static_cast<int>(std::floor(bounding_box.x / cellSize)),
+        static_cast<int>(std::floor(bounding_box.y / cellSize)),
+        static_cast<int>(std::floor((bounding_box.x + bounding_box.w) / cellSize)),
+        static_cast<int>(std::floor((bounding_box.y + bounding_box.h) / cellSize))
+    };
+}
+
+std::int64_t SpatialGrid::cellKey(int x, int y) {
+    return (static_cast<std::int64_t>(x) << 32) | static_cast<std::uint32_t>(y);
+}
+
+void SpatialGrid::addToCells(size_t index, const CellRange &range) {
+    for (int x = range.minX; x <= range.maxX; x++) {
+        for (int y = range.minY; y <= range.maxY; y++) {
+            cells[cellKey(x, y)].push_back(index);
+        }
+    }
+}
+
+void SpatialGrid::removeFromCells(size_t index, const CellRange &range) {
+    for (int x = range.minX; x <= range.maxX; x++) {
+        for (int y = range.minY; y <= range.maxY; y++) {
+            auto it = cells.find(cellKey(x, y));
+            if (it == cells.end()) continue;
+
+            std::vector<size_t> &cell = it->second;
+            auto position = std::ranges::find(cell, index);
+            if (position != cell.end()) {
+                *position = cell.back();
+                cell.pop_back();
+            }
+
+            if (cell.empty()) cells.erase(it);
+        }
+    }
+}
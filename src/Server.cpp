@@ -0,0 +1,134 @@
+#include <thread>
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+#include "../include/Game/Game.h"
+#include "../include/Network/NetworkManager.h"
+#include "../include/Network/NetworkError.h"
+#include "../include/Utils/MessageQueue.h"
+
+/**
+ * @file Server.cpp
+ * @brief Entry point of the dedicated server, hosting a game without window, audio or keyboard.
+ *
+ * Usage: play-together-server [port] [slot] [trace_file]
+ *
+ * With a trace file, the profiler captures the zones of every thread from the start. The last seconds are written to the
+ * file when the server stops and, on Unix, each time it receives SIGUSR1.
+ */
+
+int main(int argc, char *args[]) {
+#ifdef DEVELOPMENT_MODE
+    std::cout << "SERVER : WARNING : DEVELOPMENT_MODE is enabled" << std::endl;
+#endif
+
+    // Read the port, the save slot and the trace file from the command line
+    uint16_t port = 8080;
+    int slot = 0;
+    std::string traceFile;
+    try {
+        if (argc > 1) {
+            int value = std::stoi(args[1]);
+            if (value < 1 || value > 65535) throw std::out_of_range("port");
+            port = static_cast<uint16_t>(value);
+        }
+        if (argc > 2) slot = std::stoi(args[2]);
+        if (argc > 3) traceFile = args[3];
+    } catch (const std::exception &) {
+        std::cerr << "Usage: " << args[0] << " [port (1-65535)] [slot] [trace_file]" << std::endl;
+        return 1;
+    }
+
+// Initialize Winsock on Windows
+#ifdef _WIN32
+    WSADATA wsaData;
+    int result = WSAStartup(MAKEWORD(2, 2), &wsaData);
+    if (result != 0) {
+        std::cerr << "WSAStartup failed: " << result << std::endl;
+        return 1;
+    }
+#else
+    // Block the stop and trace signals before any thread is started, they are waited for by a dedicated thread
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    if (!traceFile.empty()) sigaddset(&stopSignals, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+#endif
+
+    // Initialize SDL without the video and audio subsystems
+    if (SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) < 0) {
+        std::cerr << "Error initializing SDL2: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    // The textures giving the size of the levers and crushers are decoded by a software renderer drawing into a 1x1 surface
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 1, 1, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDL_Renderer *renderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (renderer == nullptr) {
+        std::cerr << "Could not create software renderer: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(surface);
+        SDL_Quit();
+        return 1;
+    }
+
+    // Initialize game objects, the frame rate only paces the loop at the tick rate
+    std::atomic<bool> quit = false; // Set by the signal thread
+
+    MessageQueue messageQueue;
+    Game game(nullptr, renderer, SimulationClock::TICK_RATE, &quit, &messageQueue);
+    NetworkManager networkManager;
+
+    // Initialize pointers for communication between objects, there is no menu
+    Mediator::setMessageQueuePtr(&messageQueue);
+    Mediator::setGamePtr(&game);
+    Mediator::setNetworkManagerPtr(&networkManager);
+
+#ifndef _WIN32
+    // Stop the game loop on SIGINT or SIGTERM, export the trace on SIGUSR1
+    std::jthread signalThread([&quit, traceFile, stopSignals]() {
+        int signal;
+        while (sigwait(&stopSignals, &signal) == 0) {
+            if (signal == SIGUSR1) {
+                Profiler::exportTrace(traceFile);
+                continue;
+            }
+            std::cout << "Server: Signal " << signal << " received, stopping" << std::endl;
+            quit = true;
+            break;
+        }
+    });
+    signalThread.detach();
+#endif
+
+    // Start the servers and host the game until it is stopped
+    if (!traceFile.empty()) Profiler::startCapture();
+    try {
+        networkManager.startServers(port);
+        game.initializeHostedGame(slot);
+        game.run();
+    } catch (const NetworkError &error) {
+        std::cerr << "Server: " << error.what() << std::endl;
+    }
+
+    /* Clean up resources */
+    networkManager.stopServers();
+    if (Profiler::isCapturing()) {
+        Profiler::stopCapture();
+        Profiler::exportTrace(traceFile);
+    }
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    SDL_Quit();
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+    return 0;
+}
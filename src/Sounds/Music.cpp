@@ -11,7 +11,11 @@ int Music::volume = 20;
 
 /* CONSTRUCTORS */
 
-Music::Music(const std::string& file_name) {
+Music::Music([[maybe_unused]] const std::string& file_name) {
+#ifdef HEADLESS
+    // The dedicated server has no audio device, nothing is loaded
+    music = nullptr;
+#else
     std::string file_path = std::string(MUSICS_DIRECTORY) + file_name;
     music = Mix_LoadMUS(file_path.c_str());
 
@@ -19,6 +23,7 @@ Music::Music(const std::string& file_name) {
     if (music == nullptr) {
         std::cerr << "Music: " << Mix_GetError() << std::endl;
     }
+#endif
 }
 
 /* METHODS */
@@ -32,6 +37,8 @@ void Music::setVolume(int new_volume) {
 }
 
 void Music::play(int loop) {
+    if (music == nullptr) return;
+
     Mix_PlayMusic(music, loop);
     setVolume(volume);
 }
@@ -0,0 +1,52 @@
+#include "../../include/Sounds/SoundBank.h"
+
+/**
+ * @file SoundBank.cpp
+ * @brief Implements the SoundBank class responsible for decoding each sound effect once for the whole process.
+ */
+
+// Static member initialization
+std::unordered_map<std::string, Mix_Chunk*> SoundBank::chunks;
+const std::vector<std::string> SoundBank::worldSounds = {
+    "lever.wav",
+    "Traps/crushing.wav",
+    "Events/explosion.wav",
+    "Items/coin.wav",
+    "Items/powerUp.wav"
+};
+
+
+/* METHODS */
+
+Mix_Chunk *SoundBank::getSound([[maybe_unused]] const std::string &file_name) {
+#ifdef HEADLESS
+    // The dedicated server has no audio device, nothing is loaded
+    return nullptr;
+#else
+    auto chunk = chunks.find(file_name);
+    if (chunk != chunks.end()) return chunk->second;
+
+    std::string file_path = std::string(SOUNDS_DIRECTORY) + file_name;
+    Mix_Chunk *sound = Mix_LoadWAV(file_path.c_str());
+
+    // Check error, the failure is remembered so that the file is not read again
+    if (sound == nullptr) {
+        std::cerr << "SoundBank: " << Mix_GetError() << std::endl;
+    }
+    chunks.emplace(file_name, sound);
+    return sound;
+#endif
+}
+
+void SoundBank::preload(const std::vector<std::string> &file_names) {
+    for (const std::string &file_name : file_names) {
+        getSound(file_name);
+    }
+}
+
+void SoundBank::clear() {
+    for (const auto &[file_name, sound] : chunks) {
+        if (sound != nullptr) Mix_FreeChunk(sound);
+    }
+    chunks.clear();
+}
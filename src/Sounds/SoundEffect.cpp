@@ -7,33 +7,14 @@
 
 // Static member initialization
 int SoundEffect::masterVolume = 32;
+bool SoundEffect::muted = false;
 
 
 /* CONSTRUCTORS */
 
-SoundEffect::SoundEffect(const std::string& file_name) {
-    std::string file_path = std::string(SOUNDS_DIRECTORY) + file_name;
-    sound = Mix_LoadWAV(file_path.c_str());
+SoundEffect::SoundEffect(const std::string& file_name) : sound(SoundBank::getSound(file_name)) {}
 
-    // Check error
-    if (sound == nullptr) {
-        std::cerr << "SoundEffect: " << Mix_GetError() << std::endl;
-    } else {
-        setVolume(volume);
-    }
-}
-
-SoundEffect::SoundEffect(const std::string& file_name, int volume) : volume(volume) {
-    std::string file_path = std::string(SOUNDS_DIRECTORY) + file_name;
-    sound = Mix_LoadWAV(file_path.c_str());
-
-    // Check error
-    if (sound == nullptr) {
-        std::cerr << "SoundEffect: " << Mix_GetError() << std::endl;
-    } else {
-        setVolume(volume);
-    }
-}
+SoundEffect::SoundEffect(const std::string& file_name, int volume) : sound(SoundBank::getSound(file_name)), volume(volume) {}
 
 
 /* ACCESSORS */
@@ -54,7 +35,11 @@ int SoundEffect::getVolume() const {
 /* MUTATORS */
 
 void SoundEffect::setVolume(int new_volume) {
-    Mix_VolumeChunk(sound, new_volume);
+    volume = new_volume;
+}
+
+void SoundEffect::setMuted(bool state) {
+    muted = state;
 }
 
 
@@ -65,7 +50,9 @@ void SoundEffect::stop() {
 }
 
 void SoundEffect::play(int loop, int vol) {
-    Mix_PlayChannel(-1, sound, loop); // '-1' takes the first available channel
-    setVolume(vol < 0 ? masterVolume : vol);
+    if (sound == nullptr || muted) return;
+
+    int channel = Mix_PlayChannel(-1, sound, loop); // '-1' takes the first available channel
+    if (channel != -1) Mix_Volume(channel, vol < 0 ? masterVolume : vol);
 }
 
@@ -26,6 +26,8 @@ void ApplicationConsole::run() const {
 void ApplicationConsole::executeGameRunningCommand(const std::string &command) const {
     if (command == "help") {
         displayHelp(1);
+    } else if (command.find("profile") != std::string::npos) {
+        controlProfiler(command);
     } else if (command.find("tp") != std::string::npos) {
         teleportPlayer(command);
     } else if (command.find("map") != std::string::npos) {
@@ -85,6 +87,7 @@ void ApplicationConsole::displayHelp(int gameState) const {
         std::cout << "enable [all | camera_shake | platforms | crushers] - Enable game mechanic\n";
         std::cout << "disable [all | camera_shake | platforms | crushers] - Disable game mechanic\n";
         std::cout << "render - Toggle rendering between textures and collisions box\n";
+        std::cout << "profile [start | stop [file] | overlay] - Capture the frame zones to a Chrome trace file, or toggle their overlay\n";
     } else {
         std::cout << "ping - Test the console\n";
         std::cout << "fps [fps] - Set the max frame rate (must be greater or equal to 30)\n";
@@ -263,6 +266,39 @@ void ApplicationConsole::toggleFPSRendering() const {
     std::cout << "FPS rendering toggled.\n";
 }
 
+void ApplicationConsole::controlProfiler(const std::string &command) const {
+    std::istringstream iss(command);
+    std::string command_name;
+    std::string option;
+    std::string file_path = "profile.json";
+    iss >> command_name >> option >> file_path;
+
+    if (command_name != "profile") {
+        std::cout << "Invalid syntax. Usage: profile [start | stop [file] | overlay]\n";
+        return;
+    }
+
+    if (option == "start") {
+        Profiler::startCapture();
+        std::cout << "Profiler capture started.\n";
+    }
+    else if (option == "stop") {
+        if (!Profiler::isCapturing()) {
+            std::cout << "No profiler capture is running.\n";
+            return;
+        }
+        Profiler::stopCapture();
+        Profiler::exportTrace(file_path);
+    }
+    else if (option == "overlay") {
+        Profiler::setOverlayShown(!Profiler::isOverlayShown());
+        std::cout << "Profiler overlay toggled.\n";
+    }
+    else {
+        std::cout << "Invalid option. Usage: profile [start | stop [file] | overlay]\n";
+    }
+}
+
 
 /* GAME NOT RUNNING COMMANDS METHODS */
 
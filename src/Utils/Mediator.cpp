@@ -76,35 +76,21 @@ void Mediator::sendAsteroidCreation(Asteroid const &asteroid) {
     Mediator::networkManagerPtr->sendAsteroidCreation(asteroid);
 }
 
-void Mediator::sendSyncCorrection(nlohmann::json &message) {
-    nlohmann::json platforms1D = nlohmann::json::array();
-    for (const auto &platform : gamePtr->getLevel()->getMovingPlatforms1D()) {
-        nlohmann::json platformProperties;
-        platformProperties["x"] = platform.getX();
-        platformProperties["y"] = platform.getY();
-        platforms1D.push_back(platformProperties);
-    }
+void Mediator::sendSyncCorrection() {
+    SyncCorrectionPacket body;
+    Level *level = gamePtr->getLevel();
 
-    nlohmann::json platforms2D = nlohmann::json::array();
-    for (const auto &platform : gamePtr->getLevel()->getMovingPlatforms2D()) {
-        nlohmann::json platformProperties;
-        platformProperties["x"] = platform.getX();
-        platformProperties["y"] = platform.getY();
-        platforms2D.push_back(platformProperties);
+    for (const Player &player : gamePtr->getPlayerManager().getAlivePlayers()) {
+        int playerID = player.getPlayerID();
+        if (playerID == -1) playerID = 0; // The server player has ID 0
+        body.players.push_back({playerID, player.getX(), player.getY()});
     }
 
-    nlohmann::json crushers = nlohmann::json::array();
-    for (const auto &crusher : gamePtr->getLevel()->getCrushers()) {
-        nlohmann::json crusherProperties;
-        crusherProperties["x"] = crusher.getX();
-        crusherProperties["y"] = crusher.getY();
-        crushers.push_back(crusherProperties);
-    }
+    for (const auto &platform : level->getMovingPlatforms1D()) body.platforms1D.push_back({platform.getX(), platform.getY()});
+    for (const auto &platform : level->getMovingPlatforms2D()) body.platforms2D.push_back({platform.getX(), platform.getY()});
+    for (const auto &crusher : level->getCrushers()) body.crushers.push_back({crusher.getX(), crusher.getY()});
 
-    message["platforms1D"] = platforms1D;
-    message["platforms2D"] = platforms2D;
-    message["crushers"] = crushers;
-    Mediator::networkManagerPtr->sendSyncCorrection(message);
+    Mediator::networkManagerPtr->sendSyncCorrection(body);
 }
 
 /** MENU METHODS **/
@@ -187,6 +173,7 @@ void Mediator::getGameProperties(nlohmann::json &properties) {
 
     // Set the game properties
     properties["mapName"] = level->getMapName();
+    properties["tick"] = SimulationClock::getTick();
     properties["lastCheckpoint"] = level->getLastCheckpoint();
     properties["platforms1D"] = platforms1D;
     properties["platforms2D"] = platforms2D;
@@ -205,38 +192,29 @@ std::vector<Player> const &Mediator::getAlivePlayers() {
 /** OTHER METHODS **/
 
 int Mediator::handleClientConnect(int playerID) {
-    // Check if the player ID is not already taken by another character.
-    for (const auto &character : gamePtr->getPlayerManager().getAlivePlayers()) {
-        if (character.getPlayerID() == playerID) {
-            return -1; // ID already taken.
-        }
-    }
-
-    // If the ID is valid and not taken, create a new character for the new player.
-    // Get the player's position id based on his position in the players list
-
-    size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
-    Level const *level = gamePtr->getLevel();
-    Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
-    Player newPlayer(playerID, spawnPoint, 2);
-    gamePtr->getPlayerManager().addPlayer(newPlayer);
-
-    std::cout << "Mediator: Player " << playerID << " connected" << std::endl;
+    Message message;
+    message.type = MessageType::CLIENT_CONNECT;
+    message.playerID = playerID;
+    pushMessage(message);
     return 0;
 }
 
 int Mediator::handleClientDisconnect(int playerID) {
-    PlayerManager &playerManager = gamePtr->getPlayerManager();
-
-    // Find the character with the given player ID and remove it from the game.
-    Player const *playerPtr = playerManager.findPlayerById(playerID);
-    if (playerPtr != nullptr) gamePtr->getPlayerManager().removePlayer(*playerPtr);
-
-    std::cout << "Mediator: Player " << playerID << " disconnected" << std::endl;
+    Message message;
+    message.type = MessageType::CLIENT_DISCONNECT;
+    message.playerID = playerID;
+    pushMessage(message);
     return 0;
 }
 
 void Mediator::handleMessages(int protocol, const std::string &rawMessage, int playerID) {
+    ProfileZone zone("Mediator::handleMessages");
+    // Packets sent at high frequency use the binary protocol
+    if (isBinaryPacket(rawMessage)) {
+        handleBinaryPacket(protocol, rawMessage, playerID);
+        return;
+    }
+
 #ifdef DEVELOPMENT_MODE
     std::cout << "Mediator: Received message: " << rawMessage << " from player " << playerID << std::endl;
 #endif
@@ -253,140 +231,214 @@ void Mediator::handleMessages(int protocol, const std::string &rawMessage, int p
             Mediator::networkManagerPtr->broadcastMessage(protocol, message.dump(), playerID);
         }
 
-        // Check message type and handle it accordingly
+        // Check message type and decode it accordingly, the game loop applies it at the beginning of its next update
         std::string messageType = message["messageType"];
+        Message decodedMessage;
+
+        if (messageType == "playerConnect") {
+            decodedMessage.type = MessageType::PLAYER_CONNECT;
+            decodedMessage.playerID = message["playerID"];
+        }
+
+        else if (messageType == "playerDisconnect") {
+            decodedMessage.type = MessageType::PLAYER_DISCONNECT;
+            decodedMessage.playerID = message["playerID"];
+        }
+
+        else if (messageType == "gameProperties") {
+            // Load the texture of the map and initialize the game
+            decodedMessage.type = MessageType::INITIALIZE_CLIENT_GAME;
+            decodedMessage.payload = rawMessage;
+        }
+
+        else {
+            std::cerr << "Mediator: Unknown message type: " << messageType << std::endl;
+            return;
+        }
+
+        pushMessage(decodedMessage);
+
+    } catch (const json::exception &e) {
+        std::cerr << "Mediator: Error parsing message: " << e.what() << std::endl;
+    }
+}
+
+void Mediator::handleBinaryPacket(int protocol, const std::string &packet, int playerID) {
+    Message decodedMessage;
+
+    // Snapshots are rebuilt from the previous ones, a late snapshot or one with a lost base is skipped
+    if (getPacketType(packet) == PacketType::SNAPSHOT) {
+        if (!networkManagerPtr->isServerRunning() && networkManagerPtr->receiveSnapshot(packet, decodedMessage)) {
+            pushMessage(decodedMessage);
+        }
+        return;
+    }
+
+    if (!decodePacket(packet, decodedMessage)) {
+        std::cerr << "Mediator: Invalid packet of " << packet.size() << " bytes from player " << playerID << std::endl;
+        return;
+    }
+
+    // Acknowledgements are meant for the server only, they are not relayed
+    if (decodedMessage.type == MessageType::SNAPSHOT_ACK) {
+        decodedMessage.playerID = playerID;
+        pushMessage(decodedMessage);
+        return;
+    }
+
+    // If the application is a server, stamp the sender in the header and relay the packet as is to the other clients
+    if (networkManagerPtr->isServerRunning()) {
+        std::string relayedPacket = packet;
+        setPacketPlayerID(relayedPacket, playerID);
+        Mediator::networkManagerPtr->broadcastMessage(protocol, relayedPacket, playerID);
+        decodedMessage.playerID = playerID;
+    }
+
+    pushMessage(decodedMessage);
+}
+
+void Mediator::applyMessage(const Message &message) {
+    ProfileZone zone("Mediator::applyMessage");
+    PlayerManager &playerManager = gamePtr->getPlayerManager();
+
+    switch (message.type) {
+        case MessageType::INITIALIZE_CLIENT_GAME: {
+            nlohmann::json properties = nlohmann::json::parse(message.payload);
+
+            // Start from the clock of the server, the ticks stamped on the player updates are compared by the rollback
+            if (properties.contains("tick")) SimulationClock::setTick(properties["tick"]);
+            gamePtr->getPredictionManager().clear(); // The states predicted in a previous game may be stamped with later ticks
+
+            gamePtr->loadLevel(
+                    properties["mapName"],
+                    properties["lastCheckpoint"],
+                    properties["players"],
+                    properties["camera"],
+                    properties["platforms1D"],
+                    properties["platforms2D"],
+                    properties["crushers"]
+            );
+            menuPtr->setMenuAction(MenuAction::MAIN); // The menu is only changed by the game loop, never by the network thread
+            break;
+        }
+
+        case MessageType::CLIENT_CONNECT:
+        case MessageType::PLAYER_CONNECT: {
+            // Check if the player ID is not already taken by another character
+            if (playerManager.findPlayerById(message.playerID) != nullptr) break;
+
+            // Get the player's spawn point based on his position in the players list
+            size_t spawnIndex = playerManager.getPlayerCount();
+            Level const *level = gamePtr->getLevel();
+            Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
 
-        if (messageType == "playerUpdate") {
-            // Get the player ID from the message if it exists, otherwise use the playerID parameter
-            int playerSocketID = (message.contains("playerID") ? (int)message["playerID"] : playerID);
+            Player newPlayer(message.playerID, spawnPoint, 2);
+            playerManager.addPlayer(newPlayer);
+            gamePtr->getRollbackManager().clear(); // The saved steps do not know the new player
+
+            // Send the game, including the new player, to the client and tell the others
+            if (message.type == MessageType::CLIENT_CONNECT) {
+                networkManagerPtr->welcomeClient(message.playerID);
+                std::cout << "Mediator: Player " << message.playerID << " connected" << std::endl;
+            }
+            break;
+        }
+
+        case MessageType::CLIENT_DISCONNECT:
+        case MessageType::PLAYER_DISCONNECT: {
+            // Find the character with the given player ID and remove it from the game
+            Player const *playerPtr = playerManager.findPlayerById(message.playerID);
+            if (playerPtr != nullptr) playerManager.removePlayer(*playerPtr);
+            playersKeyStates.erase(message.playerID);
+            gamePtr->getRollbackManager().clear(); // The saved steps still hold the removed player
+
+            if (message.type == MessageType::CLIENT_DISCONNECT) {
+                std::cout << "Mediator: Player " << message.playerID << " disconnected" << std::endl;
+            }
+            break;
+        }
+
+        case MessageType::PLAYER_UPDATE: {
+            // A late input is applied by simulating again the steps since its tick
+            if (RollbackManager::enabled && gamePtr->getRollbackManager().receiveInput(message.playerID, message.keyboardStateMask, message.inputTick)) break;
 
             // Decode the keyboard state mask
-            uint16_t keyboardStateMask = message["keyboardStateMask"];
             std::array<int, SDL_NUM_SCANCODES> keyStates = {0};
-            decodeKeyboardStateMask(keyboardStateMask, keyStates);
+            decodeKeyboardStateMask(message.keyboardStateMask, keyStates);
 
             // Find the player with the given player ID and handle the keyboard state only if the player is alive
-            Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
+            Player *playerPtr = playerManager.findPlayerById(message.playerID);
             if (playerPtr != nullptr) handleKeyboardState(playerPtr, keyStates);
+
+            // Tell the client which of its inputs the next snapshots include
+            if (networkManagerPtr->isServerRunning()) networkManagerPtr->acknowledgeInput(message.playerID, message.inputTick);
+            break;
         }
 
-        else if (messageType == "syncCorrection") {
-            // For each player in "Players" array, update the player's position
-            json playersArray = message["players"];
-            for (const auto &player : playersArray) {
-                int playerSocketID = player["playerID"];
-                Player *playerPtr = gamePtr->getPlayerManager().findPlayerById(playerSocketID);
-                if (playerPtr == nullptr) {
-                    continue;
-                }
+        case MessageType::SYNC_CORRECTION: {
+            // Update the position of each player through its buffer
+            for (const PositionCorrection &player : message.players) {
+                Player *playerPtr = playerManager.findPlayerById(player.id);
+                if (playerPtr == nullptr) continue;
 
-                if (!player.contains("x") || !player.contains("y")) continue;
-                float playerX = player["x"];
-                float playerY = player["y"];
+                // The local player is predicted, its state is compared to the prediction at the tick of its last applied input
+                if (player.id == -1 && gamePtr->getPredictionManager().reconcile(*playerPtr, player.x, player.y, message.inputTick)) continue;
 
                 playerPtr->setBuffer({
-                    playerX - playerPtr->getX(),
-                    playerY - playerPtr->getY(),
+                    player.x - playerPtr->getX(),
+                    player.y - playerPtr->getY(),
                 });
             }
 
-            // For each 1D platform in "Platforms1D" array, update the platform's position
-            json platforms1DArray = message["platforms1D"];
+            // Update the position of each 1D platform
             std::vector<MovingPlatform1D>& movingPlatforms1D = gamePtr->getLevel()->getMovingPlatforms1D();
-            for (const auto& platform : platforms1DArray) {
-                if (!platform.contains("x") || !platform.contains("y")) continue;
-                float platformX = platform["x"];
-                float platformY = platform["y"];
-
-                // Find the corresponding index in movingPlatforms1D
-                // Assuming platforms1DArray and movingPlatforms1D have the same size
-                size_t index = &platform - &platforms1DArray[0];
+            for (const PositionCorrection &platform : message.platforms1D) {
+                auto index = static_cast<size_t>(platform.id);
                 if (index < movingPlatforms1D.size()) {
                     movingPlatforms1D[index].setBuffer({
-                       platformX - movingPlatforms1D[index].getX(),
-                       platformY - movingPlatforms1D[index].getY()
+                       platform.x - movingPlatforms1D[index].getX(),
+                       platform.y - movingPlatforms1D[index].getY()
                     });
                 }
             }
 
-            // For each 2D platform in "Platforms2D" array, update the platform's position
-            json platforms2DArray = message["platforms2D"];
+            // Update the position of each 2D platform
             std::vector<MovingPlatform2D>& movingPlatforms2D = gamePtr->getLevel()->getMovingPlatforms2D();
-            for (const auto& platform : platforms2DArray) {
-                if (!platform.contains("x") || !platform.contains("y")) continue;
-                float platformX = platform["x"];
-                float platformY = platform["y"];
-
-                // Find the corresponding index in movingPlatforms2D
-                // Assuming platforms2DArray and movingPlatforms2D have the same size
-                size_t index = &platform - &platforms2DArray[0];
+            for (const PositionCorrection &platform : message.platforms2D) {
+                auto index = static_cast<size_t>(platform.id);
                 if (index < movingPlatforms2D.size()) {
                     movingPlatforms2D[index].setBuffer({
-                       platformX - movingPlatforms2D[index].getX(),
-                       platformY - movingPlatforms2D[index].getY()
+                       platform.x - movingPlatforms2D[index].getX(),
+                       platform.y - movingPlatforms2D[index].getY()
                     });
                 }
             }
 
-            // For each crusher in "Crushers" array, update the crusher's position
-            json crushersArray = message["crushers"];
+            // Update the position of each crusher
             std::vector<Crusher>& crushers = gamePtr->getLevel()->getCrushers();
-            for (const auto& crusher : crushersArray) {
-                if (!crusher.contains("x") || !crusher.contains("y")) continue;
-                float crusherX = crusher["x"];
-                float crusherY = crusher["y"];
-
-                // Find the corresponding index in crushers
-                // Assuming crushersArray and crushers have the same size
-                size_t index = &crusher - &crushersArray[0];
+            for (const PositionCorrection &crusher : message.crushers) {
+                auto index = static_cast<size_t>(crusher.id);
                 if (index < crushers.size()) {
                     crushers[index].setBuffer({
-                       crusherX - crushers[index].getX(),
-                       crusherY - crushers[index].getY()
+                       crusher.x - crushers[index].getX(),
+                       crusher.y - crushers[index].getY()
                     });
                 }
             }
-
+            break;
         }
 
-        else if (messageType == "playerConnect") {
-            int playerSocketID = message["playerID"];
+        case MessageType::SNAPSHOT_ACK:
+            networkManagerPtr->acknowledgeSnapshot(message.playerID, message.sequence);
+            break;
 
-            // Get the player's spawn point based on his position in the players list
-            size_t spawnIndex = gamePtr->getPlayerManager().getPlayerCount();
-            Level const *level = gamePtr->getLevel();
-            Point spawnPoint = level->getSpawnPoints(level->getLastCheckpoint())[spawnIndex];
-
-            Player newPlayer(playerSocketID, spawnPoint, 2);
-            gamePtr->getPlayerManager().addPlayer(newPlayer);
-        }
-
-        else if (messageType == "playerDisconnect") {
-            int playerSocketID = message["playerID"];
-            PlayerManager &playerManager = gamePtr->getPlayerManager();
-
-            Player const *playerPtr = playerManager.findPlayerById(playerSocketID);
-            playerManager.removePlayer(*playerPtr);
-        }
-
-        else if (messageType == "gameProperties") {
-            // Load the texture of the map and initialize the game
-            messageQueuePtr->push("InitializeClientGame", {rawMessage});
-            menuPtr->setMenuAction(MenuAction::MAIN);
-        }
-
-        else if (messageType == "asteroidCreation") {
-            // Create a new asteroid with the received properties
-            Asteroid asteroid(message["x"], message["y"], message["speed"], message["h"], message["w"], message["angle"]);
+        case MessageType::ASTEROID_CREATION: {
+            const AsteroidProperties &properties = message.asteroid;
+            Asteroid asteroid(properties.x, properties.y, properties.speed, properties.h, properties.w, properties.angle);
             gamePtr->getLevel()->addAsteroid(asteroid);
+            if (RollbackManager::enabled) gamePtr->getRollbackManager().recordAsteroid(asteroid); // Restoring a past tick would lose it
+            break;
         }
-
-        else {
-            std::cerr << "Mediator: Unknown message type: " << messageType << std::endl;
-        }
-
-    } catch (const json::parse_error &e) {
-        std::cerr << "Mediator: Error parsing message: " << e.what() << std::endl;
     }
 }
 
@@ -416,6 +468,20 @@ void Mediator::decodeKeyboardStateMask(uint16_t mask, std::array<int, SDL_NUM_SC
     keyStates[SDL_SCANCODE_F] = (mask & (1 << 7)) != 0;
 }
 
+void Mediator::applyKeyboardStateMask(Player *player, uint16_t mask) {
+    std::array<int, SDL_NUM_SCANCODES> keyStates = {0};
+    decodeKeyboardStateMask(mask, keyStates);
+    handleKeyboardState(player, keyStates);
+}
+
+void Mediator::setKeyboardStateMask(int playerID, uint16_t mask) {
+    std::array<int, SDL_NUM_SCANCODES> keyStates = {0};
+    decodeKeyboardStateMask(mask, keyStates);
+    for (SDL_Scancode scancode : keyMapping) {
+        playersKeyStates[playerID][scancode] = keyStates[scancode] == 1;
+    }
+}
+
 void Mediator::handleKeyboardState(Player *player, std::array<int, SDL_NUM_SCANCODES> &keyStates) {
     int playerID = player->getPlayerID();
     SDL_KeyboardEvent keyEvent;
@@ -439,3 +505,9 @@ void Mediator::handleKeyboardState(Player *player, std::array<int, SDL_NUM_SCANC
         }
     }
 }
+
+void Mediator::pushMessage(Message &message) {
+    if (!messageQueuePtr->push(message)) {
+        std::cerr << "Mediator: Message queue is full, message dropped" << std::endl;
+    }
+}
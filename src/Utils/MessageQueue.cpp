@@ -1,21 +1,63 @@
 #include "../../include/Utils/MessageQueue.h"
 
-void MessageQueue::push(const std::string &message, const std::vector<std::string> &parameters) {
-    std::scoped_lock lock(mutex);
-    queue.emplace(message, parameters);
+/**
+ * @file MessageQueue.cpp
+ * @brief Implements the MessageQueue class carrying decoded network messages from the network threads to the game loop.
+ */
+
+
+/* CONSTRUCTORS */
+
+MessageQueue::MessageQueue(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) size *= 2;
+
+    capacityMask = size - 1;
+    slots = std::make_unique<Slot[]>(size);
+    for (size_t i = 0; i < size; i++) slots[i].sequence.store(i, std::memory_order_relaxed);
 }
 
-std::pair<std::string, std::vector<std::string>> MessageQueue::pop() {
-    std::scoped_lock lock(mutex);
-    if (queue.empty()) {
-        return {"", {}};
+
+/* METHODS */
+
+bool MessageQueue::push(Message &message) {
+    size_t position = pushPosition.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    // Reserve a slot, retrying if another producer took it first
+    while (true) {
+        slot = &slots[position & capacityMask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0) {
+            if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        } else if (difference < 0) {
+            return false; // The consumer has not read this slot yet, the queue is full
+        } else {
+            position = pushPosition.load(std::memory_order_relaxed);
+        }
     }
-    auto message = queue.front();
-    queue.pop();
-    return message;
+
+    std::swap(slot->message, message);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool MessageQueue::pop(Message &message) {
+    size_t position = popPosition.load(std::memory_order_relaxed);
+    Slot &slot = slots[position & capacityMask];
+
+    // The producer has not finished writing this slot yet
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1) return false;
+
+    std::swap(slot.message, message);
+    slot.sequence.store(position + capacityMask + 1, std::memory_order_release);
+    popPosition.store(position + 1, std::memory_order_relaxed);
+    return true;
 }
 
 bool MessageQueue::empty() const {
-    std::scoped_lock lock(mutex);
-    return queue.empty();
+    size_t position = popPosition.load(std::memory_order_relaxed);
+    return slots[position & capacityMask].sequence.load(std::memory_order_acquire) != position + 1;
 }
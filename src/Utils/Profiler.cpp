@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include "../../include/Utils/Profiler.h"
+#include "../../dependencies/json.hpp"
+
+/**
+ * @file Profiler.cpp
+ * @brief Implements the Profiler class recording the time spent in the zones of the code.
+ */
+
+std::atomic<bool> Profiler::recording = false;
+std::atomic<bool> Profiler::capturing = false;
+std::atomic<bool> Profiler::overlayShown = false;
+std::atomic<Uint64> Profiler::captureStart = 0;
+std::atomic<Uint64> Profiler::captureEnd = std::numeric_limits<Uint64>::max();
+std::mutex Profiler::buffersMutex;
+std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::buffers;
+thread_local Profiler::ThreadBuffer *Profiler::threadBuffer = nullptr;
+thread_local Uint32 Profiler::threadDepth = 0;
+thread_local std::string Profiler::currentThreadName;
+
+size_t Profiler::summaryCursor = 0;
+int Profiler::summaryFrameCount = 0;
+Uint64 Profiler::summaryStart = 0;
+Uint64 Profiler::frameStart = 0;
+std::vector<Profiler::ZoneStats> Profiler::zoneStats;
+std::vector<ZoneSummary> Profiler::zoneSummaries;
+
+
+/* ACCESSORS */
+
+bool Profiler::isCapturing() {
+    return capturing.load(std::memory_order_relaxed);
+}
+
+bool Profiler::isOverlayShown() {
+    return overlayShown.load(std::memory_order_relaxed);
+}
+
+const std::vector<ZoneSummary> &Profiler::getZoneSummaries() {
+    return zoneSummaries;
+}
+
+
+/* MODIFIERS */
+
+void Profiler::setThreadName(const std::string &name) {
+    currentThreadName = name;
+    if (threadBuffer == nullptr) return;
+
+    std::scoped_lock lock(buffersMutex);
+    threadBuffer->threadName = name;
+}
+
+void Profiler::setOverlayShown(bool state) {
+    overlayShown.store(state, std::memory_order_relaxed);
+    updateRecording();
+}
+
+
+/* METHODS */
+
+void Profiler::startCapture() {
+    captureStart.store(SDL_GetPerformanceCounter(), std::memory_order_relaxed);
+    captureEnd.store(std::numeric_limits<Uint64>::max(), std::memory_order_relaxed);
+    capturing.store(true, std::memory_order_relaxed);
+    updateRecording();
+}
+
+void Profiler::stopCapture() {
+    if (!capturing.load(std::memory_order_relaxed)) return;
+    captureEnd.store(SDL_GetPerformanceCounter(), std::memory_order_relaxed);
+    capturing.store(false, std::memory_order_relaxed);
+    updateRecording();
+}
+
+bool Profiler::exportTrace(const std::string &file_path) {
+    using json = nlohmann::json;
+    Uint64 first_tick = captureStart.load(std::memory_order_relaxed);
+    Uint64 last_tick = captureEnd.load(std::memory_order_relaxed);
+    double microseconds_per_tick = 1e6 / static_cast<double>(SDL_GetPerformanceFrequency());
+
+    json events = json::array();
+    std::vector<ZoneEvent> copied;
+    copied.reserve(bufferCapacity);
+
+    std::unique_lock lock(buffersMutex);
+    size_t thread_count = buffers.size();
+    for (const std::unique_ptr<ThreadBuffer> &buffer : buffers) {
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", buffer->threadID},
+                          {"args", {{"name", buffer->threadName}}}});
+
+        // Copy the ring, then drop the zones the thread may have been overwriting in the meantime
+        size_t written = buffer->written.load(std::memory_order_acquire);
+        size_t first = written > bufferCapacity ? written - bufferCapacity : 0;
+        copied.clear();
+        for (size_t i = first; i < written; i++) copied.push_back(buffer->events[i % bufferCapacity]);
+        size_t rewritten = buffer->written.load(std::memory_order_acquire);
+        size_t valid_first = rewritten >= bufferCapacity ? rewritten - bufferCapacity + 1 : 0;
+        size_t skipped = std::min(copied.size(), valid_first > first ? valid_first - first : 0);
+
+        for (auto event = copied.begin() + static_cast<std::ptrdiff_t>(skipped); event != copied.end(); event++) {
+            if (event->start < first_tick || event->end > last_tick) continue;
+            events.push_back({{"name", event->name}, {"ph", "X"}, {"pid", 1}, {"tid", buffer->threadID},
+                              {"ts", static_cast<double>(event->start - first_tick) * microseconds_per_tick},
+                              {"dur", static_cast<double>(event->end - event->start) * microseconds_per_tick}});
+        }
+    }
+    lock.unlock();
+
+    std::ofstream file(file_path);
+    if (!file.is_open()) {
+        std::cerr << "Profiler: Unable to open " << file_path << "." << std::endl;
+        return false;
+    }
+    file << json{{"traceEvents", events}, {"displayTimeUnit", "ms"}}.dump();
+
+    std::cout << "Profiler: Trace written to " << file_path << " (" << events.size() - thread_count << " zones)." << std::endl;
+    return true;
+}
+
+void Profiler::endFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 previous_frame_start = std::exchange(frameStart, now);
+    if (!overlayShown.load(std::memory_order_relaxed)) {
+        if (threadBuffer != nullptr) summaryCursor = threadBuffer->written.load(std::memory_order_relaxed);
+        return;
+    }
+
+    // Sum the zones recorded by the game thread during the frame, skipping the ones already overwritten
+    ThreadBuffer &buffer = getThreadBuffer();
+    size_t written = buffer.written.load(std::memory_order_relaxed);
+    summaryCursor = std::max(summaryCursor, written > bufferCapacity ? written - bufferCapacity : 0);
+    for (; summaryCursor < written; summaryCursor++) {
+        const ZoneEvent &event = buffer.events[summaryCursor % bufferCapacity];
+        auto stats = std::ranges::find_if(zoneStats, [&event](const ZoneStats &zone) {
+            return zone.name == event.name && zone.depth == event.depth;
+        });
+        Uint64 offset = event.start > previous_frame_start ? event.start - previous_frame_start : 0;
+        if (stats == zoneStats.end()) {
+            zoneStats.push_back({event.name, event.depth, offset, 0, 0, 0});
+            stats = zoneStats.end() - 1;
+        }
+        stats->firstOffset = std::min(stats->firstOffset, offset);
+        stats->frameTicks += event.end - event.start;
+    }
+
+    for (ZoneStats &zone : zoneStats) {
+        zone.totalTicks += zone.frameTicks;
+        zone.maxTicks = std::max(zone.maxTicks, zone.frameTicks);
+        zone.frameTicks = 0;
+    }
+    summaryFrameCount++;
+
+    // Publish the averages, a parent zone is always entered earlier in the frame than its children
+    auto frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    if (static_cast<double>(now - summaryStart) < summaryIntervalSeconds * frequency) return;
+
+    std::ranges::sort(zoneStats, [](const ZoneStats &a, const ZoneStats &b) {
+        return a.firstOffset != b.firstOffset ? a.firstOffset < b.firstOffset : a.depth < b.depth;
+    });
+    zoneSummaries.clear();
+    for (const ZoneStats &zone : zoneStats) {
+        zoneSummaries.push_back({zone.name, zone.depth,
+                                 static_cast<double>(zone.totalTicks) * 1000.0 / frequency / summaryFrameCount,
+                                 static_cast<double>(zone.maxTicks) * 1000.0 / frequency});
+    }
+    zoneStats.clear();
+    summaryFrameCount = 0;
+    summaryStart = now;
+}
+
+void Profiler::leaveZone(const char *name, Uint64 start, Uint64 end) {
+    threadDepth--;
+    ThreadBuffer &buffer = getThreadBuffer();
+    size_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[index % bufferCapacity] = {name, start, end, threadDepth};
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+Profiler::ThreadBuffer &Profiler::getThreadBuffer() {
+    if (threadBuffer != nullptr) return *threadBuffer;
+
+    std::scoped_lock lock(buffersMutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->threadID = static_cast<int>(buffers.size()) + 1;
+    buffer->threadName = currentThreadName.empty() ? "Thread " + std::to_string(buffer->threadID) : currentThreadName;
+    threadBuffer = buffer.get();
+    buffers.push_back(std::move(buffer));
+    return *threadBuffer;
+}
+
+void Profiler::updateRecording() {
+    recording.store(capturing.load(std::memory_order_relaxed) || overlayShown.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+}
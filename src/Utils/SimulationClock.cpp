@@ -0,0 +1,33 @@
+#include "../../include/Utils/SimulationClock.h"
+
+/**
+ * @file SimulationClock.cpp
+ * @brief Implements the SimulationClock class responsible for counting the fixed steps of the game simulation.
+ */
+
+Uint64 SimulationClock::tick = 0;
+
+
+/* ACCESSORS */
+
+Uint64 SimulationClock::getTick() {
+    return tick;
+}
+
+Uint32 SimulationClock::getTime() {
+    return static_cast<Uint32>(tick * 1000 / TICK_RATE);
+}
+
+
+/* MODIFIERS */
+
+void SimulationClock::setTick(Uint64 value) {
+    tick = value;
+}
+
+
+/* METHODS */
+
+void SimulationClock::advance() {
+    tick++;
+}